@@ -0,0 +1,283 @@
+/*******************************************************************************************
+*
+*   raylib [others] example - raymath SIMD check
+*
+*   Console program, compares raymath SIMD backend functions (single element and array kernels)
+*   with the scalar code path (RAYMATH_DISABLE_SIMD), no window is required
+*
+*   NOTE: This file is compiled twice, defining RAYMATH_CHECK_SCALAR it provides the scalar
+*   reference functions (raymath with RAYMATH_DISABLE_SIMD), otherwise it provides the checks
+*   using the default raymath configuration (SIMD backend when available)
+*
+*   Build (not included in examples build files, run from this directory, file is compiled twice):
+*       gcc -c others_raymath_simd_check.c -std=c11 -O2 -DRAYMATH_CHECK_SCALAR -I../../src -o raymath_scalar.o
+*       gcc others_raymath_simd_check.c raymath_scalar.o -std=c11 -O2 -I../../src -lm -o others_raymath_simd_check
+*   NOTE: raymath is header-only, linking libraylib is not required
+*
+*   Results are expected to match exactly (same operations in same order), unless the compiler
+*   contracts scalar code into FMA instructions (-ffp-contract), then a small tolerance is accepted
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib contributors
+*
+********************************************************************************************/
+
+#define RAYMATH_STATIC_INLINE
+
+#if defined(RAYMATH_CHECK_SCALAR)
+    #define RAYMATH_DISABLE_SIMD
+#endif
+
+#include "raymath.h"
+
+#if defined(RAYMATH_CHECK_SCALAR)
+//------------------------------------------------------------------------------------
+// Scalar reference functions (RAYMATH_DISABLE_SIMD)
+//------------------------------------------------------------------------------------
+Vector3 ScalarVector3Normalize(Vector3 v) { return Vector3Normalize(v); }
+Vector3 ScalarVector3Transform(Vector3 v, Matrix mat) { return Vector3Transform(v, mat); }
+Quaternion ScalarQuaternionMultiply(Quaternion q1, Quaternion q2) { return QuaternionMultiply(q1, q2); }
+Matrix ScalarMatrixMultiply(Matrix left, Matrix right) { return MatrixMultiply(left, right); }
+void ScalarVector3TransformArray(Vector3 *result, const Vector3 *v, int count, Matrix mat) { Vector3TransformArray(result, v, count, mat); }
+void ScalarVector3NormalizeArray(Vector3 *result, const Vector3 *v, int count) { Vector3NormalizeArray(result, v, count); }
+void ScalarQuaternionMultiplyArray(Quaternion *result, const Quaternion *q1, const Quaternion *q2, int count) { QuaternionMultiplyArray(result, q1, q2, count); }
+void ScalarMatrixMultiplyArray(Matrix *result, const Matrix *left, const Matrix *right, int count) { MatrixMultiplyArray(result, left, right, count); }
+
+#else
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: malloc(), free()
+#include <string.h>             // Required for: memcmp(), memcpy()
+#include <stdbool.h>            // Required for: bool
+#include <math.h>               // Required for: fabsf(), fmaxf()
+
+#define CHECK_ELEMENTS      1027            // Elements count, not multiple of 4 to check array kernels remainder
+#define CHECK_TOLERANCE     0.00001f        // Relative tolerance (FMA contracted scalar code)
+
+// Check results
+typedef struct CheckResult {
+    int values;                 // Compared values count
+    int mismatches;             // Values not matching exactly
+    float maxError;             // Maximum relative error
+} CheckResult;
+
+//------------------------------------------------------------------------------------
+// Scalar reference functions declaration (RAYMATH_CHECK_SCALAR translation unit)
+//------------------------------------------------------------------------------------
+Vector3 ScalarVector3Normalize(Vector3 v);
+Vector3 ScalarVector3Transform(Vector3 v, Matrix mat);
+Quaternion ScalarQuaternionMultiply(Quaternion q1, Quaternion q2);
+Matrix ScalarMatrixMultiply(Matrix left, Matrix right);
+void ScalarVector3TransformArray(Vector3 *result, const Vector3 *v, int count, Matrix mat);
+void ScalarVector3NormalizeArray(Vector3 *result, const Vector3 *v, int count);
+void ScalarQuaternionMultiplyArray(Quaternion *result, const Quaternion *q1, const Quaternion *q2, int count);
+void ScalarMatrixMultiplyArray(Matrix *result, const Matrix *left, const Matrix *right, int count);
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static float GetRandomFloat(float min, float max);          // Get pseudo-random float value (deterministic)
+static void GenRandomFloats(float *values, int count, float min, float max);    // Generate pseudo-random float values
+static CheckResult CompareFloats(const float *values, const float *reference, int count);   // Compare values with reference
+static bool PrintCheckResult(const char *name, CheckResult result);     // Print check result, returns true if passed
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int count = CHECK_ELEMENTS;
+
+    Vector3 *vectors = (Vector3 *)malloc(count*sizeof(Vector3));
+    Quaternion *quats1 = (Quaternion *)malloc(count*sizeof(Quaternion));
+    Quaternion *quats2 = (Quaternion *)malloc(count*sizeof(Quaternion));
+    Matrix *mats1 = (Matrix *)malloc(count*sizeof(Matrix));
+    Matrix *mats2 = (Matrix *)malloc(count*sizeof(Matrix));
+
+    Vector3 *vectorsResult = (Vector3 *)malloc(count*sizeof(Vector3));
+    Vector3 *vectorsReference = (Vector3 *)malloc(count*sizeof(Vector3));
+    Quaternion *quatsResult = (Quaternion *)malloc(count*sizeof(Quaternion));
+    Quaternion *quatsReference = (Quaternion *)malloc(count*sizeof(Quaternion));
+    Matrix *matsResult = (Matrix *)malloc(count*sizeof(Matrix));
+    Matrix *matsReference = (Matrix *)malloc(count*sizeof(Matrix));
+
+    GenRandomFloats((float *)vectors, count*3, -100.0f, 100.0f);
+    GenRandomFloats((float *)quats1, count*4, -1.0f, 1.0f);
+    GenRandomFloats((float *)quats2, count*4, -1.0f, 1.0f);
+    GenRandomFloats((float *)mats1, count*16, -10.0f, 10.0f);
+    GenRandomFloats((float *)mats2, count*16, -10.0f, 10.0f);
+
+    // Special cases: zero vector (kept unchanged by normalization), tiny and huge vectors
+    vectors[0] = (Vector3){ 0.0f, 0.0f, 0.0f };
+    vectors[5] = (Vector3){ 1e-20f, 0.0f, 0.0f };
+    vectors[6] = (Vector3){ 1e18f, -1e18f, 1e18f };
+    vectors[count - 1] = (Vector3){ 0.0f, 0.0f, 0.0f };
+
+    Matrix transform = mats1[0];
+    bool passed = true;
+    //--------------------------------------------------------------------------------------
+
+    // Checks
+    //--------------------------------------------------------------------------------------
+#if defined(RAYMATH_SIMD_SSE2)
+    printf("raymath SIMD backend: SSE2\n\n");
+#elif defined(RAYMATH_SIMD_NEON)
+    printf("raymath SIMD backend: NEON\n\n");
+#else
+    printf("raymath SIMD backend: not available, scalar code is checked against itself\n\n");
+#endif
+
+    // Single element functions
+    for (int i = 0; i < count; i++)
+    {
+        vectorsResult[i] = Vector3Normalize(vectors[i]);
+        vectorsReference[i] = ScalarVector3Normalize(vectors[i]);
+    }
+    passed &= PrintCheckResult("Vector3Normalize", CompareFloats((float *)vectorsResult, (float *)vectorsReference, count*3));
+
+    for (int i = 0; i < count; i++)
+    {
+        vectorsResult[i] = Vector3Transform(vectors[i], mats1[i]);
+        vectorsReference[i] = ScalarVector3Transform(vectors[i], mats1[i]);
+    }
+    passed &= PrintCheckResult("Vector3Transform", CompareFloats((float *)vectorsResult, (float *)vectorsReference, count*3));
+
+    for (int i = 0; i < count; i++)
+    {
+        quatsResult[i] = QuaternionMultiply(quats1[i], quats2[i]);
+        quatsReference[i] = ScalarQuaternionMultiply(quats1[i], quats2[i]);
+    }
+    passed &= PrintCheckResult("QuaternionMultiply", CompareFloats((float *)quatsResult, (float *)quatsReference, count*4));
+
+    for (int i = 0; i < count; i++)
+    {
+        matsResult[i] = MatrixMultiply(mats1[i], mats2[i]);
+        matsReference[i] = ScalarMatrixMultiply(mats1[i], mats2[i]);
+    }
+    passed &= PrintCheckResult("MatrixMultiply", CompareFloats((float *)matsResult, (float *)matsReference, count*16));
+
+    // Array functions, compared with scalar array functions and with scalar single element functions
+    Vector3TransformArray(vectorsResult, vectors, count, transform);
+    ScalarVector3TransformArray(vectorsReference, vectors, count, transform);
+    passed &= PrintCheckResult("Vector3TransformArray", CompareFloats((float *)vectorsResult, (float *)vectorsReference, count*3));
+    for (int i = 0; i < count; i++) vectorsReference[i] = ScalarVector3Transform(vectors[i], transform);
+    passed &= PrintCheckResult("Vector3TransformArray (single)", CompareFloats((float *)vectorsResult, (float *)vectorsReference, count*3));
+
+    Vector3NormalizeArray(vectorsResult, vectors, count);
+    ScalarVector3NormalizeArray(vectorsReference, vectors, count);
+    passed &= PrintCheckResult("Vector3NormalizeArray", CompareFloats((float *)vectorsResult, (float *)vectorsReference, count*3));
+    for (int i = 0; i < count; i++) vectorsReference[i] = ScalarVector3Normalize(vectors[i]);
+    passed &= PrintCheckResult("Vector3NormalizeArray (single)", CompareFloats((float *)vectorsResult, (float *)vectorsReference, count*3));
+
+    QuaternionMultiplyArray(quatsResult, quats1, quats2, count);
+    ScalarQuaternionMultiplyArray(quatsReference, quats1, quats2, count);
+    passed &= PrintCheckResult("QuaternionMultiplyArray", CompareFloats((float *)quatsResult, (float *)quatsReference, count*4));
+    for (int i = 0; i < count; i++) quatsReference[i] = ScalarQuaternionMultiply(quats1[i], quats2[i]);
+    passed &= PrintCheckResult("QuaternionMultiplyArray (single)", CompareFloats((float *)quatsResult, (float *)quatsReference, count*4));
+
+    MatrixMultiplyArray(matsResult, mats1, mats2, count);
+    ScalarMatrixMultiplyArray(matsReference, mats1, mats2, count);
+    passed &= PrintCheckResult("MatrixMultiplyArray", CompareFloats((float *)matsResult, (float *)matsReference, count*16));
+    for (int i = 0; i < count; i++) matsReference[i] = ScalarMatrixMultiply(mats1[i], mats2[i]);
+    passed &= PrintCheckResult("MatrixMultiplyArray (single)", CompareFloats((float *)matsResult, (float *)matsReference, count*16));
+
+    // In-place processing (result buffer same as input buffer) must match out-of-place results
+    Vector3TransformArray(vectorsResult, vectors, count, transform);
+    memcpy(vectorsReference, vectors, count*sizeof(Vector3));
+    Vector3TransformArray(vectorsReference, vectorsReference, count, transform);
+    passed &= PrintCheckResult("Vector3TransformArray (in-place)", CompareFloats((float *)vectorsReference, (float *)vectorsResult, count*3));
+
+    Vector3NormalizeArray(vectorsResult, vectors, count);
+    memcpy(vectorsReference, vectors, count*sizeof(Vector3));
+    Vector3NormalizeArray(vectorsReference, vectorsReference, count);
+    passed &= PrintCheckResult("Vector3NormalizeArray (in-place)", CompareFloats((float *)vectorsReference, (float *)vectorsResult, count*3));
+
+    QuaternionMultiplyArray(quatsResult, quats1, quats2, count);
+    memcpy(quatsReference, quats1, count*sizeof(Quaternion));
+    QuaternionMultiplyArray(quatsReference, quatsReference, quats2, count);
+    passed &= PrintCheckResult("QuaternionMultiplyArray (in-place)", CompareFloats((float *)quatsReference, (float *)quatsResult, count*4));
+
+    MatrixMultiplyArray(matsResult, mats1, mats2, count);
+    memcpy(matsReference, mats2, count*sizeof(Matrix));
+    MatrixMultiplyArray(matsReference, mats1, matsReference, count);
+    passed &= PrintCheckResult("MatrixMultiplyArray (in-place)", CompareFloats((float *)matsReference, (float *)matsResult, count*16));
+
+    printf("\n%s\n", passed? "All checks passed" : "Some checks FAILED");
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(vectors);
+    free(quats1);
+    free(quats2);
+    free(mats1);
+    free(mats2);
+    free(vectorsResult);
+    free(vectorsReference);
+    free(quatsResult);
+    free(quatsReference);
+    free(matsResult);
+    free(matsReference);
+    //--------------------------------------------------------------------------------------
+
+    return passed? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Get pseudo-random float value (deterministic, linear congruential generator)
+static float GetRandomFloat(float min, float max)
+{
+    static unsigned int seed = 0x2545f491;
+
+    seed = seed*1664525u + 1013904223u;
+
+    return min + (max - min)*(float)(seed >> 8)/16777216.0f;
+}
+
+// Generate pseudo-random float values
+static void GenRandomFloats(float *values, int count, float min, float max)
+{
+    for (int i = 0; i < count; i++) values[i] = GetRandomFloat(min, max);
+}
+
+// Compare values with reference, relative error is computed for values larger than 1
+static CheckResult CompareFloats(const float *values, const float *reference, int count)
+{
+    CheckResult result = { 0 };
+
+    for (int i = 0; i < count; i++)
+    {
+        if (memcmp(&values[i], &reference[i], sizeof(float)) != 0)
+        {
+            float error = fabsf(values[i] - reference[i])/fmaxf(1.0f, fabsf(reference[i]));
+
+            if (error != error) error = 1.0f;   // NaN mismatch
+            if (error > result.maxError) result.maxError = error;
+
+            result.mismatches++;
+        }
+    }
+
+    result.values = count;
+
+    return result;
+}
+
+// Print check result, returns true if passed
+static bool PrintCheckResult(const char *name, CheckResult result)
+{
+    bool passed = (result.maxError <= CHECK_TOLERANCE);
+
+    printf("%-36s %s  values: %6i, not exact: %6i, max error: %g\n", name, passed? "OK  " : "FAIL",
+        result.values, result.mismatches, result.maxError);
+
+    return passed;
+}
+
+#endif  // RAYMATH_CHECK_SCALAR
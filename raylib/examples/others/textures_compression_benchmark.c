@@ -0,0 +1,170 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - compression benchmark
+*
+*   Console program, measures ImageCompress() quality (PSNR) and throughput (MPixels/s)
+*   for every block compressed format and quality preset, no window is required
+*
+*   Usage: textures_compression_benchmark [image file] [iterations]
+*   If no image is provided, a synthetic image (gradients, noise and hard edges) is used
+*
+*   Build (not included in examples build files, run from this directory once libraylib.a is built in ../../src):
+*       gcc textures_compression_benchmark.c -std=c11 -O2 -I../../src -L../../src -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -o textures_compression_benchmark
+*   NOTE: C11 is required for timespec_get(), system libraries listed are the Linux desktop ones
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi()
+#include <math.h>               // Required for: log10()
+#include <time.h>               // Required for: timespec_get() [C11]
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static double GetWallTime(void);                            // Get wall clock time (seconds), encoder could use multiple threads
+static Image GenImageBenchmark(int width, int height);      // Generate synthetic test image
+static double GetImagePSNR(Image reference, Image image, bool alpha);  // Get PSNR between two images (dB), first mipmap level
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    SetTraceLogLevel(LOG_WARNING);
+
+    Image source = { 0 };
+    if ((argc > 1) && FileExists(argv[1])) source = LoadImage(argv[1]);
+    else source = GenImageBenchmark(1023, 769);     // NOTE: Not multiple of 4 size, partial blocks included
+
+    if (source.data == NULL)
+    {
+        printf("Image could not be loaded\n");
+        return 1;
+    }
+
+    ImageFormat(&source, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    int iterations = (argc > 2)? atoi(argv[2]) : 3;
+    if (iterations < 1) iterations = 1;
+
+    const int formats[] = {
+        PIXELFORMAT_COMPRESSED_DXT1_RGB, PIXELFORMAT_COMPRESSED_DXT1_RGBA, PIXELFORMAT_COMPRESSED_DXT3_RGBA, PIXELFORMAT_COMPRESSED_DXT5_RGBA,
+        PIXELFORMAT_COMPRESSED_ETC1_RGB, PIXELFORMAT_COMPRESSED_ETC2_RGB, PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA
+    };
+    const char *formatNames[] = { "DXT1_RGB", "DXT1_RGBA", "DXT3_RGBA", "DXT5_RGBA", "ETC1_RGB", "ETC2_RGB", "ETC2_EAC_RGBA" };
+    const bool formatAlpha[] = { false, true, true, true, false, false, true };
+    const char *qualityNames[] = { "FAST", "DEFAULT", "HIGH" };
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    printf("Image: %ix%i, %i iterations (best time)\n\n", source.width, source.height, iterations);
+    printf("%-14s %-8s %10s %12s\n", "Format", "Quality", "PSNR (dB)", "MPixels/s");
+
+    for (int f = 0; f < (int)(sizeof(formats)/sizeof(formats[0])); f++)
+    {
+        for (int quality = COMPRESS_QUALITY_FAST; quality <= COMPRESS_QUALITY_HIGH; quality++)
+        {
+            double bestTime = 0.0;
+            double psnr = 0.0;
+
+            for (int i = 0; i < iterations; i++)
+            {
+                Image image = ImageCopy(source);
+
+                double startTime = GetWallTime();
+                ImageCompress(&image, formats[f], quality);
+                double time = GetWallTime() - startTime;
+
+                if ((i == 0) || (time < bestTime)) bestTime = time;
+
+                if (i == 0)
+                {
+                    // Decode compressed data back to RGBA to measure quality
+                    Image decoded = ImageCopy(image);
+                    ImageFormat(&decoded, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+                    psnr = GetImagePSNR(source, decoded, formatAlpha[f]);
+                    UnloadImage(decoded);
+                }
+
+                UnloadImage(image);
+            }
+
+            printf("%-14s %-8s %10.2f %12.2f\n", formatNames[f], qualityNames[quality], psnr,
+                (double)source.width*source.height/1000000.0/((bestTime > 0.0)? bestTime : 1e-9));
+        }
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadImage(source);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Get wall clock time (seconds)
+static double GetWallTime(void)
+{
+    struct timespec time = { 0 };
+    timespec_get(&time, TIME_UTC);
+
+    return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+}
+
+// Generate synthetic test image: smooth gradients, noise, hard edges and alpha variations
+static Image GenImageBenchmark(int width, int height)
+{
+    Image image = GenImageGradientRadial(width, height, 0.1f, (Color){ 230, 180, 60, 255 }, (Color){ 20, 60, 140, 255 });
+    Image noise = GenImagePerlinNoise(width/2, height/2, 0, 0, 4.0f);
+
+    ImageColorTint(&noise, (Color){ 255, 255, 255, 110 });
+    ImageDraw(&image, noise, (Rectangle){ 0, 0, (float)noise.width, (float)noise.height }, (Rectangle){ 0, 0, (float)noise.width, (float)noise.height }, WHITE);
+    UnloadImage(noise);
+
+    for (int i = 0; i < 24; i++)
+    {
+        ImageDrawRectangle(&image, (i*97)%width, (i*61)%height, 40 + i*3, 24 + i*2, (Color){ (unsigned char)(i*37), (unsigned char)(255 - i*9), (unsigned char)(i*71), (unsigned char)(128 + i*5) });
+        ImageDrawCircle(&image, (i*151)%width, (i*89)%height, 10 + i, (Color){ (unsigned char)(255 - i*11), (unsigned char)(i*23), 200, 255 });
+    }
+
+    ImageDrawLine(&image, 0, 0, width - 1, height - 1, BLACK);
+
+    return image;
+}
+
+// Get PSNR between two images (dB), RGB channels and optionally alpha
+static double GetImagePSNR(Image reference, Image image, bool alpha)
+{
+    const unsigned char *a = (const unsigned char *)reference.data;
+    const unsigned char *b = (const unsigned char *)image.data;
+    int channels = alpha? 4 : 3;
+    double error = 0.0;
+
+    for (int i = 0; i < reference.width*reference.height; i++)
+    {
+        for (int c = 0; c < channels; c++)
+        {
+            double difference = (double)a[i*4 + c] - (double)b[i*4 + c];
+            error += difference*difference;
+        }
+    }
+
+    error /= (double)reference.width*reference.height*channels;
+
+    return (error > 0.0)? 10.0*log10(255.0*255.0/error) : 99.0;
+}
@@ -0,0 +1,298 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - convolution benchmark
+*
+*   Console program, measures ImageKernelConvolution() against a reference direct 2D convolution
+*   (the previous implementation, one kernel sample per pixel and channel) for several kernels,
+*   reports timings and maximum channel difference, no window is required
+*
+*   NOTE: Alpha channel is not clamped by ImageKernelConvolution(), zero-sum kernels (edge detection)
+*   produce out of range alpha values, so alpha difference is reported separately from color channels
+*
+*   Usage: textures_convolution_benchmark [image file] [iterations]
+*   If no image is provided, a synthetic image (gradients, noise and hard edges) is used
+*
+*   NOTE: Reference convolution runs on a single thread, ImageKernelConvolution() could use
+*   multiple threads, single thread results can be measured building raylib without SUPPORT_THREADS
+*
+*   Build (not included in examples build files, run from this directory once libraylib.a is built in ../../src):
+*       gcc textures_convolution_benchmark.c -std=c11 -O2 -I../../src -L../../src -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -o textures_convolution_benchmark
+*   NOTE: C11 is required for timespec_get(), system libraries listed are the Linux desktop ones
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi(), abs()
+#include <math.h>               // Required for: expf()
+#include <time.h>               // Required for: timespec_get() [C11]
+
+#define MAX_KERNEL_WIDTH    31
+
+// Benchmark kernel
+typedef struct BenchmarkKernel {
+    const char *name;
+    int width;
+    float values[MAX_KERNEL_WIDTH*MAX_KERNEL_WIDTH];
+} BenchmarkKernel;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static double GetWallTime(void);                            // Get wall clock time (seconds), convolution could use multiple threads
+static Image GenImageBenchmark(int width, int height);      // Generate synthetic test image
+static void GenKernelGaussian(BenchmarkKernel *kernel, const char *name, int width, float sigma);   // Generate gaussian kernel (separable)
+static void GenKernelBox(BenchmarkKernel *kernel, const char *name, int width);                     // Generate box kernel
+static void ImageKernelConvolutionReference(Image *image, const float *kernel, int kernelSize);    // Reference direct 2D convolution
+static int GetImageMaxDifference(Image a, Image b, int firstChannel, int channels);   // Get maximum channel difference between two RGBA images
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    SetTraceLogLevel(LOG_WARNING);
+
+    Image source = { 0 };
+    if ((argc > 1) && FileExists(argv[1])) source = LoadImage(argv[1]);
+    else source = GenImageBenchmark(1024, 768);
+
+    if (source.data == NULL)
+    {
+        printf("Image could not be loaded\n");
+        return 1;
+    }
+
+    ImageFormat(&source, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    int iterations = (argc > 2)? atoi(argv[2]) : 3;
+    if (iterations < 1) iterations = 1;
+
+    static BenchmarkKernel kernels[7] = {
+        { "Sharpen 3x3", 3, { 0.0f, -1.0f, 0.0f, -1.0f, 5.0f, -1.0f, 0.0f, -1.0f, 0.0f } },
+        { "Sobel 3x3", 3, { -1.0f, 0.0f, 1.0f, -2.0f, 0.0f, 2.0f, -1.0f, 0.0f, 1.0f } },
+        { "Emboss 3x3", 3, { -2.0f, -1.0f, 0.0f, -1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f } },
+    };
+
+    GenKernelBox(&kernels[3], "Box 3x3", 3);
+    GenKernelGaussian(&kernels[4], "Gaussian 5x5", 5, 1.0f);
+    GenKernelBox(&kernels[5], "Box 31x31", 31);
+    GenKernelGaussian(&kernels[6], "Gaussian 31x31", 31, 5.0f);
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    printf("Image: %ix%i, %i iterations (best time)\n\n", source.width, source.height, iterations);
+    printf("%-16s %14s %14s %10s %14s %12s\n", "Kernel", "Reference (ms)", "Current (ms)", "Speedup", "Max diff RGB", "Max diff A");
+
+    for (int k = 0; k < (int)(sizeof(kernels)/sizeof(kernels[0])); k++)
+    {
+        int kernelSize = kernels[k].width*kernels[k].width;
+        double referenceTime = 0.0;
+        double currentTime = 0.0;
+        int maxDifference = 0;
+        int maxDifferenceAlpha = 0;
+
+        for (int i = 0; i < iterations; i++)
+        {
+            Image reference = ImageCopy(source);
+            Image current = ImageCopy(source);
+
+            double startTime = GetWallTime();
+            ImageKernelConvolutionReference(&reference, kernels[k].values, kernelSize);
+            double time = GetWallTime() - startTime;
+
+            if ((i == 0) || (time < referenceTime)) referenceTime = time;
+
+            startTime = GetWallTime();
+            ImageKernelConvolution(&current, kernels[k].values, kernelSize);
+            time = GetWallTime() - startTime;
+
+            if ((i == 0) || (time < currentTime)) currentTime = time;
+
+            if (i == 0)
+            {
+                maxDifference = GetImageMaxDifference(reference, current, 0, 3);
+                maxDifferenceAlpha = GetImageMaxDifference(reference, current, 3, 1);
+            }
+
+            UnloadImage(reference);
+            UnloadImage(current);
+        }
+
+        printf("%-16s %14.2f %14.2f %9.1fx %14i %12i\n", kernels[k].name, referenceTime*1000.0, currentTime*1000.0,
+            referenceTime/((currentTime > 0.0)? currentTime : 1e-9), maxDifference, maxDifferenceAlpha);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadImage(source);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Get wall clock time (seconds)
+static double GetWallTime(void)
+{
+    struct timespec time = { 0 };
+    timespec_get(&time, TIME_UTC);
+
+    return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+}
+
+// Generate synthetic test image: smooth gradients, noise, hard edges and alpha variations
+static Image GenImageBenchmark(int width, int height)
+{
+    Image image = GenImageGradientRadial(width, height, 0.1f, (Color){ 230, 180, 60, 255 }, (Color){ 20, 60, 140, 255 });
+    Image noise = GenImagePerlinNoise(width/2, height/2, 0, 0, 4.0f);
+
+    ImageColorTint(&noise, (Color){ 255, 255, 255, 110 });
+    ImageDraw(&image, noise, (Rectangle){ 0, 0, (float)noise.width, (float)noise.height }, (Rectangle){ 0, 0, (float)noise.width, (float)noise.height }, WHITE);
+    UnloadImage(noise);
+
+    for (int i = 0; i < 24; i++)
+    {
+        ImageDrawRectangle(&image, (i*97)%width, (i*61)%height, 40 + i*3, 24 + i*2, (Color){ (unsigned char)(i*37), (unsigned char)(255 - i*9), (unsigned char)(i*71), (unsigned char)(128 + i*5) });
+        ImageDrawCircle(&image, (i*151)%width, (i*89)%height, 10 + i, (Color){ (unsigned char)(255 - i*11), (unsigned char)(i*23), 200, 255 });
+    }
+
+    ImageDrawLine(&image, 0, 0, width - 1, height - 1, BLACK);
+
+    return image;
+}
+
+// Generate gaussian kernel, normalized to sum 1
+static void GenKernelGaussian(BenchmarkKernel *kernel, const char *name, int width, float sigma)
+{
+    float weights[MAX_KERNEL_WIDTH] = { 0 };
+    float sum = 0.0f;
+
+    for (int i = 0; i < width; i++)
+    {
+        float x = (float)(i - width/2);
+        weights[i] = expf(-x*x/(2.0f*sigma*sigma));
+        sum += weights[i];
+    }
+
+    for (int y = 0; y < width; y++)
+    {
+        for (int x = 0; x < width; x++) kernel->values[y*width + x] = weights[y]*weights[x]/(sum*sum);
+    }
+
+    kernel->name = name;
+    kernel->width = width;
+}
+
+// Generate box kernel, normalized to sum 1
+static void GenKernelBox(BenchmarkKernel *kernel, const char *name, int width)
+{
+    for (int i = 0; i < width*width; i++) kernel->values[i] = 1.0f/(float)(width*width);
+
+    kernel->name = name;
+    kernel->width = width;
+}
+
+// Reference direct 2D convolution, previous ImageKernelConvolution() implementation (single thread)
+// NOTE: Image pixels are addressed linearly (width*row + column), samples out of image data are considered zero,
+// kernel weighted samples are accumulated in kernel order, color channels are clamped to [0..1], alpha is not
+static void ImageKernelConvolutionReference(Image *image, const float *kernel, int kernelSize)
+{
+    int kernelWidth = 1;
+    while ((kernelWidth*kernelWidth) < kernelSize) kernelWidth++;
+
+    int width = image->width;
+    int height = image->height;
+    int startRange = -kernelWidth/2;
+    int endRange = (kernelWidth%2 == 0)? kernelWidth/2 : kernelWidth/2 + 1;
+
+    Color *pixels = (Color *)image->data;
+    Vector4 *output = (Vector4 *)MemAlloc(width*height*sizeof(Vector4));
+    Vector4 *temp = (Vector4 *)MemAlloc(kernelSize*sizeof(Vector4));
+
+    for (int x = 0; x < height; x++)
+    {
+        for (int y = 0; y < width; y++)
+        {
+            for (int xk = startRange; xk < endRange; xk++)
+            {
+                for (int yk = startRange; yk < endRange; yk++)
+                {
+                    int k = kernelWidth*(xk + kernelWidth/2) + (yk + kernelWidth/2);
+                    unsigned int index = width*(x + xk) + (y + yk);
+
+                    if (index >= (unsigned int)(width*height)) temp[k] = (Vector4){ 0 };
+                    else
+                    {
+                        temp[k].x = ((float)pixels[index].r)/255.0f*kernel[k];
+                        temp[k].y = ((float)pixels[index].g)/255.0f*kernel[k];
+                        temp[k].z = ((float)pixels[index].b)/255.0f*kernel[k];
+                        temp[k].w = ((float)pixels[index].a)/255.0f*kernel[k];
+                    }
+                }
+            }
+
+            Vector4 result = { 0 };
+
+            for (int i = 0; i < kernelSize; i++)
+            {
+                result.x += temp[i].x;
+                result.y += temp[i].y;
+                result.z += temp[i].z;
+                result.w += temp[i].w;
+            }
+
+            if (result.x < 0.0f) result.x = 0.0f;
+            if (result.y < 0.0f) result.y = 0.0f;
+            if (result.z < 0.0f) result.z = 0.0f;
+
+            if (result.x > 1.0f) result.x = 1.0f;
+            if (result.y > 1.0f) result.y = 1.0f;
+            if (result.z > 1.0f) result.z = 1.0f;
+
+            output[width*x + y] = result;
+        }
+    }
+
+    for (int i = 0; i < width*height; i++)
+    {
+        pixels[i].r = (unsigned char)(output[i].x*255.0f);
+        pixels[i].g = (unsigned char)(output[i].y*255.0f);
+        pixels[i].b = (unsigned char)(output[i].z*255.0f);
+        pixels[i].a = (unsigned char)(output[i].w*255.0f);
+    }
+
+    MemFree(temp);
+    MemFree(output);
+}
+
+// Get maximum channel difference between two RGBA images, for the requested channels range
+static int GetImageMaxDifference(Image a, Image b, int firstChannel, int channels)
+{
+    const unsigned char *dataA = (const unsigned char *)a.data;
+    const unsigned char *dataB = (const unsigned char *)b.data;
+    int maxDifference = 0;
+
+    for (int i = 0; i < a.width*a.height; i++)
+    {
+        for (int c = firstChannel; c < (firstChannel + channels); c++)
+        {
+            int difference = abs((int)dataA[i*4 + c] - (int)dataB[i*4 + c]);
+            if (difference > maxDifference) maxDifference = difference;
+        }
+    }
+
+    return maxDifference;
+}
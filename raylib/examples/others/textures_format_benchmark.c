@@ -0,0 +1,155 @@
+/*******************************************************************************************
+*
+*   raylib [textures] example - format conversion benchmark
+*
+*   Console program, measures ImageFormat() throughput (MPixels/s and GB/s) for every pair
+*   of uncompressed pixel formats, no window is required
+*
+*   Usage: textures_format_benchmark [width] [height] [iterations]
+*   Bandwidth accounts for source read plus destination write, to compare against memcpy
+*
+*   Build (not included in examples build files, run from this directory once libraylib.a is built in ../../src):
+*       gcc textures_format_benchmark.c -std=c11 -O2 -I../../src -L../../src -lraylib -lGL -lm -lpthread -ldl -lrt -lX11 -o textures_format_benchmark
+*   NOTE: C11 is required for timespec_get(), system libraries listed are the Linux desktop ones
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 raylib contributors
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi()
+#include <string.h>             // Required for: memcpy()
+#include <time.h>               // Required for: timespec_get() [C11]
+
+#define FORMAT_COUNT    13      // Uncompressed pixel formats, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE to PIXELFORMAT_UNCOMPRESSED_R16G16B16A16
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static double GetWallTime(void);                            // Get wall clock time (seconds), conversions could use multiple threads
+static double GetMemcpyTime(int size, int iterations);      // Get best memcpy() time for a buffer size, bandwidth reference
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    SetTraceLogLevel(LOG_WARNING);
+
+    int width = (argc > 1)? atoi(argv[1]) : 2048;
+    int height = (argc > 2)? atoi(argv[2]) : 2048;
+    int iterations = (argc > 3)? atoi(argv[3]) : 5;
+
+    if ((width < 1) || (height < 1))
+    {
+        printf("Invalid image size\n");
+        return 1;
+    }
+
+    if (iterations < 1) iterations = 1;
+
+    const char *formatNames[FORMAT_COUNT] = {
+        "GRAYSCALE", "GRAY_ALPHA", "R5G6B5", "R8G8B8", "R5G5B5A1", "R4G4B4A4", "R8G8B8A8",
+        "R32", "R32G32B32", "R32G32B32A32", "R16", "R16G16B16", "R16G16B16A16"
+    };
+
+    // Source image with gradients and alpha variations, every source format is generated from it
+    Image base = GenImageGradientLinear(width, height, 45, (Color){ 230, 41, 55, 255 }, (Color){ 0, 121, 241, 64 });
+    Image sources[FORMAT_COUNT] = { 0 };
+
+    for (int f = 0; f < FORMAT_COUNT; f++)
+    {
+        sources[f] = ImageCopy(base);
+        ImageFormat(&sources[f], PIXELFORMAT_UNCOMPRESSED_GRAYSCALE + f);
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Benchmark
+    //--------------------------------------------------------------------------------------
+    double memcpyTime = GetMemcpyTime(width*height*4, iterations);
+
+    printf("Image: %ix%i, %i iterations (best time)\n", width, height, iterations);
+    printf("memcpy() reference (4 bytes per pixel): %.2f GB/s\n\n", 2.0*width*height*4/1e9/((memcpyTime > 0.0)? memcpyTime : 1e-9));
+    printf("%-14s %-14s %12s %10s\n", "Source", "Destination", "MPixels/s", "GB/s");
+
+    for (int src = 0; src < FORMAT_COUNT; src++)
+    {
+        for (int dst = 0; dst < FORMAT_COUNT; dst++)
+        {
+            if (src == dst) continue;
+
+            double bestTime = 0.0;
+
+            for (int i = 0; i < iterations; i++)
+            {
+                Image image = ImageCopy(sources[src]);
+
+                double startTime = GetWallTime();
+                ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE + dst);
+                double time = GetWallTime() - startTime;
+
+                if ((i == 0) || (time < bestTime)) bestTime = time;
+
+                UnloadImage(image);
+            }
+
+            if (bestTime <= 0.0) bestTime = 1e-9;
+
+            int bytes = GetPixelDataSize(width, height, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE + src) +
+                        GetPixelDataSize(width, height, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE + dst);
+
+            printf("%-14s %-14s %12.2f %10.2f\n", formatNames[src], formatNames[dst],
+                (double)width*height/1000000.0/bestTime, (double)bytes/1e9/bestTime);
+        }
+    }
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int f = 0; f < FORMAT_COUNT; f++) UnloadImage(sources[f]);
+    UnloadImage(base);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Get wall clock time (seconds)
+static double GetWallTime(void)
+{
+    struct timespec time = { 0 };
+    timespec_get(&time, TIME_UTC);
+
+    return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+}
+
+// Get best memcpy() time for a buffer size
+static double GetMemcpyTime(int size, int iterations)
+{
+    unsigned char *src = (unsigned char *)MemAlloc(size);
+    unsigned char *dst = (unsigned char *)MemAlloc(size);
+    double bestTime = 0.0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        double startTime = GetWallTime();
+        memcpy(dst, src, size);
+        double time = GetWallTime() - startTime;
+
+        if ((i == 0) || (time < bestTime)) bestTime = time;
+    }
+
+    MemFree(src);
+    MemFree(dst);
+
+    return bestTime;
+}
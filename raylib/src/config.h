@@ -100,6 +100,18 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Enable multi-texture batching for default shader, up to RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS textures per draw call
+//#define RLGL_ENABLE_BATCH_MULTITEXTURE         1
+
+// Use compact vertex format for render batch: 16-bit normalized texcoords and half-float positions (OpenGL 3.3)
+// WARNING: Format is selected at compile time, out of range values can not fallback to full format:
+//  - Texcoords are clamped to [0..1] range, texture repeat/tiling coordinates (i.e. DrawTexturePro() with
+//    source rectangle bigger than texture) are not supported
+//  - Positions precision is lower than one unit beyond 2048 (i.e. large 2d camera targets, 3d worlds)
+// NOTE: Out of range values are reported once with a warning, useful for 2D-heavy scenes within screen space
+//#define RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS    1
+//#define RLGL_ENABLE_BATCH_HALF_POSITIONS       1
+
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
@@ -120,6 +132,7 @@
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 6 (multi-texture batching)
 
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
@@ -142,6 +155,11 @@
 // rshapes: Configuration values
 //------------------------------------------------------------------------------------
 #define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions
+#define SPLINE_SEGMENT_ERROR_RATE   0.25f       // Spline max distance between curve and its adaptive subdivision (world units, camera zoom not considered)
+#define SPLINE_SEGMENT_MAX_DIVISIONS   64       // Spline segment max adaptive subdivisions
+#define SPLINE_MITER_LIMIT           4.0f       // Spline strip joins max miter scale (join width to thickness ratio)
+#define SHAPES_ARC_CACHE_SIZE          32       // Number of unit arcs (circles, rings, rounded corners) kept in tessellation cache
+#define SHAPES_ARC_CACHE_MAX_SEGMENTS 128       // Maximum number of segments of a cached unit arc
 
 
 //------------------------------------------------------------------------------------
@@ -248,9 +266,13 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Support internal worker threads pool, used to split heavy data-parallel processing (i.e. image processing)
+// NOTE: On PLATFORM_WEB it requires compiling with pthreads support (-pthread), otherwise processing is serial
+#define SUPPORT_WORKER_THREADS          1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_WORKER_THREADS             16       // Max number of threads processing a job (including calling thread)
 
 #endif // CONFIG_H
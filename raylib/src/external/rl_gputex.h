@@ -66,7 +66,9 @@ RLAPI void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int
 RLAPI void *rl_load_pvr_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 RLAPI void *rl_load_astc_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips);
 
-RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
+// Save image data as files
+RLAPI int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps);  // Save image data as DDS file
+RLAPI int rl_save_ktx(const char *file_name, void *data, int width, int height, int format, int mipmaps);  // Save image data as KTX file
 
 #if defined(__cplusplus)
 }
@@ -97,6 +99,8 @@ RLAPI int rl_save_ktx_to_memory(const char *fileName, void *data, int width, int
 //----------------------------------------------------------------------------------
 // Get pixel data size in bytes for certain pixel format
 static int get_pixel_data_size(int width, int height, int format);
+// Get data size of mipmap levels available in file data, mipmaps count is reduced to available levels
+static int get_mipmaps_data_size(int width, int height, int format, int *mipmaps, unsigned int available);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -106,7 +110,6 @@ static int get_pixel_data_size(int width, int height, int format);
 void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_size, int *width, int *height, int *format, int *mips)
 {
     void *image_data = NULL;        // Image data pointer
-    int image_pixel_size = 0;       // Image pixel size
 
     unsigned char *file_data_ptr = (unsigned char *)file_data;
 
@@ -171,7 +174,6 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
 
             *width = header->width;
             *height = header->height;
-            image_pixel_size = header->width*header->height;
 
             if (header->mipmap_count == 0) *mips = 1;   // Parameter not used
             else *mips = header->mipmap_count;
@@ -180,7 +182,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
             {
                 if (header->ddspf.flags == 0x40)        // No alpha channel
                 {
-                    int data_size = image_pixel_size*sizeof(unsigned short);
+                    int data_size = get_mipmaps_data_size(*width, *height, PIXELFORMAT_UNCOMPRESSED_R5G6B5, mips, file_size - 0x80);
                     image_data = RL_MALLOC(data_size);
 
                     memcpy(image_data, file_data_ptr, data_size);
@@ -191,7 +193,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                 {
                     if (header->ddspf.a_bit_mask == 0x8000)     // 1bit alpha
                     {
-                        int data_size = image_pixel_size*sizeof(unsigned short);
+                        int data_size = get_mipmaps_data_size(*width, *height, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, mips, file_size - 0x80);
                         image_data = RL_MALLOC(data_size);
 
                         memcpy(image_data, file_data_ptr, data_size);
@@ -199,7 +201,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                         unsigned char alpha = 0;
 
                         // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
-                        for (int i = 0; i < image_pixel_size; i++)
+                        for (int i = 0; i < data_size/2; i++)
                         {
                             alpha = ((unsigned short *)image_data)[i] >> 15;
                             ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 1;
@@ -210,7 +212,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                     }
                     else if (header->ddspf.a_bit_mask == 0xf000)   // 4bit alpha
                     {
-                        int data_size = image_pixel_size*sizeof(unsigned short);
+                        int data_size = get_mipmaps_data_size(*width, *height, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, mips, file_size - 0x80);
                         image_data = RL_MALLOC(data_size);
 
                         memcpy(image_data, file_data_ptr, data_size);
@@ -218,7 +220,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                         unsigned char alpha = 0;
 
                         // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
-                        for (int i = 0; i < image_pixel_size; i++)
+                        for (int i = 0; i < data_size/2; i++)
                         {
                             alpha = ((unsigned short *)image_data)[i] >> 12;
                             ((unsigned short *)image_data)[i] = ((unsigned short *)image_data)[i] << 4;
@@ -231,16 +233,24 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
             }
             else if (header->ddspf.flags == 0x40 && header->ddspf.rgb_bit_count == 24)   // DDS_RGB, no compressed
             {
-                int data_size = image_pixel_size*3*sizeof(unsigned char);
+                int data_size = get_mipmaps_data_size(*width, *height, PIXELFORMAT_UNCOMPRESSED_R8G8B8, mips, file_size - 0x80);
                 image_data = RL_MALLOC(data_size);
 
                 memcpy(image_data, file_data_ptr, data_size);
 
+                // NOTE: Data comes as B8G8R8, it must be reordered to R8G8B8
+                for (int i = 0; i < data_size - 2; i += 3)
+                {
+                    unsigned char blue = ((unsigned char *)image_data)[i];
+                    ((unsigned char *)image_data)[i] = ((unsigned char *)image_data)[i + 2];
+                    ((unsigned char *)image_data)[i + 2] = blue;
+                }
+
                 *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
             }
             else if (header->ddspf.flags == 0x41 && header->ddspf.rgb_bit_count == 32) // DDS_RGBA, no compressed
             {
-                int data_size = image_pixel_size*4*sizeof(unsigned char);
+                int data_size = get_mipmaps_data_size(*width, *height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, mips, file_size - 0x80);
                 image_data = RL_MALLOC(data_size);
 
                 memcpy(image_data, file_data_ptr, data_size);
@@ -250,7 +260,7 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                 // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
                 // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
                 // So, we must realign B8G8R8A8 to R8G8B8A8
-                for (int i = 0; i < image_pixel_size*4; i += 4)
+                for (int i = 0; i < data_size; i += 4)
                 {
                     blue = ((unsigned char *)image_data)[i];
                     ((unsigned char *)image_data)[i] = ((unsigned char *)image_data)[i + 2];
@@ -261,14 +271,6 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
             }
             else if (((header->ddspf.flags == 0x04) || (header->ddspf.flags == 0x05)) && (header->ddspf.fourcc > 0)) // Compressed
             {
-                // NOTE: This forces only 1 mipmap to be loaded which is not really correct but it works
-                int data_size = (header->pitch_or_linear_size < file_size - 0x80) ? header->pitch_or_linear_size : file_size - 0x80;
-                *mips = 1;
-
-                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
-
-                memcpy(image_data, file_data_ptr, data_size);
-
                 switch (header->ddspf.fourcc)
                 {
                     case FOURCC_DXT1:
@@ -280,12 +282,146 @@ void *rl_load_dds_from_memory(const unsigned char *file_data, unsigned int file_
                     case FOURCC_DXT5: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
                     default: break;
                 }
+
+                // NOTE: Mipmap levels are loaded while available in file data
+                int data_size = get_mipmaps_data_size(*width, *height, *format, mips, file_size - 0x80);
+
+                image_data = RL_MALLOC(data_size*sizeof(unsigned char));
+
+                memcpy(image_data, file_data_ptr, data_size);
             }
         }
     }
 
     return image_data;
 }
+
+// Save image data as DDS file
+// NOTE: Supported formats: DXT1, DXT3, DXT5 and R8G8B8, R8G8B8A8 (stored as B8G8R8, B8G8R8A8), mipmaps included
+int rl_save_dds(const char *file_name, void *data, int width, int height, int format, int mipmaps)
+{
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourcc;
+        unsigned int rgb_bit_count;
+        unsigned int r_bit_mask;
+        unsigned int g_bit_mask;
+        unsigned int b_bit_mask;
+        unsigned int a_bit_mask;
+    } dds_pixel_format;
+
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitch_or_linear_size;
+        unsigned int depth;
+        unsigned int mipmap_count;
+        unsigned int reserved1[11];
+        dds_pixel_format ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } dds_header;
+
+    dds_header header = { 0 };
+    int bpp = 0;        // Bits per pixel (uncompressed formats)
+
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.ddspf.fourcc = FOURCC_DXT1; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.ddspf.fourcc = FOURCC_DXT3; break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.ddspf.fourcc = FOURCC_DXT5; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        default: break;
+    }
+
+    if ((header.ddspf.fourcc == 0) && (bpp == 0))
+    {
+        LOG("WARNING: IMAGE: Pixel format not supported for DDS export (%i)", format);
+        return false;
+    }
+
+    if (mipmaps < 1) mipmaps = 1;
+
+    int data_size = 0;
+    for (int i = 0, w = width, h = height; i < mipmaps; i++)
+    {
+        data_size += get_pixel_data_size(w, h, format);
+        w = (w > 1)? w/2 : 1;
+        h = (h > 1)? h/2 : 1;
+    }
+
+    // Header flags: caps, height, width, pixel format (required), plus linear size or pitch and mipmaps count
+    header.size = 124;
+    header.flags = 0x1 | 0x2 | 0x4 | 0x1000 | ((bpp == 0)? 0x80000 : 0x8) | ((mipmaps > 1)? 0x20000 : 0);
+    header.height = height;
+    header.width = width;
+    header.pitch_or_linear_size = (bpp == 0)? get_pixel_data_size(width, height, format) : width*bpp/8;
+    header.mipmap_count = mipmaps;
+    header.ddspf.size = 32;
+    header.caps = 0x1000 | ((mipmaps > 1)? 0x400008 : 0);   // Texture, complex and mipmap caps
+
+    if (bpp == 0) header.ddspf.flags = (format == PIXELFORMAT_COMPRESSED_DXT1_RGBA)? 0x05 : 0x04;
+    else
+    {
+        header.ddspf.flags = (bpp == 32)? 0x41 : 0x40;
+        header.ddspf.rgb_bit_count = bpp;
+        header.ddspf.r_bit_mask = 0x00ff0000;
+        header.ddspf.g_bit_mask = 0x0000ff00;
+        header.ddspf.b_bit_mask = 0x000000ff;
+        header.ddspf.a_bit_mask = (bpp == 32)? 0xff000000 : 0;
+    }
+
+    int file_size = 4 + sizeof(dds_header) + data_size;
+    unsigned char *file_data = (unsigned char *)RL_CALLOC(file_size, 1);
+
+    memcpy(file_data, "DDS ", 4);
+    memcpy(file_data + 4, &header, sizeof(dds_header));
+    memcpy(file_data + 4 + sizeof(dds_header), data, data_size);
+
+    // NOTE: Uncompressed data is stored with BGR(A) bytes order
+    if (bpp > 0)
+    {
+        unsigned char *pixels = file_data + 4 + sizeof(dds_header);
+
+        for (int i = 0; i < data_size - 2; i += bpp/8)
+        {
+            unsigned char red = pixels[i];
+            pixels[i] = pixels[i + 2];
+            pixels[i + 2] = red;
+        }
+    }
+
+    // Save file data to file
+    int success = false;
+    FILE *file = fopen(file_name, "wb");
+
+    if (file != NULL)
+    {
+        unsigned int count = (unsigned int)fwrite(file_data, sizeof(unsigned char), file_size, file);
+
+        if (count == 0) LOG("WARNING: FILEIO: [%s] Failed to write file", file_name);
+        else if (count != (unsigned int)file_size) LOG("WARNING: FILEIO: [%s] File partially written", file_name);
+        else LOG("INFO: FILEIO: [%s] File saved successfully", file_name);
+
+        int result = fclose(file);
+        if ((result == 0) && (count == (unsigned int)file_size)) success = true;
+    }
+    else LOG("WARNING: FILEIO: [%s] Failed to open file", file_name);
+
+    RL_FREE(file_data);
+
+    return success;
+}
 #endif
 
 #if defined(RL_GPUTEX_SUPPORT_PKM)
@@ -377,11 +513,23 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
     // Required extensions:
     // GL_OES_compressed_ETC1_RGB8_texture  (ETC1)
     // GL_ARB_ES3_compatibility  (ETC2/EAC)
+    // GL_EXT_texture_compression_s3tc  (DXT)
 
     // Supported tokens (defined by extensions)
-    // GL_ETC1_RGB8_OES                 0x8D64
-    // GL_COMPRESSED_RGB8_ETC2          0x9274
-    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+    // GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
+    // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
+    // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
+    // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
+    // GL_ETC1_RGB8_OES                     0x8D64
+    // GL_COMPRESSED_RGB8_ETC2              0x9274
+    // GL_COMPRESSED_RGBA8_ETC2_EAC         0x9278
+    // GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG   0x8C00
+    // GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG  0x8C02
+    // GL_COMPRESSED_RGBA_ASTC_4x4_KHR      0x93B0
+    // GL_COMPRESSED_RGBA_ASTC_8x8_KHR      0x93B7
+
+    // Uncompressed data is identified by glFormat and glType, base formats (OpenGL ES 2.0: GL_LUMINANCE...)
+    // and sized formats (OpenGL 3.3: GL_RED, GL_RG...) are both supported, as saved by rl_save_ktx()
 
     // KTX file Header (64 bytes)
     // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
@@ -423,22 +571,123 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
             *width = header->width;
             *height = header->height;
-            *mips = header->mipmap_levels;
+            *mips = 0;
 
             file_data_ptr += header->key_value_data_size; // Skip value data size
 
-            int data_size = ((int *)file_data_ptr)[0];
-            file_data_ptr += sizeof(int);
+            *format = 0;
+
+            if (header->gl_type == 0)
+            {
+                switch (header->gl_internal_format)
+                {
+                    case 0x83F0: *format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+                    case 0x83F1: *format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
+                    case 0x83F2: *format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+                    case 0x83F3: *format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+                    case 0x8D64: *format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
+                    case 0x9274: *format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+                    case 0x9278: *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
+                    case 0x8C00: *format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
+                    case 0x8C02: *format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
+                    case 0x93B0: *format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
+                    case 0x93B7: *format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
+                    default: break;
+                }
+            }
+            else
+            {
+                unsigned int type = header->gl_type;
+                int half = (type == 0x140B) || (type == 0x8D61);       // GL_HALF_FLOAT, GL_HALF_FLOAT_OES
+
+                switch (header->gl_format)
+                {
+                    case 0x1903:    // GL_RED
+                    case 0x1909:    // GL_LUMINANCE
+                    {
+                        if (type == 0x1401) *format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+                        else if (type == 0x1406) *format = PIXELFORMAT_UNCOMPRESSED_R32;
+                        else if (half) *format = PIXELFORMAT_UNCOMPRESSED_R16;
+                    } break;
+                    case 0x8227:    // GL_RG
+                    case 0x190A:    // GL_LUMINANCE_ALPHA
+                    {
+                        if (type == 0x1401) *format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+                    } break;
+                    case 0x1907:    // GL_RGB
+                    {
+                        if (type == 0x1401) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+                        else if (type == 0x8363) *format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                        else if (type == 0x1406) *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32;
+                        else if (half) *format = PIXELFORMAT_UNCOMPRESSED_R16G16B16;
+                    } break;
+                    case 0x1908:    // GL_RGBA
+                    {
+                        if (type == 0x1401) *format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                        else if (type == 0x8034) *format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+                        else if (type == 0x8033) *format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+                        else if (type == 0x1406) *format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+                        else if (half) *format = PIXELFORMAT_UNCOMPRESSED_R16G16B16A16;
+                    } break;
+                    default: break;
+                }
+            }
+
+            if (*format == 0)
+            {
+                LOG("WARNING: IMAGE: KTX data format not supported (glInternalFormat: 0x%x, glFormat: 0x%x, glType: 0x%x)",
+                    header->gl_internal_format, header->gl_format, header->gl_type);
+                return NULL;
+            }
+
+            // NOTE: Every mipmap level data is preceded by its data size and padded to 4 bytes (mipPadding),
+            // uncompressed rows are 4 bytes aligned (GL_UNPACK_ALIGNMENT = 4), levels are loaded while
+            // available in file data, rows alignment is removed (files with unaligned rows are also accepted)
+            const unsigned char *file_data_end = file_data + file_size;
+            unsigned char *level_ptr = file_data_ptr;
+            int data_size = 0;
+
+            for (unsigned int i = 0, w = *width, h = *height; i < ((header->mipmap_levels > 0)? header->mipmap_levels : 1); i++)
+            {
+                if (level_ptr + sizeof(unsigned int) > file_data_end) break;
+
+                unsigned int level_size = ((unsigned int *)level_ptr)[0];
+                if (level_size > (unsigned int)(file_data_end - level_ptr - sizeof(unsigned int))) break;
+                if (level_size < (unsigned int)get_pixel_data_size(w, h, *format)) break;
+
+                data_size += get_pixel_data_size(w, h, *format);
+                level_ptr += sizeof(unsigned int) + ((level_size + 3) & ~3u);
+                *mips += 1;
+
+                w = (w > 1)? w/2 : 1;
+                h = (h > 1)? h/2 : 1;
+            }
 
             image_data = RL_MALLOC(data_size*sizeof(unsigned char));
 
-            memcpy(image_data, file_data_ptr, data_size);
+            for (int i = 0, offset = 0, w = *width, h = *height; i < *mips; i++)
+            {
+                unsigned int level_size = ((unsigned int *)file_data_ptr)[0];
+                int size = get_pixel_data_size(w, h, *format);
+                int row_size = get_pixel_data_size(w, 1, *format);
+                int aligned_row_size = (row_size + 3) & ~3;
 
-            if (header->gl_internal_format == 0x8D64) *format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
-            else if (header->gl_internal_format == 0x9274) *format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
-            else if (header->gl_internal_format == 0x9278) *format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+                // Compressed data and rows already aligned are copied as is
+                if ((*format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (level_size < (unsigned int)(aligned_row_size*h)) || (row_size == aligned_row_size))
+                {
+                    memcpy((unsigned char *)image_data + offset, file_data_ptr + sizeof(unsigned int), size);
+                }
+                else
+                {
+                    for (int y = 0; y < h; y++) memcpy((unsigned char *)image_data + offset + y*row_size, file_data_ptr + sizeof(unsigned int) + y*aligned_row_size, row_size);
+                }
 
-            // TODO: Support uncompressed data formats? Right now it returns format = 0!
+                offset += size;
+                file_data_ptr += sizeof(unsigned int) + ((level_size + 3) & ~3u);
+
+                w = (w > 1)? w/2 : 1;
+                h = (h > 1)? h/2 : 1;
+            }
         }
     }
 
@@ -473,12 +722,18 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     } ktx_header;
 
     // Calculate file data_size required
+    // NOTE: Every mipmap level data is preceded by its data size and padded to 4 bytes (mipPadding),
+    // uncompressed rows are 4 bytes aligned (GL_UNPACK_ALIGNMENT = 4)
+    int compressed = (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB);
     int data_size = sizeof(ktx_header);
 
     for (int i = 0, w = width, h = height; i < mipmaps; i++)
     {
-        data_size += get_pixel_data_size(w, h, format);
-        w /= 2; h /= 2;
+        int level_size = compressed? get_pixel_data_size(w, h, format) : ((get_pixel_data_size(w, 1, format) + 3) & ~3)*h;
+
+        data_size += 4 + ((level_size + 3) & ~3);
+        w = (w > 1)? w/2 : 1;
+        h = (h > 1)? h/2 : 1;
     }
 
     unsigned char *file_data = RL_CALLOC(data_size, 1);
@@ -494,7 +749,7 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
     // Get the image header
     memcpy(header.id, ktx_identifier, 12);  // KTX 1.1 signature
-    header.endianness = 0;
+    header.endianness = 0x04030201;         // Written in file as 0x01 0x02 0x03 0x04 (little endian)
     header.gl_type = 0;                     // Obtained from format
     header.gl_type_size = 1;
     header.gl_format = 0;                   // Obtained from format
@@ -508,12 +763,40 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     header.mipmap_levels = mipmaps;         // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
     header.key_value_data_size = 0;         // No extra data after the header
 
-    rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type);   // rlgl module function
-    header.gl_base_internal_format = header.gl_format;    // KTX 1.1 only
+    // NOTE: Compressed formats are not checked against current GPU support, file can be used on other platforms
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: header.gl_internal_format = 0x83F0; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.gl_internal_format = 0x83F1; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.gl_internal_format = 0x83F2; break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.gl_internal_format = 0x83F3; break;
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB: header.gl_internal_format = 0x8D64; break;
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: header.gl_internal_format = 0x9274; break;
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: header.gl_internal_format = 0x9278; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: header.gl_internal_format = 0x93B0; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: header.gl_internal_format = 0x93B7; break;
+        default: rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type); break;   // rlgl module function
+    }
+
+    // Uncompressed data type size, required by readers for endianness conversion
+    if ((header.gl_type == 0x1406) || (header.gl_type == 0x1405)) header.gl_type_size = 4;
+    else if ((header.gl_type == 0x140B) || (header.gl_type == 0x8D61) || (header.gl_type == 0x8363) ||
+             (header.gl_type == 0x8033) || (header.gl_type == 0x8034)) header.gl_type_size = 2;
+
+    // KTX 1.1 only: compressed formats base internal format is GL_RGB or GL_RGBA
+    if (format < PIXELFORMAT_COMPRESSED_DXT1_RGB) header.gl_base_internal_format = header.gl_format;
+    else if ((format == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == PIXELFORMAT_COMPRESSED_ETC1_RGB) ||
+             (format == PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == PIXELFORMAT_COMPRESSED_PVRT_RGB)) header.gl_base_internal_format = 0x1907;
+    else header.gl_base_internal_format = 0x1908;
 
     // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
 
-    if (header.gl_format == -1) LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", header.gl_format);
+    if (header.gl_internal_format == 0)
+    {
+        LOG("WARNING: IMAGE: GL format not supported for KTX export (%i)", format);
+        RL_FREE(file_data);
+        return false;
+    }
     else
     {
         memcpy(file_data_ptr, &header, sizeof(ktx_header));
@@ -524,17 +807,28 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
         int data_offset = 0;
 
         // Save all mipmaps data
+        // NOTE: File data is zero initialized, rows and levels padding is already set
         for (int i = 0; i < mipmaps; i++)
         {
-            unsigned int data_size = get_pixel_data_size(temp_width, temp_height, format);
+            unsigned int size = get_pixel_data_size(temp_width, temp_height, format);
+            unsigned int level_size = size;
 
-            memcpy(file_data_ptr, &data_size, sizeof(unsigned int));
-            memcpy(file_data_ptr + 4, (unsigned char *)data + data_offset, data_size);
+            if (compressed) memcpy(file_data_ptr + 4, (unsigned char *)data + data_offset, size);
+            else
+            {
+                int row_size = get_pixel_data_size(temp_width, 1, format);
+                int aligned_row_size = (row_size + 3) & ~3;
 
-            temp_width /= 2;
-            temp_height /= 2;
-            data_offset += data_size;
-            file_data_ptr += (4 + data_size);
+                for (int y = 0; y < temp_height; y++) memcpy(file_data_ptr + 4 + y*aligned_row_size, (unsigned char *)data + data_offset + y*row_size, row_size);
+                level_size = aligned_row_size*temp_height;
+            }
+
+            memcpy(file_data_ptr, &level_size, sizeof(unsigned int));
+
+            temp_width = (temp_width > 1)? temp_width/2 : 1;
+            temp_height = (temp_height > 1)? temp_height/2 : 1;
+            data_offset += size;
+            file_data_ptr += (4 + ((level_size + 3) & ~3u));
         }
     }
 
@@ -786,6 +1080,9 @@ static int get_pixel_data_size(int width, int height, int format)
         case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
         case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
         case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
         case PIXELFORMAT_COMPRESSED_DXT1_RGB:
         case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
         case PIXELFORMAT_COMPRESSED_ETC1_RGB:
@@ -802,12 +1099,40 @@ static int get_pixel_data_size(int width, int height, int format)
 
     data_size = width*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    // Most compressed formats works on 4x4 blocks, partial blocks are stored complete
+    // NOTE: ASTC 8x8 works on 8x8 blocks (16 bytes), PVRT minimum size is 8x8 pixels
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) data_size = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if ((format == PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == PIXELFORMAT_COMPRESSED_PVRT_RGBA)) data_size = ((width < 8)? 8 : width)*((height < 8)? 8 : height)*bpp/8;
+    else if (format == PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) data_size = ((width + 3)/4)*((height + 3)/4)*16;
+    else if (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) data_size = ((width + 7)/8)*((height + 7)/8)*16;
+
+    return data_size;
+}
+
+// Get data size of mipmap levels available in file data, mipmaps count is reduced to available levels
+// NOTE: If first level is not complete, available data size is returned
+static int get_mipmaps_data_size(int width, int height, int format, int *mipmaps, unsigned int available)
+{
+    int data_size = 0;
+    int count = (*mipmaps > 0)? *mipmaps : 1;
+
+    *mipmaps = 1;
+
+    for (int i = 0; i < count; i++)
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) data_size = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) data_size = 16;
+        unsigned int level_size = get_pixel_data_size(width, height, format);
+
+        if ((data_size + level_size) > available)
+        {
+            if (i == 0) data_size = available;
+            break;
+        }
+
+        data_size += level_size;
+        *mipmaps = i + 1;
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
     }
 
     return data_size;
@@ -262,6 +262,26 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageView, direct access to a region of image pixels data (format resolved once)
+typedef struct ImageView {
+    void *data;             // Pixels data, pointing to first view pixel
+    int width;              // View width
+    int height;             // View height
+    int stride;             // Bytes between consecutive rows
+    int format;             // Data format (PixelFormat type)
+    int bytesPerPixel;      // Bytes per pixel
+} ImageView;
+
+// ImageAnim, animated image stream, frames are decoded on demand (only a few frames kept in memory)
+typedef struct ImageAnim {
+    Image image;            // Current frame image (R8G8B8A8), data owned by animation
+    int frameCount;         // Number of animation frames
+    int currentFrame;       // Current frame index
+    int *frameDelays;       // Frames delay (milliseconds)
+    float duration;         // Animation duration (seconds)
+    void *ctxData;          // Animation decoder context data (internal)
+} ImageAnim;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -524,6 +544,18 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Resource cache statistics
+typedef struct ResourceCacheStats {
+    unsigned int hits;              // Resources requests served from cache
+    unsigned int misses;            // Resources requests loaded from file
+    unsigned int reloads;           // Cached resources reloaded because file was modified
+    unsigned int evictions;         // Unreferenced resources unloaded to keep cache under budget
+    unsigned int entries;           // Resources currently cached (referenced or not)
+    unsigned int references;        // Resources references currently in use
+    unsigned int ramSize;           // RAM used by cached resources (bytes)
+    unsigned int vramSize;          // VRAM used by cached resources (bytes)
+} ResourceCacheStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -876,6 +908,28 @@ typedef enum {
     CUBEMAP_LAYOUT_PANORAMA                 // Layout is defined by a panorama image (equirrectangular map)
 } CubemapLayout;
 
+// Texture async loading request state
+typedef enum {
+    TEXTURE_ASYNC_NONE = 0,                 // Request not valid (or unloaded)
+    TEXTURE_ASYNC_LOADING,                  // Image file being loaded and decoded on loader thread
+    TEXTURE_ASYNC_UPLOADING,                // Image decoded, waiting for (or in the middle of) GPU upload
+    TEXTURE_ASYNC_READY,                    // Texture uploaded and ready to be used
+    TEXTURE_ASYNC_FAILED                    // Image file could not be loaded or uploaded
+} TextureAsyncState;
+
+// Image compression quality, encoder speed/quality trade-off
+typedef enum {
+    COMPRESS_QUALITY_FAST = 0,              // Endpoints from colors extents, no refinement
+    COMPRESS_QUALITY_DEFAULT,               // Endpoints refined by least squares and neighbour search
+    COMPRESS_QUALITY_HIGH                   // Wider endpoints search, slowest
+} CompressQuality;
+
+// Image mipmaps generation filter
+typedef enum {
+    MIPMAP_FILTER_BOX = 0,                  // Average of 2x2 pixels (area weighted for odd sizes)
+    MIPMAP_FILTER_KAISER                    // Kaiser windowed sinc, sharper mipmaps
+} MipmapFilter;
+
 // Font type, defines generation method
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
@@ -940,6 +994,7 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text); // FileIO: Save text data
+typedef void (*TextureAsyncCallback)(int request, Texture2D texture);   // Textures: Async texture request finished (texture.id = 0 on failure)
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -1080,6 +1135,7 @@ RLAPI void UnloadRandomSequence(int *sequence);                   // Unload rand
 
 // Misc. functions
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void SetGifRecordingConfig(int frameRate, float scale);    // Set GIF recording frames per second and size scale (LEFT_CONTROL + F12 recording)
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1090,6 +1146,10 @@ RLAPI void SetTraceLogLevel(int logLevel);                        // Set the cur
 RLAPI void *MemAlloc(unsigned int size);                          // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI void SetWorkerThreadCount(int count);                       // Set number of threads for internal data processing (0 = automatic, 1 = serial)
+RLAPI int GetWorkerThreadCount(void);                             // Get number of threads for internal data processing
+RLAPI void SetResourceCacheBudget(unsigned int ramSize, unsigned int vramSize); // Set resources cache memory budget, unreferenced resources evicted over it (bytes)
+RLAPI ResourceCacheStats GetResourceCacheStats(void);             // Get resources cache usage statistics
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advance users
@@ -1301,16 +1361,25 @@ RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);
 // Image loading functions
 // NOTE: These functions do not require GPU access
 RLAPI Image LoadImage(const char *fileName);                                                             // Load image from file into CPU memory (RAM)
+RLAPI Image LoadImageCached(const char *fileName);                                                       // Load image from file through resources cache (shared, must not be modified)
+RLAPI Image LoadImageResized(const char *fileName, int newWidth, int newHeight);                          // Load image from file downscaled to required size (PNG and QOI streamed, memory bounded)
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
 RLAPI Image LoadImageSvg(const char *fileNameOrString, int width, int height);                           // Load image from SVG file data or string with specified size
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
+RLAPI ImageAnim LoadImageAnimStream(const char *fileName);                                               // Load animated image stream from file (frames decoded on demand, delays kept)
+RLAPI ImageAnim LoadImageAnimStreamFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load animated image stream from memory buffer (data is copied)
+RLAPI bool IsImageAnimReady(ImageAnim anim);                                                             // Check if an animated image stream is ready
+RLAPI void UnloadImageAnim(ImageAnim anim);                                                              // Unload animated image stream (frames and decoder)
+RLAPI Image GetAnimFrame(ImageAnim *anim, float time);                                                   // Get animation frame at time in seconds (looped), image data owned by animation
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI bool IsImageReady(Image image);                                                                    // Check if an image is ready
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI void UnloadImageCached(Image image);                                                               // Release image loaded with LoadImageCached()
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
+RLAPI bool ExportImageAsync(Image image, const char *fileName);                                          // Export image data to file on background thread (image data copied), returns true if requested
 RLAPI unsigned char *ExportImageToMemory(Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
 
@@ -1331,6 +1400,7 @@ RLAPI Image ImageFromImage(Image image, Rectangle rec);
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
+RLAPI void ImageCompress(Image *image, int format, int quality);                                         // Compress image data to DXT/ETC format (CompressQuality), mipmaps included
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1343,7 +1413,9 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill);  // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
+RLAPI void ImageMipmapsEx(Image *image, int filter, bool srgb, float alphaCutoff);                      // Compute all mipmap levels with filter (MipmapFilter), sRGB averaging and alpha test coverage (cutoff > 0)
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RLAPI void ImageQuantize(Image *image, int maxPaletteSize, bool dither);                                  // Reduce image colors to quantized palette (up to 256 colors), optionally dithered
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotate(Image *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
@@ -1357,11 +1429,23 @@ RLAPI void ImageColorBrightness(Image *image, int brightness);
 RLAPI void ImageColorReplace(Image *image, Color color, Color replace);                                  // Modify image color: replace color
 RLAPI Color *LoadImageColors(Image image);                                                               // Load color data from image as a Color array (RGBA - 32bit)
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
+RLAPI Color *LoadImagePaletteQuantized(Image image, int maxPaletteSize, int *colorCount);                // Load quantized colors palette from image (median cut), image colors if fewer than maxPaletteSize
+RLAPI unsigned char *LoadImagePaletteIndices(Image image, const Color *palette, int colorCount, bool dither); // Load image pixels as palette indices (up to 256 colors), optionally dithered
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
+RLAPI void UnloadImagePaletteIndices(unsigned char *indices);                                            // Unload palette indices loaded with LoadImagePaletteIndices()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
+// Image view functions
+// NOTE: Views point to image data, they are invalidated if image data is reallocated (i.e. ImageFormat(), ImageResize())
+RLAPI ImageView GetImageView(Image image);                                                               // Get view of image pixels (base mipmap level)
+RLAPI ImageView GetImageViewRec(Image image, Rectangle rec);                                             // Get view of image pixels region (clipped to image)
+RLAPI void *GetImageViewRow(ImageView view, int y);                                                      // Get pointer to first pixel of view row (typed span for view format)
+RLAPI void ReadImageViewRow(ImageView view, int x, int y, int count, Color *colors);                     // Read pixels span of view row as RGBA8 colors
+RLAPI void WriteImageViewRow(ImageView view, int x, int y, int count, const Color *colors);               // Write RGBA8 colors to pixels span of view row
+RLAPI void FillImageViewRow(ImageView view, int x, int y, int count, Color color);                       // Fill pixels span of view row with color
+
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
 RLAPI void ImageClearBackground(Image *dst, Color color);                                                // Clear image background with given color
@@ -1378,24 +1462,41 @@ RLAPI void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color
 RLAPI void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color);                                // Draw rectangle within an image
 RLAPI void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color);                   // Draw rectangle lines within an image
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
+RLAPI void ImageDrawEx(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode, int filter); // Draw a source image within a destination image with blend mode and scaling filter
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
 
 // Texture loading functions
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
+RLAPI Texture2D LoadTextureCached(const char *fileName);                                                 // Load texture from file through resources cache (shared between users)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 RLAPI bool IsTextureReady(Texture2D texture);                                                            // Check if a texture is ready
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
+RLAPI void UnloadTextureCached(Texture2D texture);                                                       // Release texture loaded with LoadTextureCached()
 RLAPI bool IsRenderTextureReady(RenderTexture2D target);                                                 // Check if a render texture is ready
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI void UpdateTextureAnim(Texture2D texture, ImageAnim *anim, float time);                            // Update GPU texture with animation frame at time in seconds (only if frame changed)
+
+// Texture async loading functions
+// NOTE: Images are decoded on a loader thread, GPU upload is done by UpdateTextureAsync() (called by EndDrawing())
+RLAPI int LoadTextureAsync(const char *fileName);                                                        // Request texture loading in background, returns request id (0 on failure)
+RLAPI int GetTextureAsyncState(int request);                                                             // Get texture async request state (TextureAsyncState)
+RLAPI bool IsTextureAsyncReady(int request);                                                             // Check if texture async request is uploaded and ready
+RLAPI Texture2D GetTextureAsync(int request);                                                            // Get requested texture, placeholder texture returned until ready
+RLAPI void UnloadTextureAsync(int request);                                                              // Unload texture async request (cancelled if still loading)
+RLAPI void UpdateTextureAsync(void);                                                                     // Upload decoded textures to GPU, limited by upload budget
+RLAPI void SetTextureAsyncUploadBudget(float milliseconds);                                              // Set GPU upload time budget per UpdateTextureAsync() call
+RLAPI void SetTextureAsyncPlaceholder(Texture2D texture);                                                // Set placeholder texture for not ready requests (not unloaded internally)
+RLAPI void SetTextureAsyncCallback(TextureAsyncCallback callback);                                       // Set callback for finished texture async requests
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
+RLAPI void SetTextureLoadMipmaps(bool enabled, int filter, bool srgb, float alphaCutoff);                // Set mipmaps generation for textures loaded from files (LoadTexture(), LoadTextureAsync())
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
 RLAPI void SetTextureWrap(Texture2D texture, int wrap);                                                  // Set texture wrapping mode
 
@@ -1432,6 +1533,7 @@ RLAPI int GetPixelDataSize(int width, int height, int format);              // G
 // Font loading/unloading functions
 RLAPI Font GetFontDefault(void);                                                            // Get the default Font
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
+RLAPI Font LoadFontCached(const char *fileName);                                            // Load font from file through resources cache (shared between users)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount);  // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
@@ -1440,6 +1542,7 @@ RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int f
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
+RLAPI void UnloadFontCached(Font font);                                                     // Release font loaded with LoadFontCached()
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
 
 // Text drawing functions
@@ -27,6 +27,11 @@
 *           Define static inline functions code, so #include header suffices for use.
 *           This may use up lots of memory.
 *
+*       #define RAYMATH_DISABLE_SIMD
+*           Disable the SIMD backend (SSE2 on x86/x64, NEON on ARM64), scalar code is used for all functions.
+*           SIMD backend is used by default when available, results match the scalar code path
+*           (same operations in same order) unless the compiler contracts scalar code into FMA
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -167,6 +172,109 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabsf()
 
+//----------------------------------------------------------------------------------
+// SIMD backend (4-wide float operations)
+//----------------------------------------------------------------------------------
+// NOTE: SSE2 is baseline on x64 and it is also available on AVX/AVX2 builds,
+// NEON backend requires AArch64 (ARMv7 NEON lacks vector division and square root)
+// NOTE: Backend is only used by MatrixMultiply() and array functions, single Vector3/Quaternion functions
+// are kept scalar, moving a single vector in and out of SIMD registers is slower than scalar code
+// and prevents the compiler auto-vectorizing loops calling them
+#if !defined(RAYMATH_DISABLE_SIMD) && !defined(__TINYC__)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>  // Required for: SSE2 intrinsics
+
+        #define RAYMATH_SIMD
+        #define RAYMATH_SIMD_SSE2
+
+        typedef __m128 rmFloat4;
+
+        #define RM_LOAD4(ptr)       _mm_loadu_ps(ptr)
+        #define RM_STORE4(ptr, v)   _mm_storeu_ps(ptr, v)
+        #define RM_SET1(x)          _mm_set1_ps(x)
+        #define RM_ADD4(a, b)       _mm_add_ps(a, b)
+        #define RM_SUB4(a, b)       _mm_sub_ps(a, b)
+        #define RM_MUL4(a, b)       _mm_mul_ps(a, b)
+        #define RM_DIV4(a, b)       _mm_div_ps(a, b)
+        #define RM_SQRT4(a)         _mm_sqrt_ps(a)
+        #define RM_SELECT_NONZERO4(c, a, b) _mm_or_ps(_mm_and_ps(_mm_cmpneq_ps(c, _mm_setzero_ps()), a), _mm_andnot_ps(_mm_cmpneq_ps(c, _mm_setzero_ps()), b))
+
+        // Load 4 consecutive Vector3 (12 floats), components split into separate lanes
+        // NOTE: Macros are used instead of functions, non-static inline functions can not call static functions
+        #define RM_LOAD_VECTOR3X4(ptr, x, y, z) do { \
+            __m128 rmA = _mm_loadu_ps(ptr);         /* x0 y0 z0 x1 */ \
+            __m128 rmB = _mm_loadu_ps((ptr) + 4);   /* y1 z1 x2 y2 */ \
+            __m128 rmC = _mm_loadu_ps((ptr) + 8);   /* z2 x3 y3 z3 */ \
+            x = _mm_shuffle_ps(rmA, _mm_shuffle_ps(rmB, rmC, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0)); \
+            y = _mm_shuffle_ps(_mm_shuffle_ps(rmA, rmB, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(rmB, rmC, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)); \
+            z = _mm_shuffle_ps(_mm_shuffle_ps(rmA, rmB, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(rmC, rmC, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)); \
+        } while (0)
+
+        // Store 4 consecutive Vector3 (12 floats) from components split into separate lanes
+        #define RM_STORE_VECTOR3X4(ptr, x, y, z) do { \
+            _mm_storeu_ps(ptr, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0))); \
+            _mm_storeu_ps((ptr) + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0))); \
+            _mm_storeu_ps((ptr) + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0))); \
+        } while (0)
+
+        // Load 4 consecutive Vector4/Quaternion (16 floats), components split into separate lanes
+        #define RM_LOAD_VECTOR4X4(ptr, x, y, z, w) do { \
+            x = _mm_loadu_ps(ptr); y = _mm_loadu_ps((ptr) + 4); z = _mm_loadu_ps((ptr) + 8); w = _mm_loadu_ps((ptr) + 12); \
+            _MM_TRANSPOSE4_PS(x, y, z, w); \
+        } while (0)
+
+        // Store 4 consecutive Vector4/Quaternion (16 floats) from components split into separate lanes
+        #define RM_STORE_VECTOR4X4(ptr, x, y, z, w) do { \
+            __m128 rmX = x, rmY = y, rmZ = z, rmW = w; \
+            _MM_TRANSPOSE4_PS(rmX, rmY, rmZ, rmW); \
+            _mm_storeu_ps(ptr, rmX); _mm_storeu_ps((ptr) + 4, rmY); _mm_storeu_ps((ptr) + 8, rmZ); _mm_storeu_ps((ptr) + 12, rmW); \
+        } while (0)
+    #elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+        #include <arm_neon.h>   // Required for: NEON intrinsics
+
+        #define RAYMATH_SIMD
+        #define RAYMATH_SIMD_NEON
+
+        typedef float32x4_t rmFloat4;
+
+        #define RM_LOAD4(ptr)       vld1q_f32(ptr)
+        #define RM_STORE4(ptr, v)   vst1q_f32(ptr, v)
+        #define RM_SET1(x)          vdupq_n_f32(x)
+        #define RM_ADD4(a, b)       vaddq_f32(a, b)
+        #define RM_SUB4(a, b)       vsubq_f32(a, b)
+        #define RM_MUL4(a, b)       vmulq_f32(a, b)
+        #define RM_DIV4(a, b)       vdivq_f32(a, b)
+        #define RM_SQRT4(a)         vsqrtq_f32(a)
+        #define RM_SELECT_NONZERO4(c, a, b) vbslq_f32(vceqq_f32(c, vdupq_n_f32(0.0f)), b, a)
+
+        // Load 4 consecutive Vector3 (12 floats), components split into separate lanes
+        #define RM_LOAD_VECTOR3X4(ptr, x, y, z) do { \
+            float32x4x3_t rmV = vld3q_f32(ptr); \
+            x = rmV.val[0]; y = rmV.val[1]; z = rmV.val[2]; \
+        } while (0)
+
+        // Store 4 consecutive Vector3 (12 floats) from components split into separate lanes
+        #define RM_STORE_VECTOR3X4(ptr, x, y, z) do { \
+            float32x4x3_t rmV; \
+            rmV.val[0] = x; rmV.val[1] = y; rmV.val[2] = z; \
+            vst3q_f32(ptr, rmV); \
+        } while (0)
+
+        // Load 4 consecutive Vector4/Quaternion (16 floats), components split into separate lanes
+        #define RM_LOAD_VECTOR4X4(ptr, x, y, z, w) do { \
+            float32x4x4_t rmV = vld4q_f32(ptr); \
+            x = rmV.val[0]; y = rmV.val[1]; z = rmV.val[2]; w = rmV.val[3]; \
+        } while (0)
+
+        // Store 4 consecutive Vector4/Quaternion (16 floats) from components split into separate lanes
+        #define RM_STORE_VECTOR4X4(ptr, x, y, z, w) do { \
+            float32x4x4_t rmV; \
+            rmV.val[0] = x; rmV.val[1] = y; rmV.val[2] = z; rmV.val[3] = w; \
+            vst4q_f32(ptr, rmV); \
+        } while (0)
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -1604,6 +1712,27 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD)
+    // NOTE: Every memory row of result is a combination of left memory rows,
+    // weighted by the corresponding right memory row components
+    const float *l = &left.m0;
+    const float *r = &right.m0;
+    float *res = &result.m0;
+
+    rmFloat4 l0 = RM_LOAD4(l);
+    rmFloat4 l1 = RM_LOAD4(l + 4);
+    rmFloat4 l2 = RM_LOAD4(l + 8);
+    rmFloat4 l3 = RM_LOAD4(l + 12);
+
+    for (int i = 0; i < 4; i++)
+    {
+        rmFloat4 row = RM_MUL4(RM_SET1(r[i*4]), l0);
+        row = RM_ADD4(row, RM_MUL4(RM_SET1(r[i*4 + 1]), l1));
+        row = RM_ADD4(row, RM_MUL4(RM_SET1(r[i*4 + 2]), l2));
+        row = RM_ADD4(row, RM_MUL4(RM_SET1(r[i*4 + 3]), l3));
+        RM_STORE4(res + i*4, row);
+    }
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -1620,6 +1749,7 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
@@ -2483,4 +2613,180 @@ RMAPI int QuaternionEquals(Quaternion p, Quaternion q)
     return result;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Array math (batch processing)
+//----------------------------------------------------------------------------------
+// NOTE: Array functions process count elements from contiguous buffers,
+// result buffer can be the same as the input buffer (in-place processing)
+
+// Transform an array of Vector3 by a given Matrix
+RMAPI void Vector3TransformArray(Vector3 *result, const Vector3 *v, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD)
+    rmFloat4 m0 = RM_SET1(mat.m0), m1 = RM_SET1(mat.m1), m2 = RM_SET1(mat.m2);
+    rmFloat4 m4 = RM_SET1(mat.m4), m5 = RM_SET1(mat.m5), m6 = RM_SET1(mat.m6);
+    rmFloat4 m8 = RM_SET1(mat.m8), m9 = RM_SET1(mat.m9), m10 = RM_SET1(mat.m10);
+    rmFloat4 m12 = RM_SET1(mat.m12), m13 = RM_SET1(mat.m13), m14 = RM_SET1(mat.m14);
+
+    // Process 4 vectors at once, components split into separate lanes
+    for (; i + 4 <= count; i += 4)
+    {
+        rmFloat4 vx, vy, vz;
+        RM_LOAD_VECTOR3X4(&v[i].x, vx, vy, vz);
+
+        rmFloat4 rx = RM_ADD4(RM_ADD4(RM_ADD4(RM_MUL4(m0, vx), RM_MUL4(m4, vy)), RM_MUL4(m8, vz)), m12);
+        rmFloat4 ry = RM_ADD4(RM_ADD4(RM_ADD4(RM_MUL4(m1, vx), RM_MUL4(m5, vy)), RM_MUL4(m9, vz)), m13);
+        rmFloat4 rz = RM_ADD4(RM_ADD4(RM_ADD4(RM_MUL4(m2, vx), RM_MUL4(m6, vy)), RM_MUL4(m10, vz)), m14);
+
+        RM_STORE_VECTOR3X4(&result[i].x, rx, ry, rz);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = v[i].x;
+        float y = v[i].y;
+        float z = v[i].z;
+
+        result[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        result[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
+// Normalize an array of Vector3
+RMAPI void Vector3NormalizeArray(Vector3 *result, const Vector3 *v, int count)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD)
+    // Process 4 vectors at once, components split into separate lanes
+    for (; i + 4 <= count; i += 4)
+    {
+        rmFloat4 vx, vy, vz;
+        RM_LOAD_VECTOR3X4(&v[i].x, vx, vy, vz);
+
+        rmFloat4 length = RM_MUL4(vx, vx);
+        length = RM_ADD4(length, RM_MUL4(vy, vy));
+        length = RM_ADD4(length, RM_MUL4(vz, vz));
+        length = RM_SQRT4(length);
+
+        rmFloat4 ilength = RM_DIV4(RM_SET1(1.0f), length);
+
+        // NOTE: Zero-length vectors are kept unchanged
+        vx = RM_SELECT_NONZERO4(length, RM_MUL4(vx, ilength), vx);
+        vy = RM_SELECT_NONZERO4(length, RM_MUL4(vy, ilength), vy);
+        vz = RM_SELECT_NONZERO4(length, RM_MUL4(vz, ilength), vz);
+
+        RM_STORE_VECTOR3X4(&result[i].x, vx, vy, vz);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Vector3 vec = v[i];
+
+        float length = sqrtf(vec.x*vec.x + vec.y*vec.y + vec.z*vec.z);
+        if (length != 0.0f)
+        {
+            float ilength = 1.0f/length;
+
+            vec.x *= ilength;
+            vec.y *= ilength;
+            vec.z *= ilength;
+        }
+
+        result[i] = vec;
+    }
+}
+
+// Multiply two arrays of quaternions, element by element
+RMAPI void QuaternionMultiplyArray(Quaternion *result, const Quaternion *q1, const Quaternion *q2, int count)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD)
+    // Process 4 quaternions at once, components split into separate lanes
+    for (; i + 4 <= count; i += 4)
+    {
+        rmFloat4 qax, qay, qaz, qaw;
+        rmFloat4 qbx, qby, qbz, qbw;
+        RM_LOAD_VECTOR4X4(&q1[i].x, qax, qay, qaz, qaw);
+        RM_LOAD_VECTOR4X4(&q2[i].x, qbx, qby, qbz, qbw);
+
+        rmFloat4 rx = RM_SUB4(RM_ADD4(RM_ADD4(RM_MUL4(qax, qbw), RM_MUL4(qaw, qbx)), RM_MUL4(qay, qbz)), RM_MUL4(qaz, qby));
+        rmFloat4 ry = RM_SUB4(RM_ADD4(RM_ADD4(RM_MUL4(qay, qbw), RM_MUL4(qaw, qby)), RM_MUL4(qaz, qbx)), RM_MUL4(qax, qbz));
+        rmFloat4 rz = RM_SUB4(RM_ADD4(RM_ADD4(RM_MUL4(qaz, qbw), RM_MUL4(qaw, qbz)), RM_MUL4(qax, qby)), RM_MUL4(qay, qbx));
+        rmFloat4 rw = RM_SUB4(RM_SUB4(RM_SUB4(RM_MUL4(qaw, qbw), RM_MUL4(qax, qbx)), RM_MUL4(qay, qby)), RM_MUL4(qaz, qbz));
+
+        RM_STORE_VECTOR4X4(&result[i].x, rx, ry, rz, rw);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float qax = q1[i].x, qay = q1[i].y, qaz = q1[i].z, qaw = q1[i].w;
+        float qbx = q2[i].x, qby = q2[i].y, qbz = q2[i].z, qbw = q2[i].w;
+
+        result[i].x = qax*qbw + qaw*qbx + qay*qbz - qaz*qby;
+        result[i].y = qay*qbw + qaw*qby + qaz*qbx - qax*qbz;
+        result[i].z = qaz*qbw + qaw*qbz + qax*qby - qay*qbx;
+        result[i].w = qaw*qbw - qax*qbx - qay*qby - qaz*qbz;
+    }
+}
+
+// Multiply two arrays of matrices, element by element (result[i] = left[i]*right[i])
+RMAPI void MatrixMultiplyArray(Matrix *result, const Matrix *left, const Matrix *right, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+#if defined(RAYMATH_SIMD)
+        const float *l = &left[i].m0;
+        const float *r = &right[i].m0;
+        float *res = &result[i].m0;
+
+        rmFloat4 l0 = RM_LOAD4(l);
+        rmFloat4 l1 = RM_LOAD4(l + 4);
+        rmFloat4 l2 = RM_LOAD4(l + 8);
+        rmFloat4 l3 = RM_LOAD4(l + 12);
+
+        // NOTE: Result could alias left or right, left rows are loaded before any store
+        // and result memory row k only overwrites right memory row k, already consumed
+        for (int k = 0; k < 4; k++)
+        {
+            rmFloat4 rk = RM_MUL4(RM_SET1(r[k*4]), l0);
+            rk = RM_ADD4(rk, RM_MUL4(RM_SET1(r[k*4 + 1]), l1));
+            rk = RM_ADD4(rk, RM_MUL4(RM_SET1(r[k*4 + 2]), l2));
+            rk = RM_ADD4(rk, RM_MUL4(RM_SET1(r[k*4 + 3]), l3));
+            RM_STORE4(res + k*4, rk);
+        }
+#else
+        Matrix a = left[i];
+        Matrix b = right[i];
+        Matrix m = { 0 };
+
+        m.m0 = a.m0*b.m0 + a.m1*b.m4 + a.m2*b.m8 + a.m3*b.m12;
+        m.m1 = a.m0*b.m1 + a.m1*b.m5 + a.m2*b.m9 + a.m3*b.m13;
+        m.m2 = a.m0*b.m2 + a.m1*b.m6 + a.m2*b.m10 + a.m3*b.m14;
+        m.m3 = a.m0*b.m3 + a.m1*b.m7 + a.m2*b.m11 + a.m3*b.m15;
+        m.m4 = a.m4*b.m0 + a.m5*b.m4 + a.m6*b.m8 + a.m7*b.m12;
+        m.m5 = a.m4*b.m1 + a.m5*b.m5 + a.m6*b.m9 + a.m7*b.m13;
+        m.m6 = a.m4*b.m2 + a.m5*b.m6 + a.m6*b.m10 + a.m7*b.m14;
+        m.m7 = a.m4*b.m3 + a.m5*b.m7 + a.m6*b.m11 + a.m7*b.m15;
+        m.m8 = a.m8*b.m0 + a.m9*b.m4 + a.m10*b.m8 + a.m11*b.m12;
+        m.m9 = a.m8*b.m1 + a.m9*b.m5 + a.m10*b.m9 + a.m11*b.m13;
+        m.m10 = a.m8*b.m2 + a.m9*b.m6 + a.m10*b.m10 + a.m11*b.m14;
+        m.m11 = a.m8*b.m3 + a.m9*b.m7 + a.m10*b.m11 + a.m11*b.m15;
+        m.m12 = a.m12*b.m0 + a.m13*b.m4 + a.m14*b.m8 + a.m15*b.m12;
+        m.m13 = a.m12*b.m1 + a.m13*b.m5 + a.m14*b.m9 + a.m15*b.m13;
+        m.m14 = a.m12*b.m2 + a.m13*b.m6 + a.m14*b.m10 + a.m15*b.m14;
+        m.m15 = a.m12*b.m3 + a.m13*b.m7 + a.m14*b.m11 + a.m15*b.m15;
+
+        result[i] = m;
+#endif
+    }
+}
+
 #endif  // RAYMATH_H
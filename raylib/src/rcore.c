@@ -245,6 +245,13 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE          10        // Default GIF recording frames per second
+#endif
+#ifndef GIF_RECORD_MAX_QUEUED_FRAMES
+    #define GIF_RECORD_MAX_QUEUED_FRAMES   4        // Maximum number of GIF frames waiting to be encoded, new frames are dropped if full
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -365,9 +372,43 @@ static int screenshotCounter = 0;    // Screenshots counter
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
+// GIF recording frame, captured on render thread
+typedef struct GifFrame {
+    unsigned char *data;             // Frame pixels (R8G8B8A8), captured size
+    int width;                       // Frame width (captured)
+    int height;                      // Frame height (captured)
+    int delay;                       // Frame duration (centiseconds)
+} GifFrame;
+
+// GIF recorder, frames are quantized and encoded on a background thread
+// NOTE: Frames are captured at a fixed rate, if encoder can not keep up frames are dropped
+// and their duration is added to last queued frame, so GIF playback keeps real time
+typedef struct GifRecorder {
+    ThreadMutex mutex;               // Frames queue mutex
+    ThreadCondition frameQueued;     // Signaled when a frame is queued or recording is finished
+    ThreadHandle thread;             // Encoder thread
+    bool started;                    // Encoder thread started, otherwise frames are encoded on render thread
+    bool finish;                     // Encoder thread must encode queued frames and exit
+
+    int frameRate;                   // Recording frames per second (0 for default)
+    float scale;                     // Recording size scale (0 for default)
+    int width;                       // Recording width (scaled)
+    int height;                      // Recording height (scaled)
+    double startTime;                // Recording start time
+    int nextPeriod;                  // Next frame period to be captured (1/frameRate)
+
+    GifFrame frames[GIF_RECORD_MAX_QUEUED_FRAMES];  // Frames queue (ring buffer)
+    int first;                       // First queued frame index
+    int count;                       // Queued frames count
+
+    unsigned int recordedFrames;     // Frames recorded
+    unsigned int droppedFrames;      // Frames dropped (encoder busy)
+} GifRecorder;
+
 unsigned int gifFrameCounter = 0;    // GIF frames counter
 bool gifRecording = false;           // GIF recording state
 MsfGifState gifState = { 0 };        // MSGIF context state
+static GifRecorder gifRecorder = { 0 };  // GIF recorder state
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
@@ -468,6 +509,12 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern void CloseTextureAsync(void);    // [Module: textures] Stops texture loader thread and unloads async requests
+extern bool QueueImageExport(Image image, const char *fileName);    // [Module: textures] Export image on background thread, image data ownership is transferred
+extern void CloseImageExport(void);     // [Module: textures] Exports pending images and stops exporter thread
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
 
@@ -482,6 +529,14 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_GIF_RECORDING)
+static void StartGifRecording(void);                        // Start GIF recording and encoder thread
+static void FinishGifRecording(const char *fileName);       // Finish GIF recording, encoding queued frames (NULL fileName discards recording)
+static void CaptureGifFrame(void);                          // Capture current frame for GIF recording (if required by recording frame rate)
+static void EncodeGifFrame(GifFrame *frame);                // Encode GIF frame, scaled to recording size
+static void GifEncoderThread(void *data);                   // GIF encoder thread, encodes queued frames
+#endif
+
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -679,18 +734,22 @@ void InitWindow(int width, int height, const char *title)
 void CloseWindow(void)
 {
 #if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
+    if (gifRecording) FinishGifRecording(NULL);     // Discard active recording
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    CloseImageExport();         // WARNING: Module required: rtextures
+    CloseTextureAsync();        // WARNING: Module required: rtextures (releases cached textures references)
 #endif
 
+    CloseResourceCache();       // Unload all cached resources (including GPU resources)
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+    CloseWorkerThreads();       // Stop internal worker threads (if started)
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -845,24 +904,19 @@ void EndDrawing(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UpdateTextureAsync();           // Upload async loaded textures, limited by upload budget
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
     if (gifRecording)
     {
-        #define GIF_RECORD_FRAMERATE    10
         gifFrameCounter++;
 
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = GetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-            msf_gif_frame(&gifState, screenData, 10, 16, (int)((float)CORE.Window.render.width*scale.x)*4);
-
-            RL_FREE(screenData);    // Free image data
-        }
+        // NOTE: Frame is captured before drawing record indicator,
+        // it is queued and encoded on a background thread
+        CaptureGifFrame();
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
         if (((gifFrameCounter/15)%2) == 1)
@@ -911,24 +965,10 @@ void EndDrawing(void)
 #if defined(SUPPORT_GIF_RECORDING)
         if (IsKeyDown(KEY_LEFT_CONTROL))
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
+            if (gifRecording) FinishGifRecording(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter));
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
-                Vector2 scale = GetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
+                StartGifRecording();
                 screenshotCounter++;
 
                 TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
@@ -1786,7 +1826,8 @@ void UnloadRandomSequence(int *sequence)
 }
 
 // Takes a screenshot of current screen
-// NOTE: Provided fileName should not contain paths, saving to working directory
+// NOTE: Provided fileName should not contain paths, saving to working directory,
+// screen pixels are read on calling thread but image is encoded and saved on a background thread
 void TakeScreenshot(const char *fileName)
 {
 #if defined(SUPPORT_MODULE_RTEXTURES)
@@ -1799,17 +1840,39 @@ void TakeScreenshot(const char *fileName)
 
     char path[512] = { 0 };
     strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, GetFileName(fileName)));
-    
-    ExportImage(image, path);           // WARNING: Module required: rtextures
-    RL_FREE(imgData);
 
-    if (FileExists(path)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+    // NOTE: Image data is released by exporter, file is saved on exporter thread and
+    // export result (success or failure) is logged by exporter once the file is written
+    if (QueueImageExport(image, path)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot queued for export", path);   // WARNING: Module required: rtextures
     else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", path);
 #else
     TRACELOG(LOG_WARNING,"IMAGE: ExportImage() requires module: rtextures");
 #endif
 }
 
+// Set GIF recording frames per second and size scale
+// NOTE: Configuration is applied on next recording (started with LEFT_CONTROL + F12),
+// frames are encoded on a background thread and dropped if encoder can not keep up
+void SetGifRecordingConfig(int frameRate, float scale)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    // NOTE: GIF frame delays are defined in centiseconds
+    if (frameRate < 1) frameRate = 1;
+    else if (frameRate > 50) frameRate = 50;
+
+    if ((scale <= 0.0f) || (scale > 1.0f)) scale = 1.0f;
+#if !defined(SUPPORT_MODULE_RTEXTURES)
+    if (scale != 1.0f) TRACELOG(LOG_WARNING, "SYSTEM: GIF recording scale requires module: rtextures");
+    scale = 1.0f;
+#endif
+
+    gifRecorder.frameRate = frameRate;
+    gifRecorder.scale = scale;
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: GIF recording not supported (SUPPORT_GIF_RECORDING)");
+#endif
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process.
@@ -3560,6 +3623,197 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_GIF_RECORDING)
+// Start GIF recording and encoder thread
+// NOTE: Recording size is current render size (scaled by DPI and recording scale)
+static void StartGifRecording(void)
+{
+    if (gifRecorder.frameRate == 0) gifRecorder.frameRate = GIF_RECORD_FRAMERATE;
+    if (gifRecorder.scale == 0.0f) gifRecorder.scale = 1.0f;
+
+    Vector2 scale = GetWindowScaleDPI();
+    gifRecorder.width = (int)((float)CORE.Window.render.width*scale.x*gifRecorder.scale);
+    gifRecorder.height = (int)((float)CORE.Window.render.height*scale.y*gifRecorder.scale);
+    if (gifRecorder.width < 1) gifRecorder.width = 1;
+    if (gifRecorder.height < 1) gifRecorder.height = 1;
+
+    gifRecorder.startTime = GetTime();
+    gifRecorder.nextPeriod = 0;
+    gifRecorder.first = 0;
+    gifRecorder.count = 0;
+    gifRecorder.recordedFrames = 0;
+    gifRecorder.droppedFrames = 0;
+    gifRecorder.finish = false;
+    gifRecorder.started = false;
+
+    msf_gif_begin(&gifState, gifRecorder.width, gifRecorder.height);
+
+    gifRecording = true;
+    gifFrameCounter = 0;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    InitThreadMutex(&gifRecorder.mutex);
+    InitThreadCondition(&gifRecorder.frameQueued);
+
+    gifRecorder.started = StartThread(&gifRecorder.thread, GifEncoderThread, NULL);
+
+    if (!gifRecorder.started)
+    {
+        // NOTE: Synchronization objects are only used by encoder thread, released on failure
+        CloseThreadCondition(&gifRecorder.frameQueued);
+        CloseThreadMutex(&gifRecorder.mutex);
+
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to start GIF encoder thread, frames encoded on render thread");
+    }
+#endif
+}
+
+// Finish GIF recording, encoding queued frames
+// NOTE: If no fileName provided, queued frames are discarded and recording is not saved
+static void FinishGifRecording(const char *fileName)
+{
+    if (gifRecorder.started)
+    {
+        LockThreadMutex(&gifRecorder.mutex);
+
+        if (fileName == NULL)
+        {
+            for (int i = 0; i < gifRecorder.count; i++) RL_FREE(gifRecorder.frames[(gifRecorder.first + i)%GIF_RECORD_MAX_QUEUED_FRAMES].data);
+            gifRecorder.count = 0;
+        }
+
+        gifRecorder.finish = true;
+        SignalThreadCondition(&gifRecorder.frameQueued);
+        UnlockThreadMutex(&gifRecorder.mutex);
+
+        JoinThread(&gifRecorder.thread);    // Wait for queued frames to be encoded
+        gifRecorder.started = false;
+
+        CloseThreadCondition(&gifRecorder.frameQueued);
+        CloseThreadMutex(&gifRecorder.mutex);
+    }
+
+    MsfGifResult result = msf_gif_end(&gifState);
+
+    if (fileName != NULL)
+    {
+        SaveFileData(fileName, result.data, (unsigned int)result.dataSize);
+
+        TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording (%u frames recorded, %u frames dropped)", gifRecorder.recordedFrames, gifRecorder.droppedFrames);
+    }
+
+    msf_gif_free(result);
+
+    gifRecording = false;
+}
+
+// Capture current frame for GIF recording
+// NOTE: Frames are captured at recording frame rate, frame duration is computed from
+// recording start time to avoid accumulating rounding errors (GIF delays are centiseconds)
+static void CaptureGifFrame(void)
+{
+    int period = (int)((GetTime() - gifRecorder.startTime)*gifRecorder.frameRate);
+
+    if (period < gifRecorder.nextPeriod) return;    // Frame not required yet
+
+    // NOTE: Periods missed (game running slower than recording frame rate) are added to current frame
+    int delay = (period + 1)*100/gifRecorder.frameRate - gifRecorder.nextPeriod*100/gifRecorder.frameRate;
+    gifRecorder.nextPeriod = period + 1;
+
+    if (gifRecorder.started)
+    {
+        LockThreadMutex(&gifRecorder.mutex);
+
+        bool queueFull = (gifRecorder.count == GIF_RECORD_MAX_QUEUED_FRAMES);
+
+        if (queueFull)
+        {
+            // Encoder can not keep up, frame is dropped (no screen read back) and last queued frame lasts longer
+            gifRecorder.frames[(gifRecorder.first + gifRecorder.count - 1)%GIF_RECORD_MAX_QUEUED_FRAMES].delay += delay;
+            gifRecorder.droppedFrames++;
+        }
+
+        UnlockThreadMutex(&gifRecorder.mutex);
+
+        if (queueFull) return;
+    }
+
+    // Get image data for the current frame (from backbuffer)
+    // NOTE: Screen read back is done on render thread, quantization and encoding are done by encoder thread
+    Vector2 scale = GetWindowScaleDPI();
+    GifFrame frame = { 0 };
+    frame.width = (int)((float)CORE.Window.render.width*scale.x);
+    frame.height = (int)((float)CORE.Window.render.height*scale.y);
+    frame.data = rlReadScreenPixels(frame.width, frame.height);
+    frame.delay = delay;
+
+    gifRecorder.recordedFrames++;
+
+    if (gifRecorder.started)
+    {
+        // NOTE: Encoder thread only removes frames from queue, so there is space for the new frame
+        LockThreadMutex(&gifRecorder.mutex);
+        gifRecorder.frames[(gifRecorder.first + gifRecorder.count)%GIF_RECORD_MAX_QUEUED_FRAMES] = frame;
+        gifRecorder.count++;
+        SignalThreadCondition(&gifRecorder.frameQueued);
+        UnlockThreadMutex(&gifRecorder.mutex);
+    }
+    else
+    {
+        EncodeGifFrame(&frame);
+        RL_FREE(frame.data);
+    }
+}
+
+// Encode GIF frame, scaled to recording size
+// NOTE: Frame data could be reallocated on scaling
+static void EncodeGifFrame(GifFrame *frame)
+{
+    if ((frame->width != gifRecorder.width) || (frame->height != gifRecorder.height))
+    {
+#if defined(SUPPORT_MODULE_RTEXTURES)
+        Image image = { frame->data, frame->width, frame->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        ImageResize(&image, gifRecorder.width, gifRecorder.height);    // WARNING: Module required: rtextures
+
+        frame->data = (unsigned char *)image.data;
+        frame->width = image.width;
+        frame->height = image.height;
+#else
+        return;     // Window resized while recording, frame can not be scaled
+#endif
+    }
+
+    msf_gif_frame(&gifState, frame->data, frame->delay, 16, frame->width*4);
+}
+
+// GIF encoder thread, encodes queued frames until recording is finished
+static void GifEncoderThread(void *data)
+{
+    LockThreadMutex(&gifRecorder.mutex);
+
+    while (true)
+    {
+        if (gifRecorder.count > 0)
+        {
+            // NOTE: Frame is removed from queue before encoding, its delay can not be extended anymore
+            GifFrame frame = gifRecorder.frames[gifRecorder.first];
+            gifRecorder.first = (gifRecorder.first + 1)%GIF_RECORD_MAX_QUEUED_FRAMES;
+            gifRecorder.count--;
+            UnlockThreadMutex(&gifRecorder.mutex);
+
+            EncodeGifFrame(&frame);
+            RL_FREE(frame.data);
+
+            LockThreadMutex(&gifRecorder.mutex);
+        }
+        else if (gifRecorder.finish) break;
+        else WaitThreadCondition(&gifRecorder.frameQueued, &gifRecorder.mutex);
+    }
+
+    UnlockThreadMutex(&gifRecorder.mutex);
+}
+#endif
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
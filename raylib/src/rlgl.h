@@ -20,6 +20,14 @@
 *
 *       Internal buffer (and resources) must be manually unloaded calling rlglClose().
 *
+*       Batch sorting mode (rlEnableBatchSorting()) reorders draws by layer and texture when the
+*       batch is drawn, so interleaved textures are merged into fewer draw calls; painter's order
+*       is kept between layers (rlSetBatchLayer()), draws inside a layer are expected not to overlap.
+*
+*       Batch recorders (rlBatchRecorder) accumulate vertex data in CPU memory only, without any
+*       OpenGL call or global state access, so several threads can record in parallel (i.e. one
+*       recorder per scene chunk) and the main thread submits them in order to the active batch.
+*
 *   CONFIGURATION:
 *       #define GRAPHICS_API_OPENGL_11
 *       #define GRAPHICS_API_OPENGL_21
@@ -46,6 +54,21 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_BATCH_MULTITEXTURE
+*           Enable multi-texture batching for default shader: up to RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
+*           textures are bound per draw call and selected per vertex (texture slot attribute),
+*           so interleaved textures do not break the batch (OpenGL 3.3 and ES2 only)
+*
+*       #define RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS
+*           Store render batch texture coordinates as 16-bit normalized values (4 bytes per vertex
+*           instead of 8), coordinates are clamped to [0..1] range, texture repeat is not supported
+*           (out of range coordinates are reported once with a warning)
+*
+*       #define RLGL_ENABLE_BATCH_HALF_POSITIONS
+*           Store render batch vertex positions as half-float values (6 bytes per vertex instead of 12),
+*           precision is reduced to 1 unit over 2048 (screen coordinates), only OpenGL 3.3
+*           (positions out of [-2048..2048] range are reported once with a warning)
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -68,6 +91,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 6 (RLGL_ENABLE_BATCH_MULTITEXTURE)
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -191,6 +215,11 @@
 // NOTE: Some driver implementation do not support it, despite they should
 #define RLGL_RENDER_TEXTURES_HINT
 
+// Half-float vertex positions are only supported on OpenGL 3.3 (OpenGL ES 2.0 requires an extension)
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS) && !defined(GRAPHICS_API_OPENGL_33)
+    #undef RLGL_ENABLE_BATCH_HALF_POSITIONS
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -347,9 +376,18 @@ typedef struct Matrix {
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+    unsigned short *vertices;   // Vertex position (XYZ - 3 half-float components per vertex) (shader-location = 0)
+#else
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
+#endif
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+    unsigned short *texcoords;  // Vertex texture coordinates (UV - 2 normalized components per vertex) (shader-location = 1)
+#else
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
+#endif
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+    unsigned char *texslots;    // Vertex texture slot (1 component per vertex) (shader-location = 6) (only multi-texture batching)
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -357,7 +395,7 @@ typedef struct rlVertexBuffer {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
 } rlVertexBuffer;
 
 // Draw call type
@@ -371,6 +409,9 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, only used on batch sorting mode -> Use to create new draw call if changes
+    unsigned int textureSlots[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS]; // Textures bound to the draw, only used on multi-texture batching (slot 0 = textureId)
+    int textureSlotCount;       // Number of texture slots in use, only used on multi-texture batching
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -387,6 +428,29 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// rlBatchRecorder type
+// NOTE: CPU-only vertex data, it can be recorded from any thread (one recorder per thread)
+// and submitted on the main thread into the active render batch with rlSubmitBatchRecorder()
+typedef struct rlBatchRecorder {
+    int vertexCapacity;         // Maximum number of vertex for current arrays (grows on demand)
+    int vertexCounter;          // Number of vertex recorded
+    float *vertices;            // Vertex position (XYZ - 3 components per vertex)
+    float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex)
+    unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex)
+
+    int drawCapacity;           // Maximum number of draws for current array (grows on demand)
+    rlDrawCall *draws;          // Draw calls array, depends on mode and textureId
+    int drawCounter;            // Draw calls counter
+
+    int currentMode;            // Current drawing mode: LINES, TRIANGLES, QUADS
+    unsigned int currentTexture; // Current texture id (0 for default texture)
+    float texcoordx, texcoordy; // Current texture coordinate (added on rlRecordVertex*())
+    unsigned char colorr, colorg, colorb, colora; // Current color (added on rlRecordVertex*())
+    Matrix transform;           // Transform matrix applied to recorded vertex (if required)
+    bool transformRequired;     // Require transform matrix application to recorded vertex
+    float currentDepth;         // Current depth value for next draw
+} rlBatchRecorder;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -583,6 +647,8 @@ RLAPI void rlNormal3f(float x, float y, float z);       // Define one vertex (no
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);        // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlAppendVertices(const float *vertices, const float *texcoords, const unsigned char *colors, int vertexCount);   // Define multiple vertex (position XYZ, texcoords UV and colors RGBA arrays, NULL for current)
+RLAPI void rlAppendVertices2D(const float *vertices, const float *texcoords, const unsigned char *colors, int vertexCount); // Define multiple vertex (position XY, texcoords UV and colors RGBA arrays, NULL for current)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -685,6 +751,30 @@ RLAPI void rlDrawRenderBatchActive(void);               // Update and draw inter
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
+RLAPI void rlEnableBatchSorting(void);                  // Enable batch sorting mode (draws reordered by layer and texture on batch drawing)
+RLAPI void rlDisableBatchSorting(void);                 // Disable batch sorting mode (draws submitted in order)
+RLAPI void rlSetBatchLayer(int layer);                  // Set current draw layer for batch sorting mode (lower layers drawn first)
+RLAPI int rlGetDrawCallCount(void);                     // Get number of draw calls submitted since last counters reset
+RLAPI int rlGetStateChangeCount(void);                  // Get number of state changes (texture, shader, blending) since last counters reset
+RLAPI void rlResetDrawCounters(void);                   // Reset draw calls and state changes counters
+
+// Render batch recorders management
+// NOTE: Recording functions only access the provided recorder, they can be called from worker threads,
+// submission must be done on the main thread (OpenGL context thread), it's the caller responsibility
+// to make sure recording into a recorder is finished before submitting it
+RLAPI rlBatchRecorder rlLoadBatchRecorder(int vertexCapacity); // Load a batch recorder (CPU only, grows on demand)
+RLAPI void rlUnloadBatchRecorder(rlBatchRecorder recorder); // Unload batch recorder data
+RLAPI void rlResetBatchRecorder(rlBatchRecorder *recorder); // Reset batch recorder to record new data (memory is kept)
+RLAPI void rlRecordBegin(rlBatchRecorder *recorder, int mode); // Initialize recording mode (how to organize vertex)
+RLAPI void rlRecordEnd(rlBatchRecorder *recorder);      // Finish vertex recording
+RLAPI void rlRecordSetTexture(rlBatchRecorder *recorder, unsigned int id); // Set recording texture (0 for default texture)
+RLAPI void rlRecordSetTransform(rlBatchRecorder *recorder, Matrix transform); // Set transform applied to next recorded vertex
+RLAPI void rlRecordResetTransform(rlBatchRecorder *recorder); // Reset recording transform to identity
+RLAPI void rlRecordVertex2f(rlBatchRecorder *recorder, float x, float y); // Record one vertex (position) - 2 float
+RLAPI void rlRecordVertex3f(rlBatchRecorder *recorder, float x, float y, float z); // Record one vertex (position) - 3 float
+RLAPI void rlRecordTexCoord2f(rlBatchRecorder *recorder, float x, float y); // Record one vertex (texture coordinate) - 2 float
+RLAPI void rlRecordColor4ub(rlBatchRecorder *recorder, unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Record one vertex (color) - 4 byte
+RLAPI void rlSubmitBatchRecorder(const rlBatchRecorder *recorder); // Submit recorded data to active render batch (main thread only)
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -711,6 +801,8 @@ RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format);
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture with new data on GPU
 RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType); // Get OpenGL internal formats
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
+RLAPI unsigned short rlFloatToHalf(float value);                          // Convert float to half-float (16 bit) value
+RLAPI float rlHalfToFloat(unsigned short value);                          // Convert half-float (16 bit) value to float
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
@@ -845,6 +937,16 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
+// SSE2 is always available on x86-64, used to transform vertex positions on bulk vertex submission
+#if !defined(__TINYC__) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics [Used in rlTransformPositions()]
+    #define RLGL_SIMD_SSE2
+#endif
+
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+    #include <stdio.h>                  // Required for: snprintf() [Used in rlLoadShaderDefault()]
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -903,6 +1005,20 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define GL_TEXTURE_MAX_ANISOTROPY_EXT       0x84FE
 #endif
 
+// Render batch vertex attributes data types (compact vertex format)
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+    #define RL_BATCH_POSITION_TYPE              GL_HALF_FLOAT
+#else
+    #define RL_BATCH_POSITION_TYPE              GL_FLOAT
+#endif
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+    #define RL_BATCH_TEXCOORD_TYPE              GL_UNSIGNED_SHORT
+    #define RL_BATCH_TEXCOORD_NORMALIZED        GL_TRUE
+#else
+    #define RL_BATCH_TEXCOORD_TYPE              GL_FLOAT
+    #define RL_BATCH_TEXCOORD_NORMALIZED        GL_FALSE
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_UNSIGNED_SHORT_5_6_5             0x8363
     #define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
@@ -941,6 +1057,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT      "vertexTexSlot"     // Bound by default to shader location: 6
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -990,6 +1109,12 @@ typedef struct rlglData {
         Matrix projection;                  // Default projection matrix
         Matrix transform;                   // Transform matrix to be used with rlTranslate, rlRotate, rlScale
         bool transformRequired;             // Require transform matrix application to current draw-call vertex (if required)
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+        bool compactPositionsWarned;        // Vertex position out of half-float precise range already warned
+#endif
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+        bool compactTexcoordsWarned;        // Texture coordinates out of [0..1] range already warned
+#endif
         Matrix stack[RL_MAX_MATRIX_STACK_SIZE];// Matrix stack for push/pop
         int stackCounter;                   // Matrix stack counter
 
@@ -1022,6 +1147,19 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        // Batch sorting variables
+        bool batchSorting;                  // Batch sorting mode enabled, draws reordered on batch drawing
+        int currentLayer;                   // Current draw layer (used on batch sorting mode)
+        int currentTextureSlot;             // Current texture slot of active draw (used on multi-texture batching)
+        int sortCapacity;                   // Sorting scratch buffers capacity (number of vertex)
+        void *sortVertices;                 // Sorting scratch buffer: vertex position (batch vertex format)
+        void *sortTexcoords;                // Sorting scratch buffer: vertex texture coordinates (batch vertex format)
+        unsigned char *sortColors;          // Sorting scratch buffer: vertex colors
+        unsigned char *sortTexslots;        // Sorting scratch buffer: vertex texture slots (multi-texture batching)
+
+        int drawCallCounter;                // Draw calls submitted since last reset
+        int stateChangeCounter;             // State changes (texture, shader, blending) since last reset
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1076,6 +1214,16 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlSortRenderBatch(rlRenderBatch *batch); // Sort render batch draws by layer and texture (batch sorting mode)
+static bool rlDrawCallMergeable(const rlDrawCall *a, const rlDrawCall *b); // Check if two draws share the same state and can be merged
+static void rlAppendVertexData(const float *vertices, int components, const float *texcoords, const unsigned char *colors, int vertexCount); // Append vertex arrays to current draw
+static void rlTransformPositions(float *result, const float *positions, int components, float depth, Matrix mat, int count); // Transform vertex positions by matrix
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+static unsigned short rlPackBatchPosition(float x); // Convert batch vertex position component to half-float
+#endif
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+static unsigned short rlFloatToUnorm16(float x);    // Convert float to 16-bit normalized value (batch texture coordinates)
+#endif
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1363,6 +1511,11 @@ void rlBegin(int mode)
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
     {
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        // Multi-texture batching keeps texture slots and current texture on mode changes (default shader)
+        rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        int currentTextureSlot = RLGL.State.currentTextureSlot;
+#endif
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
         {
             // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
@@ -1386,7 +1539,61 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentLayer;
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        if (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)
+        {
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentDraw.textureSlots[0];
+            for (int i = 0; i < currentDraw.textureSlotCount; i++) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[i] = currentDraw.textureSlots[i];
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = currentDraw.textureSlotCount;
+            RLGL.State.currentTextureSlot = currentTextureSlot;
+        }
+        else
+        {
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[0] = RLGL.State.defaultTextureId;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = 1;
+            RLGL.State.currentTextureSlot = 0;
+        }
+#endif
+    }
+
+    // Register a new draw if layer changed, keeping current mode and texture (batch sorting mode)
+    if (RLGL.State.batchSorting && (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer != RLGL.State.currentLayer))
+    {
+        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
+        {
+            rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+            // NOTE: Same alignment requirements than mode changes
+            if (mode == RL_LINES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount : RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4);
+            else if (mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
+            else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
+
+            if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
+            {
+                RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentDraw.textureId;
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+            // NOTE: Texture slots are kept, current texture slot is still valid
+            for (int i = 0; i < currentDraw.textureSlotCount; i++) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[i] = currentDraw.textureSlots[i];
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = currentDraw.textureSlotCount;
+#endif
+        }
+
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentLayer;
     }
+
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+    // Assign a texture slot to default texture if pending (multi-texture batching)
+    if (RLGL.State.currentTextureSlot < 0) rlSetTexture(RLGL.State.defaultTextureId);
+#endif
 }
 
 // Finish vertex providing
@@ -1407,11 +1614,17 @@ void rlVertex3f(float x, float y, float z)
     float tz = z;
 
     // Transform provided vector if required
+    // NOTE: Same positions transform used by rlAppendVertexData(), submitting vertex blocks is preferred
+    // for bulk geometry, transform is processed for all block positions at once
     if (RLGL.State.transformRequired)
     {
-        tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
-        ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
-        tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
+        float position[3] = { x, y, z };
+
+        rlTransformPositions(position, position, 3, 0.0f, RLGL.State.transform, 1);
+
+        tx = position[0];
+        ty = position[1];
+        tz = position[2];
     }
 
     // WARNING: We can't break primitives when launching a new batch.
@@ -1440,13 +1653,24 @@ void rlVertex3f(float x, float y, float z)
     }
 
     // Add vertices
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = rlPackBatchPosition(tx);
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = rlPackBatchPosition(ty);
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = rlPackBatchPosition(tz);
+#else
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+#endif
 
     // Add current texcoord
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = rlFloatToUnorm16(RLGL.State.texcoordx);
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = rlFloatToUnorm16(RLGL.State.texcoordy);
+#else
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+#endif
 
     // WARNING: By default rlVertexBuffer struct does not store normals
 
@@ -1456,6 +1680,11 @@ void rlVertex3f(float x, float y, float z)
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
 
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+    // Add current texture slot
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texslots[RLGL.State.vertexCounter] = (unsigned char)RLGL.State.currentTextureSlot;
+#endif
+
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
 }
@@ -1512,6 +1741,41 @@ void rlColor3f(float x, float y, float z)
 
 #endif
 
+// Define multiple vertex (position XYZ, texture coordinates UV and colors RGBA arrays)
+// NOTE: Vertex are added to current draw, vertexCount must be a multiple of primitive size (LINES: 2, TRIANGLES: 3, QUADS: 4),
+// texcoords and colors can be NULL to use current texture coordinate and color for all the vertex
+void rlAppendVertices(const float *vertices, const float *texcoords, const unsigned char *colors, int vertexCount)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    for (int i = 0; i < vertexCount; i++)
+    {
+        if (colors != NULL) rlColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+        if (texcoords != NULL) rlTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        rlVertex3f(vertices[3*i], vertices[3*i + 1], vertices[3*i + 2]);
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlAppendVertexData(vertices, 3, texcoords, colors, vertexCount);
+#endif
+}
+
+// Define multiple vertex (position XY, texture coordinates UV and colors RGBA arrays)
+// NOTE: Same requirements than rlAppendVertices(), current depth is used for all the vertex
+void rlAppendVertices2D(const float *vertices, const float *texcoords, const unsigned char *colors, int vertexCount)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    for (int i = 0; i < vertexCount; i++)
+    {
+        if (colors != NULL) rlColor4ub(colors[4*i], colors[4*i + 1], colors[4*i + 2], colors[4*i + 3]);
+        if (texcoords != NULL) rlTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+        rlVertex2f(vertices[2*i], vertices[2*i + 1]);
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlAppendVertexData(vertices, 2, texcoords, colors, vertexCount);
+#endif
+}
+
 //--------------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL style functions (common to 1.1, 3.3+, ES2)
 //--------------------------------------------------------------------------------------
@@ -1530,6 +1794,20 @@ void rlSetTexture(unsigned int id)
         {
             rlDrawRenderBatch(RLGL.currentBatch);
         }
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        // Multi-texture batching: texture slots are kept between draws, default texture is selected
+        // if already available, otherwise it is only assigned a slot on next rlBegin() (-1 = pending)
+        if (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)
+        {
+            rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            RLGL.State.currentTextureSlot = -1;
+
+            for (int slot = 0; slot < draw->textureSlotCount; slot++)
+            {
+                if (draw->textureSlots[slot] == RLGL.State.defaultTextureId) RLGL.State.currentTextureSlot = slot;
+            }
+        }
+#endif
 #endif
     }
     else
@@ -1537,7 +1815,40 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
+        bool textureChange = (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id);
+
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        // Multi-texture batching: texture is assigned to a free slot of current draw,
+        // a new draw is only registered when all texture slots are in use
+        // NOTE: Only supported by default shader, custom shaders keep one texture per draw
+        if (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)
+        {
+            rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            int slot = 0;
+
+            while ((slot < draw->textureSlotCount) && (draw->textureSlots[slot] != id)) slot++;
+
+            // NOTE: Texture slots of an empty draw are not referenced by any vertex, they can be reset
+            if ((slot == draw->textureSlotCount) && (draw->vertexCount == 0))
+            {
+                draw->textureId = id;
+                draw->textureSlotCount = 0;
+                slot = 0;
+            }
+
+            // NOTE: On batch sorting mode draws keep one texture, so they can be grouped by texture
+            if ((slot == draw->textureSlotCount) && ((slot == 0) || (!RLGL.State.batchSorting && (slot < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS))))
+            {
+                draw->textureSlots[slot] = id;
+                draw->textureSlotCount++;
+            }
+
+            textureChange = (slot == draw->textureSlotCount);
+            if (!textureChange) RLGL.State.currentTextureSlot = slot;
+        }
+#endif
+
+        if (textureChange)
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
@@ -1562,11 +1873,77 @@ void rlSetTexture(unsigned int id)
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentLayer;
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[0] = id;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = 1;
+            RLGL.State.currentTextureSlot = 0;
+#endif
         }
 #endif
     }
 }
 
+// Enable batch sorting mode
+// NOTE: Current batch is drawn before changing mode
+void rlEnableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.batchSorting) rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.batchSorting = true;
+#endif
+}
+
+// Disable batch sorting mode
+void rlDisableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSorting) rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.batchSorting = false;
+    RLGL.State.currentLayer = 0;
+#endif
+}
+
+// Set current draw layer for batch sorting mode
+// NOTE: Layers are drawn in ascending order, draws inside a layer are grouped by texture,
+// new layer is applied on next rlBegin(), shader and blending mode changes still force
+// a batch draw, so they are never reordered
+void rlSetBatchLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.currentLayer = layer;
+#endif
+}
+
+// Get number of draw calls submitted since last counters reset
+int rlGetDrawCallCount(void)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    count = RLGL.State.drawCallCounter;
+#endif
+    return count;
+}
+
+// Get number of state changes (texture, shader, blending) since last counters reset
+int rlGetStateChangeCount(void)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    count = RLGL.State.stateChangeCounter;
+#endif
+    return count;
+}
+
+// Reset draw calls and state changes counters
+void rlResetDrawCounters(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.drawCallCounter = 0;
+    RLGL.State.stateChangeCounter = 0;
+#endif
+}
+
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
@@ -2014,6 +2391,7 @@ void rlSetBlendMode(int mode)
 
         RLGL.State.currentBlendMode = mode;
         RLGL.State.glCustomBlendModeModified = false;
+        RLGL.State.stateChangeCounter++;
     }
 #endif
 }
@@ -2216,6 +2594,12 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    // Unload batch sorting scratch buffers
+    RL_FREE(RLGL.State.sortVertices);
+    RL_FREE(RLGL.State.sortTexcoords);
+    RL_FREE(RLGL.State.sortColors);
+    RL_FREE(RLGL.State.sortTexslots);
+
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
@@ -2598,9 +2982,22 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+        batch.vertexBuffer[i].vertices = (unsigned short *)RL_MALLOC(bufferElements*3*4*sizeof(unsigned short));   // 3 half by vertex, 4 vertex by quad
+#else
         batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+#endif
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+        batch.vertexBuffer[i].texcoords = (unsigned short *)RL_MALLOC(bufferElements*2*4*sizeof(unsigned short));  // 2 unorm16 by texcoord, 4 texcoord by quad
+#else
         batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+#endif
         batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        batch.vertexBuffer[i].texslots = (unsigned char *)RL_CALLOC(bufferElements*4, sizeof(unsigned char));  // 1 byte by texture slot, 4 slots by quad
+#else
+        batch.vertexBuffer[i].texslots = NULL;
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2608,8 +3005,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0;
+        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0;
         for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
 
         int k = 0;
@@ -2648,16 +3045,16 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(batch.vertexBuffer[i].vertices[0]), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, RL_BATCH_POSITION_TYPE, 0, 0, 0);
 
         // Vertex texcoord buffer (shader-location = 1)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(batch.vertexBuffer[i].texcoords[0]), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_BATCH_TEXCOORD_TYPE, RL_BATCH_TEXCOORD_NORMALIZED, 0, 0);
 
         // Vertex color buffer (shader-location = 3)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
@@ -2666,6 +3063,15 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
 
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        // Vertex texture slot buffer (shader-location = 6)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(unsigned char), batch.vertexBuffer[i].texslots, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(6);
+        glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+#endif
+
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
@@ -2695,6 +3101,9 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = 0;
+        batch.draws[i].textureSlots[0] = RLGL.State.defaultTextureId;
+        batch.draws[i].textureSlotCount = 1;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2727,6 +3136,9 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glDisableVertexAttribArray(1);
             glDisableVertexAttribArray(2);
             glDisableVertexAttribArray(3);
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+            glDisableVertexAttribArray(6);
+#endif
             glBindVertexArray(0);
         }
 
@@ -2735,6 +3147,9 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+#endif
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
@@ -2743,6 +3158,7 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].colors);
+        RL_FREE(batch.vertexBuffer[i].texslots);
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2757,6 +3173,9 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Reorder batch draws if required, merging draws that share the same state
+    if (RLGL.State.batchSorting && (RLGL.State.vertexCounter > 0)) rlSortRenderBatch(batch);
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
@@ -2768,12 +3187,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(batch->vertexBuffer[batch->currentBuffer].vertices[0]), batch->vertexBuffer[batch->currentBuffer].vertices);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
 
         // Texture coordinates buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(batch->vertexBuffer[batch->currentBuffer].texcoords[0]), batch->vertexBuffer[batch->currentBuffer].texcoords);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
 
         // Colors buffer
@@ -2781,6 +3200,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
 
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        // Texture slots buffer
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].texslots);
+#endif
+
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
         // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
@@ -2827,6 +3252,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         {
             // Set current shader and upload current MVP matrix
             glUseProgram(RLGL.State.currentShaderId);
+            RLGL.State.stateChangeCounter++;
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -2843,12 +3269,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, RL_BATCH_POSITION_TYPE, 0, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
 
                 // Bind vertex attrib: texcoord (shader-location = 1)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_BATCH_TEXCOORD_TYPE, RL_BATCH_TEXCOORD_NORMALIZED, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
 
                 // Bind vertex attrib: color (shader-location = 3)
@@ -2856,6 +3282,13 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
 
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+                // Bind vertex attrib: texture slot (shader-location = 6)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
+                glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+                glEnableVertexAttribArray(6);
+#endif
+
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
             }
 
@@ -2878,10 +3311,51 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
+            unsigned int boundTextureId = 0;
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+            unsigned int boundTextureSlots[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS] = { 0 };
+            bool multiTexture = (RLGL.State.currentShaderId == RLGL.State.defaultShaderId);
+#endif
+
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                // Skip empty draws, they only keep alignment
+                if (batch->draws[i].vertexCount == 0)
+                {
+                    vertexOffset += batch->draws[i].vertexAlignment;
+                    continue;
+                }
+
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+                // Bind current draw call textures, every texture slot is activated as GL_TEXTURE0 + slot
+                // NOTE: Texture units are only bound if they change from previous draw
+                if (multiTexture)
+                {
+                    for (int slot = 0; slot < batch->draws[i].textureSlotCount; slot++)
+                    {
+                        if (batch->draws[i].textureSlots[slot] != boundTextureSlots[slot])
+                        {
+                            glActiveTexture(GL_TEXTURE0 + slot);
+                            glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureSlots[slot]);
+                            boundTextureSlots[slot] = batch->draws[i].textureSlots[slot];
+                            RLGL.State.stateChangeCounter++;
+                        }
+                    }
+
+                    glActiveTexture(GL_TEXTURE0);
+                }
+                else
+#endif
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                // NOTE: Texture is only bound if it changes from previous draw
+                if (batch->draws[i].textureId != boundTextureId)
+                {
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                    boundTextureId = batch->draws[i].textureId;
+                    RLGL.State.stateChangeCounter++;
+                }
+
+                RLGL.State.drawCallCounter++;
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -2936,8 +3410,13 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.currentLayer;
+        batch->draws[i].textureSlots[0] = RLGL.State.defaultTextureId;
+        batch->draws[i].textureSlotCount = 1;
     }
 
+    RLGL.State.currentTextureSlot = 0;
+
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
@@ -2982,21 +3461,224 @@ bool rlCheckRenderBatchLimit(int vCount)
     {
         overflow = true;
 
-        // Store current primitive drawing mode and texture id
-        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
-        int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+        // Store current primitive drawing mode, texture id, layer and texture slots
+        rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        int currentTextureSlot = RLGL.State.currentTextureSlot;
 
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
-        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentDraw.mode;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentDraw.textureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = currentDraw.layer;
+        for (int i = 0; i < currentDraw.textureSlotCount; i++) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlots[i] = currentDraw.textureSlots[i];
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureSlotCount = currentDraw.textureSlotCount;
+        RLGL.State.currentTextureSlot = currentTextureSlot;
     }
 #endif
 
     return overflow;
 }
 
+// Render batch recorders management
+//------------------------------------------------------------------------------------------------
+// Load batch recorder
+// NOTE: Only CPU memory is allocated, arrays grow on demand while recording
+rlBatchRecorder rlLoadBatchRecorder(int vertexCapacity)
+{
+    rlBatchRecorder recorder = { 0 };
+
+    if (vertexCapacity < 4) vertexCapacity = 4;
+
+    recorder.vertexCapacity = vertexCapacity;
+    recorder.vertices = (float *)RL_MALLOC(vertexCapacity*3*sizeof(float));
+    recorder.texcoords = (float *)RL_MALLOC(vertexCapacity*2*sizeof(float));
+    recorder.colors = (unsigned char *)RL_MALLOC(vertexCapacity*4*sizeof(unsigned char));
+
+    recorder.drawCapacity = 32;
+    recorder.draws = (rlDrawCall *)RL_MALLOC(recorder.drawCapacity*sizeof(rlDrawCall));
+
+    recorder.transform = rlMatrixIdentity();
+    rlResetBatchRecorder(&recorder);
+
+    return recorder;
+}
+
+// Unload batch recorder data
+void rlUnloadBatchRecorder(rlBatchRecorder recorder)
+{
+    RL_FREE(recorder.vertices);
+    RL_FREE(recorder.texcoords);
+    RL_FREE(recorder.colors);
+    RL_FREE(recorder.draws);
+}
+
+// Reset batch recorder to record new data
+// NOTE: Allocated memory is kept, so recorders can be reused every frame
+void rlResetBatchRecorder(rlBatchRecorder *recorder)
+{
+    recorder->vertexCounter = 0;
+    recorder->drawCounter = 0;
+    recorder->currentMode = RL_QUADS;
+    recorder->currentTexture = 0;
+    recorder->texcoordx = 0.0f;
+    recorder->texcoordy = 0.0f;
+    recorder->colorr = 255;
+    recorder->colorg = 255;
+    recorder->colorb = 255;
+    recorder->colora = 255;
+    recorder->currentDepth = -1.0f;
+}
+
+// Initialize recording mode (how to organize vertex)
+void rlRecordBegin(rlBatchRecorder *recorder, int mode)
+{
+    recorder->currentMode = mode;
+}
+
+// Finish vertex recording
+void rlRecordEnd(rlBatchRecorder *recorder)
+{
+    // NOTE: Same depth increment than rlEnd()
+    recorder->currentDepth += (1.0f/20000.0f);
+}
+
+// Set recording texture
+void rlRecordSetTexture(rlBatchRecorder *recorder, unsigned int id)
+{
+    recorder->currentTexture = id;
+}
+
+// Set transform applied to next recorded vertex
+void rlRecordSetTransform(rlBatchRecorder *recorder, Matrix transform)
+{
+    recorder->transform = transform;
+    recorder->transformRequired = true;
+}
+
+// Reset recording transform to identity
+void rlRecordResetTransform(rlBatchRecorder *recorder)
+{
+    recorder->transform = rlMatrixIdentity();
+    recorder->transformRequired = false;
+}
+
+// Record one vertex (position)
+void rlRecordVertex3f(rlBatchRecorder *recorder, float x, float y, float z)
+{
+    float tx = x;
+    float ty = y;
+    float tz = z;
+
+    // Transform provided vector if required
+    if (recorder->transformRequired)
+    {
+        tx = recorder->transform.m0*x + recorder->transform.m4*y + recorder->transform.m8*z + recorder->transform.m12;
+        ty = recorder->transform.m1*x + recorder->transform.m5*y + recorder->transform.m9*z + recorder->transform.m13;
+        tz = recorder->transform.m2*x + recorder->transform.m6*y + recorder->transform.m10*z + recorder->transform.m14;
+    }
+
+    // Grow vertex arrays if required
+    if (recorder->vertexCounter >= recorder->vertexCapacity)
+    {
+        recorder->vertexCapacity *= 2;
+        recorder->vertices = (float *)RL_REALLOC(recorder->vertices, recorder->vertexCapacity*3*sizeof(float));
+        recorder->texcoords = (float *)RL_REALLOC(recorder->texcoords, recorder->vertexCapacity*2*sizeof(float));
+        recorder->colors = (unsigned char *)RL_REALLOC(recorder->colors, recorder->vertexCapacity*4*sizeof(unsigned char));
+    }
+
+    // A new draw is registered every time mode or texture changes
+    if ((recorder->drawCounter == 0) ||
+        (recorder->draws[recorder->drawCounter - 1].mode != recorder->currentMode) ||
+        (recorder->draws[recorder->drawCounter - 1].textureId != recorder->currentTexture))
+    {
+        if (recorder->drawCounter >= recorder->drawCapacity)
+        {
+            recorder->drawCapacity *= 2;
+            recorder->draws = (rlDrawCall *)RL_REALLOC(recorder->draws, recorder->drawCapacity*sizeof(rlDrawCall));
+        }
+
+        recorder->draws[recorder->drawCounter].mode = recorder->currentMode;
+        recorder->draws[recorder->drawCounter].vertexCount = 0;
+        recorder->draws[recorder->drawCounter].vertexAlignment = 0;
+        recorder->draws[recorder->drawCounter].textureId = recorder->currentTexture;
+        recorder->drawCounter++;
+    }
+
+    int index = recorder->vertexCounter;
+
+    recorder->vertices[3*index] = tx;
+    recorder->vertices[3*index + 1] = ty;
+    recorder->vertices[3*index + 2] = tz;
+
+    recorder->texcoords[2*index] = recorder->texcoordx;
+    recorder->texcoords[2*index + 1] = recorder->texcoordy;
+
+    recorder->colors[4*index] = recorder->colorr;
+    recorder->colors[4*index + 1] = recorder->colorg;
+    recorder->colors[4*index + 2] = recorder->colorb;
+    recorder->colors[4*index + 3] = recorder->colora;
+
+    recorder->vertexCounter++;
+    recorder->draws[recorder->drawCounter - 1].vertexCount++;
+}
+
+// Record one vertex (position)
+void rlRecordVertex2f(rlBatchRecorder *recorder, float x, float y)
+{
+    rlRecordVertex3f(recorder, x, y, recorder->currentDepth);
+}
+
+// Record one vertex (texture coordinate)
+void rlRecordTexCoord2f(rlBatchRecorder *recorder, float x, float y)
+{
+    recorder->texcoordx = x;
+    recorder->texcoordy = y;
+}
+
+// Record one vertex (color)
+void rlRecordColor4ub(rlBatchRecorder *recorder, unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    recorder->colorr = r;
+    recorder->colorg = g;
+    recorder->colorb = b;
+    recorder->colora = a;
+}
+
+// Submit recorded data to active render batch
+// NOTE: Recorded draws are appended in order, vertex data is copied in blocks, batch is
+// flushed if required but primitives are never split between batches
+void rlSubmitBatchRecorder(const rlBatchRecorder *recorder)
+{
+    for (int i = 0, vertexOffset = 0; i < recorder->drawCounter; i++)
+    {
+        const rlDrawCall *draw = &recorder->draws[i];
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        unsigned int textureId = (draw->textureId == 0)? RLGL.State.defaultTextureId : draw->textureId;
+
+        rlBegin(draw->mode);
+        rlSetTexture(textureId);
+
+        // NOTE: rlSetTexture() could register a new draw, it must keep the recorded mode
+        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount == 0) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = draw->mode;
+
+        rlAppendVertices(recorder->vertices + 3*vertexOffset, recorder->texcoords + 2*vertexOffset, recorder->colors + 4*vertexOffset, draw->vertexCount);
+
+        rlEnd();
+#else
+        // OpenGL 1.1 fallback: Vertex are provided one by one (inside rlAppendVertices())
+        rlSetTexture(draw->textureId);
+        rlBegin(draw->mode);
+        rlAppendVertices(recorder->vertices + 3*vertexOffset, recorder->texcoords + 2*vertexOffset, recorder->colors + 4*vertexOffset, draw->vertexCount);
+        rlEnd();
+#endif
+        vertexOffset += draw->vertexCount;
+    }
+
+    rlSetTexture(0);
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -4012,6 +4694,9 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+    glBindAttribLocation(program, 6, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXSLOT);
+#endif
 
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
@@ -4601,10 +5286,382 @@ const char *rlGetPixelFormatName(unsigned int format)
     }
 }
 
+// Convert float to half-float (16 bit) value
+// NOTE: Rounding to nearest even, denormals supported, values out of range converted to infinity
+unsigned short rlFloatToHalf(float value)
+{
+    union { float f; unsigned int u; } bits = { value };
+    unsigned int sign = (bits.u >> 16) & 0x8000;
+    unsigned int absolute = bits.u & 0x7fffffff;
+    unsigned int result = 0;
+
+    if (absolute > 0x7f800000) result = 0x7e00;                 // NaN
+    else if (absolute >= 0x477ff000) result = 0x7c00;           // Infinity (or rounded to infinity)
+    else if (absolute >= 0x38800000)                            // Normalized
+    {
+        unsigned int remainder = absolute & 0x1fff;
+
+        result = (absolute - 0x38000000) >> 13;                 // Exponent rebias (127 - 15) and mantissa truncation
+        if ((remainder > 0x1000) || ((remainder == 0x1000) && (result & 1))) result++;
+    }
+    else if (absolute >= 0x33000000)                            // Denormalized
+    {
+        unsigned int mantissa = (absolute & 0x007fffff) | 0x00800000;
+        unsigned int shift = 126 - (absolute >> 23);
+        unsigned int remainder = mantissa & ((1u << shift) - 1);
+        unsigned int halfway = 1u << (shift - 1);
+
+        result = mantissa >> shift;
+        if ((remainder > halfway) || ((remainder == halfway) && (result & 1))) result++;
+    }
+
+    return (unsigned short)(sign | result);
+}
+
+// Convert half-float (16 bit) value to float
+float rlHalfToFloat(unsigned short value)
+{
+    union { float f; unsigned int u; } bits = { 0 };
+    unsigned int exponent = (value >> 10) & 0x1f;
+    unsigned int mantissa = value & 0x3ff;
+
+    if (exponent == 0x1f) bits.u = 0x7f800000 | (mantissa << 13);              // Infinity or NaN
+    else if (exponent > 0) bits.u = ((exponent + 112) << 23) | (mantissa << 13); // Normalized
+    else bits.f = (float)mantissa*5.9604644775390625e-8f;                       // Denormalized (mantissa*2^-24)
+
+    bits.u |= (unsigned int)(value & 0x8000) << 16;
+
+    return bits.f;
+}
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Check if two draws share the same state (mode and textures) and can be merged
+static bool rlDrawCallMergeable(const rlDrawCall *a, const rlDrawCall *b)
+{
+    bool mergeable = (a->textureId == b->textureId) && (a->mode == b->mode);
+
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+    // NOTE: Vertex texture slots are only valid for the same texture slots table
+    if (mergeable) mergeable = (a->textureSlotCount == b->textureSlotCount) &&
+        (memcmp(a->textureSlots, b->textureSlots, a->textureSlotCount*sizeof(unsigned int)) == 0);
+#endif
+
+    return mergeable;
+}
+
+// Append vertex arrays to current draw
+// NOTE: Batch space is reserved once per block of vertex, positions are transformed in a tight loop
+// and attributes are copied straight into batch buffers (converted if compact vertex format enabled)
+static void rlAppendVertexData(const float *vertices, int components, const float *texcoords, const unsigned char *colors, int vertexCount)
+{
+    int mode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+    int primitiveSize = (mode == RL_LINES)? 2 : ((mode == RL_TRIANGLES)? 3 : 4);
+    Matrix mat = RLGL.State.transformRequired? RLGL.State.transform : rlMatrixIdentity();
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+    float position[3*64] = { 0 };
+#endif
+
+    for (int appended = 0; appended < vertexCount; )
+    {
+        // Make sure at least one primitive fits in current batch, same limits check as rlVertex3f()
+        if (RLGL.State.vertexCounter > (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4)) rlCheckRenderBatchLimit(primitiveSize + 1);
+
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+        int available = buffer->elementCount*4 - RLGL.State.vertexCounter;
+        int count = vertexCount - appended;
+        if (count > available) count = available - available%primitiveSize;
+
+        int offset = RLGL.State.vertexCounter;
+        float depth = RLGL.currentBatch->currentDepth;
+        const float *source = vertices + components*appended;
+
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+        // Positions: transformed by blocks of vertex and converted to half-float
+        for (int block = 0; block < count; block += 64)
+        {
+            int blockCount = ((count - block) < 64)? (count - block) : 64;
+            unsigned short *target = buffer->vertices + 3*(offset + block);
+
+            rlTransformPositions(position, source + components*block, components, depth, mat, blockCount);
+            for (int i = 0; i < 3*blockCount; i++) target[i] = rlPackBatchPosition(position[i]);
+        }
+#else
+        // Positions: transformed (or copied) straight into batch buffer
+        float *target = buffer->vertices + 3*offset;
+
+        if (RLGL.State.transformRequired) rlTransformPositions(target, source, components, depth, mat, count);
+        else if (components == 3) memcpy(target, source, count*3*sizeof(float));
+        else
+        {
+            for (int v = 0; v < count; v++)
+            {
+                target[3*v] = source[2*v];
+                target[3*v + 1] = source[2*v + 1];
+                target[3*v + 2] = depth;
+            }
+        }
+#endif
+
+        // Texture coordinates: copied if provided, current texcoord otherwise
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+        for (int v = 0; v < count; v++)
+        {
+            float u = (texcoords != NULL)? texcoords[2*(appended + v)] : RLGL.State.texcoordx;
+            float t = (texcoords != NULL)? texcoords[2*(appended + v) + 1] : RLGL.State.texcoordy;
+
+            buffer->texcoords[2*(offset + v)] = rlFloatToUnorm16(u);
+            buffer->texcoords[2*(offset + v) + 1] = rlFloatToUnorm16(t);
+        }
+#else
+        if (texcoords != NULL) memcpy(buffer->texcoords + 2*offset, texcoords + 2*appended, count*2*sizeof(float));
+        else
+        {
+            for (int v = 0; v < count; v++)
+            {
+                buffer->texcoords[2*(offset + v)] = RLGL.State.texcoordx;
+                buffer->texcoords[2*(offset + v) + 1] = RLGL.State.texcoordy;
+            }
+        }
+#endif
+
+        // Colors: copied if provided, current color otherwise
+        if (colors != NULL) memcpy(buffer->colors + 4*offset, colors + 4*appended, count*4*sizeof(unsigned char));
+        else
+        {
+            unsigned char color[4] = { RLGL.State.colorr, RLGL.State.colorg, RLGL.State.colorb, RLGL.State.colora };
+            for (int v = 0; v < count; v++) memcpy(buffer->colors + 4*(offset + v), color, 4);
+        }
+
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        memset(buffer->texslots + offset, RLGL.State.currentTextureSlot, count*sizeof(unsigned char));
+#endif
+
+        RLGL.State.vertexCounter += count;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count;
+        appended += count;
+    }
+
+    // Leave current texcoord and color as the last provided ones, same as immediate mode
+    if ((vertexCount > 0) && (texcoords != NULL))
+    {
+        RLGL.State.texcoordx = texcoords[2*(vertexCount - 1)];
+        RLGL.State.texcoordy = texcoords[2*(vertexCount - 1) + 1];
+    }
+
+    if ((vertexCount > 0) && (colors != NULL))
+    {
+        RLGL.State.colorr = colors[4*(vertexCount - 1)];
+        RLGL.State.colorg = colors[4*(vertexCount - 1) + 1];
+        RLGL.State.colorb = colors[4*(vertexCount - 1) + 2];
+        RLGL.State.colora = colors[4*(vertexCount - 1) + 3];
+    }
+}
+
+// Transform vertex positions by matrix, XY positions (components = 2) use depth as Z
+// NOTE: Operations order matches rlVertex3f() so results are the same, SSE2 path computes
+// one vertex XYZ per register: columns scaled by broadcasted coordinates
+static void rlTransformPositions(float *result, const float *positions, int components, float depth, Matrix mat, int count)
+{
+    int v = 0;
+
+#if defined(RLGL_SIMD_SSE2)
+    __m128 col0 = _mm_setr_ps(mat.m0, mat.m1, mat.m2, 0.0f);
+    __m128 col1 = _mm_setr_ps(mat.m4, mat.m5, mat.m6, 0.0f);
+    __m128 col2 = _mm_setr_ps(mat.m8, mat.m9, mat.m10, 0.0f);
+    __m128 col3 = _mm_setr_ps(mat.m12, mat.m13, mat.m14, 0.0f);
+    __m128 z = _mm_mul_ps(col2, _mm_set1_ps(depth));
+
+    // NOTE: Every vertex stores 4 floats, 4th one is overwritten by next vertex,
+    // last vertex is transformed by scalar code to avoid writing past the end
+    if (components == 3)
+    {
+        for (; v < (count - 1); v++)
+        {
+            __m128 x = _mm_mul_ps(col0, _mm_load1_ps(positions + 3*v));
+            __m128 y = _mm_mul_ps(col1, _mm_load1_ps(positions + 3*v + 1));
+            __m128 z3 = _mm_mul_ps(col2, _mm_load1_ps(positions + 3*v + 2));
+
+            _mm_storeu_ps(result + 3*v, _mm_add_ps(_mm_add_ps(_mm_add_ps(x, y), z3), col3));
+        }
+    }
+    else
+    {
+        for (; v < (count - 1); v++)
+        {
+            __m128 x = _mm_mul_ps(col0, _mm_load1_ps(positions + 2*v));
+            __m128 y = _mm_mul_ps(col1, _mm_load1_ps(positions + 2*v + 1));
+
+            _mm_storeu_ps(result + 3*v, _mm_add_ps(_mm_add_ps(_mm_add_ps(x, y), z), col3));
+        }
+    }
+#endif
+
+    for (; v < count; v++)
+    {
+        float x = positions[components*v];
+        float y = positions[components*v + 1];
+        float z = (components == 3)? positions[3*v + 2] : depth;
+
+        result[3*v] = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[3*v + 1] = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        result[3*v + 2] = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
+#if defined(RLGL_ENABLE_BATCH_HALF_POSITIONS)
+// Convert batch vertex position component to half-float
+// NOTE: Precision is lower than one unit beyond 2048, warned once (batch stays in compact format)
+static unsigned short rlPackBatchPosition(float x)
+{
+    if (((x > 2048.0f) || (x < -2048.0f)) && !RLGL.State.compactPositionsWarned)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Vertex position out of half-float precise range [-2048..2048] (RLGL_ENABLE_BATCH_HALF_POSITIONS)");
+        RLGL.State.compactPositionsWarned = true;
+    }
+
+    return rlFloatToHalf(x);
+}
+#endif
+
+#if defined(RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)
+// Convert float to 16-bit normalized value (batch texture coordinates)
+// NOTE: Value is clamped to [0..1] range, texture repeat coordinates are warned once
+static unsigned short rlFloatToUnorm16(float x)
+{
+    unsigned short result = 0;
+
+    if ((x >= 0.0f) && (x <= 1.0f)) result = (unsigned short)(x*65535.0f + 0.5f);
+    else
+    {
+        if (!RLGL.State.compactTexcoordsWarned)
+        {
+            TRACELOG(RL_LOG_WARNING, "RLGL: Texture coordinates out of [0..1] range clamped (RLGL_ENABLE_BATCH_COMPACT_TEXCOORDS)");
+            RLGL.State.compactTexcoordsWarned = true;
+        }
+
+        result = (x > 1.0f)? 65535 : 0;
+    }
+
+    return result;
+}
+#endif
+
+// Sort render batch draws by layer and texture (batch sorting mode)
+// NOTE: Draws are stably sorted by (layer, texture, mode), vertex data is reordered to
+// keep sorted draws contiguous and consecutive draws sharing the same state are merged
+static void rlSortRenderBatch(rlRenderBatch *batch)
+{
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int offsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    bool sorted = true;
+
+    // Get draws vertex offsets and sort draws indices (insertion sort, stable)
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        offsets[i] = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+
+        int j = i;
+        for (; j > 0; j--)
+        {
+            const rlDrawCall *prev = &batch->draws[order[j - 1]];
+            const rlDrawCall *draw = &batch->draws[i];
+
+            bool greater = (prev->layer > draw->layer) ||
+                ((prev->layer == draw->layer) && (prev->textureId > draw->textureId)) ||
+                ((prev->layer == draw->layer) && (prev->textureId == draw->textureId) && (prev->mode > draw->mode));
+
+            if (!greater) break;
+
+            order[j] = order[j - 1];
+            sorted = false;
+        }
+        order[j] = i;
+    }
+
+    // Count draws that could be merged if already ordered
+    if (sorted)
+    {
+        for (int i = 1; i < batch->drawCounter; i++)
+        {
+            if (rlDrawCallMergeable(&batch->draws[i - 1], &batch->draws[i]) && (batch->draws[i].vertexCount > 0)) sorted = false;
+        }
+    }
+
+    if (sorted) return;
+
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int capacity = buffer->elementCount*4;
+
+    // NOTE: Vertex data is copied as raw bytes, it depends on batch vertex format
+    int positionSize = 3*sizeof(buffer->vertices[0]);
+    int texcoordSize = 2*sizeof(buffer->texcoords[0]);
+
+    // Resize scratch buffers if required
+    if (RLGL.State.sortCapacity < capacity)
+    {
+        RLGL.State.sortVertices = RL_REALLOC(RLGL.State.sortVertices, capacity*positionSize);
+        RLGL.State.sortTexcoords = RL_REALLOC(RLGL.State.sortTexcoords, capacity*texcoordSize);
+        RLGL.State.sortColors = (unsigned char *)RL_REALLOC(RLGL.State.sortColors, capacity*4*sizeof(unsigned char));
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        RLGL.State.sortTexslots = (unsigned char *)RL_REALLOC(RLGL.State.sortTexslots, capacity*sizeof(unsigned char));
+#endif
+        RLGL.State.sortCapacity = capacity;
+    }
+
+    rlDrawCall draws[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int drawCounter = 0;
+    int vertexCounter = 0;
+
+    for (int i = 0; i < batch->drawCounter; i++)
+    {
+        const rlDrawCall *draw = &batch->draws[order[i]];
+        if (draw->vertexCount == 0) continue;
+
+        // Merge with previous draw if state is the same, otherwise align and register a new draw
+        // NOTE: QUADS draws must start at a multiple of 4 vertex for index processing
+        if ((drawCounter == 0) || !rlDrawCallMergeable(&draws[drawCounter - 1], draw))
+        {
+            if (drawCounter > 0)
+            {
+                draws[drawCounter - 1].vertexAlignment = (4 - vertexCounter%4)%4;
+                vertexCounter += draws[drawCounter - 1].vertexAlignment;
+            }
+
+            draws[drawCounter] = *draw;
+            draws[drawCounter].vertexCount = 0;
+            draws[drawCounter].vertexAlignment = 0;
+            drawCounter++;
+        }
+
+        memcpy((unsigned char *)RLGL.State.sortVertices + vertexCounter*positionSize, buffer->vertices + 3*offsets[order[i]], draw->vertexCount*positionSize);
+        memcpy((unsigned char *)RLGL.State.sortTexcoords + vertexCounter*texcoordSize, buffer->texcoords + 2*offsets[order[i]], draw->vertexCount*texcoordSize);
+        memcpy(RLGL.State.sortColors + 4*vertexCounter, buffer->colors + 4*offsets[order[i]], draw->vertexCount*4*sizeof(unsigned char));
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        memcpy(RLGL.State.sortTexslots + vertexCounter, buffer->texslots + offsets[order[i]], draw->vertexCount*sizeof(unsigned char));
+#endif
+
+        draws[drawCounter - 1].vertexCount += draw->vertexCount;
+        vertexCounter += draw->vertexCount;
+    }
+
+    // Copy sorted data back into batch
+    memcpy(buffer->vertices, RLGL.State.sortVertices, vertexCounter*positionSize);
+    memcpy(buffer->texcoords, RLGL.State.sortTexcoords, vertexCounter*texcoordSize);
+    memcpy(buffer->colors, RLGL.State.sortColors, vertexCounter*4*sizeof(unsigned char));
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+    memcpy(buffer->texslots, RLGL.State.sortTexslots, vertexCounter*sizeof(unsigned char));
+#endif
+
+    if (drawCounter == 0) drawCounter = 1;
+    for (int i = 0; i < drawCounter; i++) batch->draws[i] = draws[i];
+    batch->drawCounter = drawCounter;
+    RLGL.State.vertexCounter = vertexCounter;
+}
+
 // Load default shader (just vertex positioning and texture coloring)
 // NOTE: This shader program is used for internal buffers
 // NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
@@ -4694,7 +5751,59 @@ static void rlLoadShaderDefault(void)
     RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
     RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
 
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+    // Multi-texture batching: default shader program selects the texture sampled by vertex texture slot
+    // NOTE: Samplers can not be indexed dynamically on GLSL 100/120/330, one branch per slot is generated,
+    // previous default shaders are kept to be combined with custom shaders on rlLoadShaderCode()
+#if defined(GRAPHICS_API_OPENGL_21)
+    const char *glslHeader = "#version 120\n";
+    const char *glslAttribute = "attribute", *glslVaryingOut = "varying", *glslVaryingIn = "varying";
+    const char *glslTexture = "texture2D", *glslOutput = "", *glslFragColor = "gl_FragColor";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    const char *glslHeader = "#version 330\n";
+    const char *glslAttribute = "in", *glslVaryingOut = "out", *glslVaryingIn = "in";
+    const char *glslTexture = "texture", *glslOutput = "out vec4 finalColor;\n", *glslFragColor = "finalColor";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const char *glslHeader = "#version 100\nprecision mediump float;\n";
+    const char *glslAttribute = "attribute", *glslVaryingOut = "varying", *glslVaryingIn = "varying";
+    const char *glslTexture = "texture2D", *glslOutput = "", *glslFragColor = "gl_FragColor";
+#endif
+    char multiVShaderCode[1024] = { 0 };
+    char multiFShaderCode[1024 + 96*RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS] = { 0 };
+
+    snprintf(multiVShaderCode, sizeof(multiVShaderCode),
+        "%s%s vec3 vertexPosition;\n%s vec2 vertexTexCoord;\n%s vec4 vertexColor;\n%s float vertexTexSlot;\n"
+        "%s vec2 fragTexCoord;\n%s vec4 fragColor;\n%s float fragTexSlot;\n"
+        "uniform mat4 mvp;\nvoid main()\n{\n"
+        "    fragTexCoord = vertexTexCoord;\n    fragColor = vertexColor;\n    fragTexSlot = vertexTexSlot;\n"
+        "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n}\n",
+        glslHeader, glslAttribute, glslAttribute, glslAttribute, glslAttribute, glslVaryingOut, glslVaryingOut, glslVaryingOut);
+
+    int length = snprintf(multiFShaderCode, sizeof(multiFShaderCode),
+        "%s%s vec2 fragTexCoord;\n%s vec4 fragColor;\n%s float fragTexSlot;\n%s"
+        "uniform sampler2D textures[%i];\nuniform vec4 colDiffuse;\nvoid main()\n{\n    vec4 texelColor = vec4(1.0);\n",
+        glslHeader, glslVaryingIn, glslVaryingIn, glslVaryingIn, glslOutput, RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS);
+
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        length += snprintf(multiFShaderCode + length, sizeof(multiFShaderCode) - length,
+            "    %sif (fragTexSlot < %i.5) texelColor = %s(textures[%i], fragTexCoord);\n", (i > 0)? "else " : "", i, glslTexture, i);
+    }
+
+    snprintf(multiFShaderCode + length, sizeof(multiFShaderCode) - length, "    %s = texelColor*colDiffuse*fragColor;\n}\n", glslFragColor);
+
+    unsigned int multiVShaderId = rlCompileShader(multiVShaderCode, GL_VERTEX_SHADER);
+    unsigned int multiFShaderId = rlCompileShader(multiFShaderCode, GL_FRAGMENT_SHADER);
+
+    RLGL.State.defaultShaderId = rlLoadShaderProgram(multiVShaderId, multiFShaderId);
+
+    // NOTE: Shaders are flagged for deletion, they are released with the program
+    glDeleteShader(multiVShaderId);
+    glDeleteShader(multiFShaderId);
+#else
     RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+#endif
 
     if (RLGL.State.defaultShaderId > 0)
     {
@@ -4708,7 +5817,19 @@ static void rlLoadShaderDefault(void)
         // Set default shader locations: uniform locations
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
+#if defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "textures");
+
+        // Set texture slots samplers to texture units, they never change
+        int textureUnits[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS] = { 0 };
+        for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) textureUnits[i] = i;
+
+        glUseProgram(RLGL.State.defaultShaderId);
+        glUniform1iv(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS, textureUnits);
+        glUseProgram(0);
+#else
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+#endif
     }
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
@@ -4719,8 +5840,10 @@ static void rlUnloadShaderDefault(void)
 {
     glUseProgram(0);
 
+#if !defined(RLGL_ENABLE_BATCH_MULTITEXTURE)
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
+#endif
     glDeleteShader(RLGL.State.defaultVShaderId);
     glDeleteShader(RLGL.State.defaultFShaderId);
 
@@ -4847,13 +5970,12 @@ static int rlGetPixelDataSize(int width, int height, int format)
 
     dataSize = width*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
-    }
+    // Most compressed formats works on 4x4 blocks, partial blocks are stored complete
+    // NOTE: ASTC 8x8 works on 8x8 blocks (16 bytes), PVRT minimum size is 8x8 pixels
+    if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)) dataSize = ((width < 8)? 8 : width)*((height < 8)? 8 : height)*bpp/8;
+    else if (format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) dataSize = ((width + 3)/4)*((height + 3)/4)*16;
+    else if (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) dataSize = ((width + 7)/8)*((height + 7)/8)*16;
 
     return dataSize;
 }
@@ -1960,24 +1960,25 @@ static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, i
         materials[m] = LoadMaterialDefault();
 
         // Get default texture, in case no texture is defined
-        // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
+        // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8,
+        // textures are loaded through resources cache, shared between materials and released by UnloadMaterial()
         materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureCached(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
         else materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2] * 255.0f), 255 }; //float diffuse[3];
         materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureCached(mats[m].specular_texname);  //char *specular_texname; // map_Ks
         materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2] * 255.0f), 255 }; //float specular[3];
         materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureCached(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
         materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2] * 255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTextureCached(mats[m].displacement_texname);  //char *displacement_texname; // disp
     }
 }
 #endif
@@ -2046,11 +2047,14 @@ void UnloadMaterial(Material material)
     if (material.shader.id != rlGetShaderIdDefault()) UnloadShader(material.shader);
 
     // Unload loaded texture maps (avoid unloading default texture, managed by raylib)
+    // NOTE: Textures loaded through resources cache are released, unloaded once not referenced
     if (material.maps != NULL)
     {
         for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
         {
-            if (material.maps[i].texture.id != rlGetTextureIdDefault()) rlUnloadTexture(material.maps[i].texture.id);
+            unsigned int id = material.maps[i].texture.id;
+
+            if ((id > 0) && (id != rlGetTextureIdDefault()) && !ReleaseCachedResource(RESOURCE_TEXTURE, id)) rlUnloadTexture(id);
         }
     }
 
@@ -2098,6 +2102,20 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
+        // Bones rotation (frame pose rotation*inverse bind pose rotation) is the same for all vertices,
+        // computed once per bone with a batch quaternion multiplication
+        int boneCount = (anim.boneCount < model.boneCount)? anim.boneCount : model.boneCount;
+        Quaternion *boneRotations = (Quaternion *)RL_MALLOC(2*boneCount*sizeof(Quaternion));
+        Quaternion *bindRotations = boneRotations + boneCount;
+
+        for (int b = 0; b < boneCount; b++)
+        {
+            boneRotations[b] = anim.framePoses[frame][b].rotation;
+            bindRotations[b] = QuaternionInvert(model.bindPose[b].rotation);
+        }
+
+        QuaternionMultiplyArray(boneRotations, boneRotations, bindRotations, boneCount);
+
         for (int m = 0; m < model.meshCount; m++)
         {
             Mesh mesh = model.meshes[m];
@@ -2113,11 +2131,10 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
             Vector3 animNormal = { 0 };
 
             Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
             // Vector3 inScale = { 0 };
 
             Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
+            Quaternion boneRotation = { 0 };
             Vector3 outScale = { 0 };
 
             int boneId = 0;
@@ -2147,12 +2164,13 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                     if (boneWeight == 0.0f) continue;
 
                     boneId = mesh.boneIds[boneCounter];
+                    if (boneId >= boneCount) continue;
+
                     //int boneIdParent = model.bones[boneId].parent;
                     inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
                     //inScale = model.bindPose[boneId].scale;
                     outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
+                    boneRotation = boneRotations[boneId];
                     outScale = anim.framePoses[frame][boneId].scale;
 
                     // Vertices processing
@@ -2160,7 +2178,7 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                     animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
                     animVertex = Vector3Subtract(animVertex, inTranslation);
                     animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
+                    animVertex = Vector3RotateByQuaternion(animVertex, boneRotation);
                     animVertex = Vector3Add(animVertex, outTranslation);
                     //animVertex = Vector3Transform(animVertex, model.transform);
                     mesh.animVertices[vCounter] += animVertex.x*boneWeight;
@@ -2173,7 +2191,7 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                     if (mesh.normals != NULL)
                     {
                         animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
+                        animNormal = Vector3RotateByQuaternion(animNormal, boneRotation);
                         mesh.animNormals[vCounter] += animNormal.x*boneWeight;
                         mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
                         mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
@@ -2189,6 +2207,8 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                 rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
             }
         }
+
+        RL_FREE(boneRotations);
     }
 }
 
@@ -3459,28 +3479,48 @@ void GenMeshTangents(Mesh *mesh)
     }
 
     // Compute tangents considering normals
+    // NOTE: Vectors normalization is processed for all vertices at once (batch processing)
+    // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
+#if defined(COMPUTE_TANGENTS_METHOD_01)
     for (int i = 0; i < mesh->vertexCount; i++)
     {
         Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        Vector3 tangent = tan1[i];
 
-        // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
-#if defined(COMPUTE_TANGENTS_METHOD_01)
-        Vector3 tmp = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
-        tmp = Vector3Normalize(tmp);
-        mesh->tangents[i*4 + 0] = tmp.x;
-        mesh->tangents[i*4 + 1] = tmp.y;
-        mesh->tangents[i*4 + 2] = tmp.z;
+        tan1[i] = Vector3Subtract(tan1[i], Vector3Scale(normal, Vector3DotProduct(normal, tan1[i])));
+    }
+
+    Vector3NormalizeArray(tan1, tan1, mesh->vertexCount);
+
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        mesh->tangents[i*4 + 0] = tan1[i].x;
+        mesh->tangents[i*4 + 1] = tan1[i].y;
+        mesh->tangents[i*4 + 2] = tan1[i].z;
         mesh->tangents[i*4 + 3] = 1.0f;
+    }
 #else
-        Vector3OrthoNormalize(&normal, &tangent);
+    // Gram-Schmidt orthonormalization, equivalent to Vector3OrthoNormalize(&normal, &tangent)
+    Vector3 *normals = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+
+    Vector3NormalizeArray(normals, (Vector3 *)mesh->normals, mesh->vertexCount);
+
+    for (int i = 0; i < mesh->vertexCount; i++) tan1[i] = Vector3CrossProduct(normals[i], tan1[i]);
+
+    Vector3NormalizeArray(tan1, tan1, mesh->vertexCount);
+
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        Vector3 tangent = Vector3CrossProduct(tan1[i], normals[i]);
+
         mesh->tangents[i*4 + 0] = tangent.x;
         mesh->tangents[i*4 + 1] = tangent.y;
         mesh->tangents[i*4 + 2] = tangent.z;
-        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
-#endif
+        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normals[i], tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
     }
 
+    RL_FREE(normals);
+#endif
+
     RL_FREE(tan1);
     RL_FREE(tan2);
 
@@ -3871,11 +3911,16 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     {
         int triangleCount = mesh.triangleCount;
 
+        // Transform all mesh vertices at once, indexed meshes share transformed vertices between triangles
+        Vector3 *vertdata = (Vector3 *)RL_MALLOC(mesh.vertexCount*sizeof(Vector3));
+        if (vertdata == NULL) return collision;
+
+        Vector3TransformArray(vertdata, (Vector3 *)mesh.vertices, mesh.vertexCount, transform);
+
         // Test against all triangles in mesh
         for (int i = 0; i < triangleCount; i++)
         {
             Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
 
             if (mesh.indices)
             {
@@ -3890,10 +3935,6 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
                 c = vertdata[i*3 + 2];
             }
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
-
             RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
 
             if (triHitInfo.hit)
@@ -3902,6 +3943,8 @@ RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
                 if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
             }
         }
+
+        RL_FREE(vertdata);
     }
 
     return collision;
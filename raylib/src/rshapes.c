@@ -57,7 +57,8 @@
 
 #include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
 #include <float.h>      // Required for: FLT_EPSILON
-#include <stdlib.h>     // Required for: RL_FREE
+#include <stdlib.h>     // Required for: RL_FREE, RL_REALLOC
+#include <string.h>     // Required for: memcpy()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -70,11 +71,66 @@
 #ifndef SPLINE_SEGMENT_DIVISIONS
     #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
 #endif
+#ifndef SPLINE_SEGMENT_ERROR_RATE
+    #define SPLINE_SEGMENT_ERROR_RATE  0.25f      // Spline max distance between curve and its subdivision (adaptive), in world units
+#endif
+#ifndef SPLINE_SEGMENT_MAX_DIVISIONS
+    #define SPLINE_SEGMENT_MAX_DIVISIONS  64      // Spline segment max divisions (adaptive)
+#endif
+#ifndef SPLINE_MITER_LIMIT
+    #define SPLINE_MITER_LIMIT          4.0f      // Spline strip joins max miter scale (join width to thickness ratio)
+#endif
+#ifndef SHAPES_ARC_CACHE_SIZE
+    #define SHAPES_ARC_CACHE_SIZE         32      // Number of unit arcs kept in tessellation cache
+#endif
+#ifndef SHAPES_ARC_CACHE_MAX_SEGMENTS
+    #define SHAPES_ARC_CACHE_MAX_SEGMENTS 128     // Maximum number of segments of a cached unit arc
+#endif
+#ifndef SHAPES_CIRCLE_STEP_CACHE_SIZE
+    #define SHAPES_CIRCLE_STEP_CACHE_SIZE 16      // Number of radius kept in smooth circle step cache
+#endif
+#ifndef SHAPES_VERTEX_BLOCK_SIZE
+    #define SHAPES_VERTEX_BLOCK_SIZE     240      // Shapes vertex appended to render batch at once (multiple of 2, 3 and 4)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit arc, tessellated circle piece of radius 1.0f centered at origin
+// NOTE: Points are the { cosf(angle), sinf(angle) } for the angles sequence used to draw the piece,
+// shapes only need to scale and translate them, results match computing sinf/cosf on every vertex
+typedef struct UnitArc {
+    float startAngle;           // Arc start angle (degrees)
+    float stepLength;           // Arc angle between segments (degrees)
+    int segments;               // Arc segments count (0 for unused cache entries)
+    bool pairs;                 // Arc angles advance by pairs of segments (QUADS draw mode)
+    Vector2 points[SHAPES_ARC_CACHE_MAX_SEGMENTS + 1];  // Arc points (segments + 1)
+} UnitArc;
+
+// Spline stroke, thick polyline drawn as a single triangle strip
+// NOTE: Strip vertex are computed once next point is known (to get the join direction),
+// strip is drawn by chunks when vertex buffer is full
+typedef struct SplineStroke {
+    Vector2 strip[2*SPLINE_SEGMENT_MAX_DIVISIONS + 2];  // Strip vertex pending to be drawn
+    int vertexCount;            // Strip vertex count
+    Vector2 previous;           // Previous polyline point
+    Vector2 current;            // Current polyline point (strip vertex not computed yet)
+    int pointCount;             // Polyline points added
+    float halfThick;            // Stroke half thickness
+    Color color;                // Stroke color
+} SplineStroke;
+
+// Shape vertex block, shapes vertex are accumulated and appended to render batch at once
+// NOTE: Texture coordinates and colors are only appended if provided (current ones used otherwise),
+// block is appended when full or flushed, always after complete primitives (block size is a multiple of 2, 3 and 4)
+typedef struct ShapeVertexBlock {
+    float vertices[2*SHAPES_VERTEX_BLOCK_SIZE];         // Vertex positions (XY)
+    float texcoords[2*SHAPES_VERTEX_BLOCK_SIZE];        // Vertex texture coordinates (UV)
+    unsigned char colors[4*SHAPES_VERTEX_BLOCK_SIZE];   // Vertex colors (RGBA)
+    int vertexCount;            // Vertex count
+    bool useTexcoords;          // Texture coordinates provided
+    bool useColors;             // Colors provided
+} ShapeVertexBlock;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -82,10 +138,29 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (white pixel loaded by rlgl)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static UnitArc arcCache[SHAPES_ARC_CACHE_SIZE] = { 0 };     // Unit arcs cache, indexed by arc parameters hash
+static Vector2 *arcPoints = NULL;                           // Unit arc points for arcs not fitting in cache
+static int arcPointsCapacity = 0;                           // Unit arc points capacity (not fitting in cache)
+
+static float circleStepRadius[SHAPES_CIRCLE_STEP_CACHE_SIZE] = { 0 }; // Smooth circle step cache, radius
+static float circleStepAngle[SHAPES_CIRCLE_STEP_CACHE_SIZE] = { 0 };  // Smooth circle step cache, max angle between segments
+
+static ShapeVertexBlock shapeVertices = { 0 };              // Shape vertex block pending to be appended to render batch
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static float GetSmoothCircleStep(float radius);                     // Get maximum angle between circle segments for a radius
+static const Vector2 *GetUnitArc(float startAngle, float stepLength, int segments, bool pairs); // Get unit arc points (cached)
+static void SplineStrokeAddVertex(SplineStroke *stroke, Vector2 point, float tx, float ty, float miter); // Add strip vertex pair for a polyline point (miter scaled)
+static void SplineStrokeAddCubic(SplineStroke *stroke, const float *a, const float *b, bool skipFirst); // Add cubic segment points to spline stroke
+static void SplineStrokeAddPoint(SplineStroke *stroke, Vector2 point);  // Add point to spline stroke
+static void SplineStrokeEnd(SplineStroke *stroke);                      // End spline stroke, draw pending strip vertex
+static void AddShapeVertex(float x, float y);                           // Add shape vertex (position), current texcoord and color used
+static void AddShapeVertexTexCoord(float x, float y, float u, float v); // Add shape vertex (position and texture coordinates)
+static void AddShapeVertexColor(float x, float y, Color color);         // Add shape vertex (position and color)
+static void FlushShapeVertices(void);                                   // Append pending shape vertex to render batch
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -135,40 +210,37 @@ void DrawPixelV(Vector2 position, Color color)
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
     rlBegin(RL_QUADS);
-
         rlNormal3f(0.0f, 0.0f, 1.0f);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(position.x, position.y);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(position.x, position.y + 1);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(position.x + 1, position.y + 1);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(position.x + 1, position.y);
+        AddShapeVertexTexCoord(position.x, position.y, texLeft, texTop);
+        AddShapeVertexTexCoord(position.x, position.y + 1, texLeft, texBottom);
+        AddShapeVertexTexCoord(position.x + 1, position.y + 1, texRight, texBottom);
+        AddShapeVertexTexCoord(position.x + 1, position.y, texRight, texTop);
 
+        FlushShapeVertices();
     rlEnd();
 
     rlSetTexture(0);
 #else
     rlBegin(RL_TRIANGLES);
-
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlVertex2f(position.x, position.y);
-        rlVertex2f(position.x, position.y + 1);
-        rlVertex2f(position.x + 1, position.y);
+        AddShapeVertex(position.x, position.y);
+        AddShapeVertex(position.x, position.y + 1);
+        AddShapeVertex(position.x + 1, position.y);
 
-        rlVertex2f(position.x + 1, position.y);
-        rlVertex2f(position.x, position.y + 1);
-        rlVertex2f(position.x + 1, position.y + 1);
+        AddShapeVertex(position.x + 1, position.y);
+        AddShapeVertex(position.x, position.y + 1);
+        AddShapeVertex(position.x + 1, position.y + 1);
 
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -178,8 +250,9 @@ void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color colo
 {
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f((float)startPosX, (float)startPosY);
-        rlVertex2f((float)endPosX, (float)endPosY);
+        AddShapeVertex((float)startPosX, (float)startPosY);
+        AddShapeVertex((float)endPosX, (float)endPosY);
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -188,8 +261,9 @@ void DrawLineV(Vector2 startPos, Vector2 endPos, Color color)
 {
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(startPos.x, startPos.y);
-        rlVertex2f(endPos.x, endPos.y);
+        AddShapeVertex(startPos.x, startPos.y);
+        AddShapeVertex(endPos.x, endPos.y);
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -203,9 +277,11 @@ void DrawLineStrip(Vector2 *points, int pointCount, Color color)
 
             for (int i = 0; i < pointCount - 1; i++)
             {
-                rlVertex2f(points[i].x, points[i].y);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
+                AddShapeVertex(points[i].x, points[i].y);
+                AddShapeVertex(points[i + 1].x, points[i + 1].y);
             }
+
+            FlushShapeVertices();
         rlEnd();
     }
 }
@@ -301,75 +377,65 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        // Get the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = GetSmoothCircleStep(radius);
         segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
+    const Vector2 *arc = GetUnitArc(startAngle, stepLength, segments, true);
+    if (arc == NULL) return;
+
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
     rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
 
         // NOTE: Every QUAD actually represents two segments
         for (int i = 0; i < segments/2; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2.0f))*radius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += (stepLength*2.0f);
+            AddShapeVertexTexCoord(center.x, center.y, texLeft, texTop);
+            AddShapeVertexTexCoord(center.x + arc[2*i + 2].x*radius, center.y + arc[2*i + 2].y*radius, texRight, texTop);
+            AddShapeVertexTexCoord(center.x + arc[2*i + 1].x*radius, center.y + arc[2*i + 1].y*radius, texRight, texBottom);
+            AddShapeVertexTexCoord(center.x + arc[2*i].x*radius, center.y + arc[2*i].y*radius, texLeft, texBottom);
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
         if (((unsigned int)segments%2) == 1)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
+            AddShapeVertexTexCoord(center.x, center.y, texLeft, texTop);
+            AddShapeVertexTexCoord(center.x + arc[segments].x*radius, center.y + arc[segments].y*radius, texRight, texBottom);
+            AddShapeVertexTexCoord(center.x + arc[segments - 1].x*radius, center.y + arc[segments - 1].y*radius, texLeft, texBottom);
+            AddShapeVertexTexCoord(center.x, center.y, texRight, texTop);
         }
 
+        FlushShapeVertices();
     rlEnd();
 
     rlSetTexture(0);
 #else
+    const Vector2 *arc = GetUnitArc(startAngle, stepLength, segments, false);
+    if (arc == NULL) return;
+
     rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-            angle += stepLength;
+            AddShapeVertex(center.x, center.y);
+            AddShapeVertex(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+            AddShapeVertex(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
         }
+
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -392,41 +458,40 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        // Get the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = GetSmoothCircleStep(radius);
         segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
     bool showCapLines = true;
 
+    const Vector2 *arc = GetUnitArc(startAngle, stepLength, segments, false);
+    if (arc == NULL) return;
+
     rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            AddShapeVertex(center.x, center.y);
+            AddShapeVertex(center.x + arc[0].x*radius, center.y + arc[0].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-            angle += stepLength;
+            AddShapeVertex(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
+            AddShapeVertex(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
         }
 
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            AddShapeVertex(center.x, center.y);
+            AddShapeVertex(center.x + arc[segments].x*radius, center.y + arc[segments].y*radius);
         }
+
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -434,16 +499,17 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    const Vector2 *arc = GetUnitArc(0.0f, 10.0f, 36, false);
+
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < 360; i += 10)
         {
-            rlColor4ub(color1.r, color1.g, color1.b, color1.a);
-            rlVertex2f((float)centerX, (float)centerY);
-            rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radius, (float)centerY + sinf(DEG2RAD*(i + 10))*radius);
-            rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radius, (float)centerY + sinf(DEG2RAD*i)*radius);
+            AddShapeVertexColor((float)centerX, (float)centerY, color1);
+            AddShapeVertexColor((float)centerX + arc[i/10 + 1].x*radius, (float)centerY + arc[i/10 + 1].y*radius, color2);
+            AddShapeVertexColor((float)centerX + arc[i/10].x*radius, (float)centerY + arc[i/10].y*radius, color2);
         }
+
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -456,42 +522,54 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw circle outline (Vector version)
 void DrawCircleLinesV(Vector2 center, float radius, Color color)
 {
+    const Vector2 *arc = GetUnitArc(0.0f, 10.0f, 36, false);
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
         // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
         for (int i = 0; i < 360; i += 10)
         {
-            rlVertex2f(center.x + cosf(DEG2RAD*i)*radius, center.y + sinf(DEG2RAD*i)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(i + 10))*radius, center.y + sinf(DEG2RAD*(i + 10))*radius);
+            AddShapeVertex(center.x + arc[i/10].x*radius, center.y + arc[i/10].y*radius);
+            AddShapeVertex(center.x + arc[i/10 + 1].x*radius, center.y + arc[i/10 + 1].y*radius);
         }
+
+        FlushShapeVertices();
     rlEnd();
 }
 
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    const Vector2 *arc = GetUnitArc(0.0f, 10.0f, 36, false);
+
     rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < 360; i += 10)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radiusH, (float)centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radiusH, (float)centerY + sinf(DEG2RAD*i)*radiusV);
+            AddShapeVertex((float)centerX, (float)centerY);
+            AddShapeVertex((float)centerX + arc[i/10 + 1].x*radiusH, (float)centerY + arc[i/10 + 1].y*radiusV);
+            AddShapeVertex((float)centerX + arc[i/10].x*radiusH, (float)centerY + arc[i/10].y*radiusV);
         }
+
+        FlushShapeVertices();
     rlEnd();
 }
 
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    const Vector2 *arc = GetUnitArc(0.0f, 10.0f, 36, false);
+
     rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < 360; i += 10)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + cosf(DEG2RAD*(i + 10))*radiusH, centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f(centerX + cosf(DEG2RAD*i)*radiusH, centerY + sinf(DEG2RAD*i)*radiusV);
+            AddShapeVertex(centerX + arc[i/10 + 1].x*radiusH, centerY + arc[i/10 + 1].y*radiusV);
+            AddShapeVertex(centerX + arc[i/10].x*radiusH, centerY + arc[i/10].y*radiusV);
         }
+
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -523,8 +601,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
+        // Get the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = GetSmoothCircleStep(outerRadius);
         segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
 
         if (segments <= 0) segments = minSegments;
@@ -538,50 +616,46 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *arc = GetUnitArc(startAngle, stepLength, segments, false);
+    if (arc == NULL) return;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
     rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-            angle += stepLength;
+            AddShapeVertexTexCoord(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius, texLeft, texBottom);
+            AddShapeVertexTexCoord(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius, texLeft, texTop);
+            AddShapeVertexTexCoord(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius, texRight, texTop);
+            AddShapeVertexTexCoord(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius, texRight, texBottom);
         }
+
+        FlushShapeVertices();
     rlEnd();
 
     rlSetTexture(0);
 #else
     rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            AddShapeVertex(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+            AddShapeVertex(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+            AddShapeVertex(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-            angle += stepLength;
+            AddShapeVertex(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+            AddShapeVertex(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
+            AddShapeVertex(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
         }
+
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -614,8 +688,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
+        // Get the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = GetSmoothCircleStep(outerRadius);
         segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
 
         if (segments <= 0) segments = minSegments;
@@ -628,36 +702,35 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
     bool showCapLines = true;
 
+    const Vector2 *arc = GetUnitArc(startAngle, stepLength, segments, false);
+    if (arc == NULL) return;
+
     rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            AddShapeVertex(center.x + arc[0].x*outerRadius, center.y + arc[0].y*outerRadius);
+            AddShapeVertex(center.x + arc[0].x*innerRadius, center.y + arc[0].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            AddShapeVertex(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
+            AddShapeVertex(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-            angle += stepLength;
+            AddShapeVertex(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+            AddShapeVertex(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
         }
 
         if (showCapLines)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            AddShapeVertex(center.x + arc[segments].x*outerRadius, center.y + arc[segments].y*outerRadius);
+            AddShapeVertex(center.x + arc[segments].x*innerRadius, center.y + arc[segments].y*innerRadius);
         }
+
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -723,39 +796,39 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
+
+    // Quad vertex: top-left, bottom-left, bottom-right, top-right
+    float vertices[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+    float texcoords[8] = {
+        texLeft, texTop,
+        texLeft, texBottom,
+        texRight, texBottom,
+        texRight, texTop
+    };
 
     rlBegin(RL_QUADS);
-
         rlNormal3f(0.0f, 0.0f, 1.0f);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
+        rlAppendVertices2D(vertices, texcoords, NULL, 4);
 
     rlEnd();
 
     rlSetTexture(0);
 #else
-    rlBegin(RL_TRIANGLES);
+    float vertices[12] = {
+        topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, topRight.x, topRight.y,
+        topRight.x, topRight.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y
+    };
 
+    rlBegin(RL_TRIANGLES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlVertex2f(topLeft.x, topLeft.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(topRight.x, topRight.y);
-
-        rlVertex2f(topRight.x, topRight.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(bottomRight.x, bottomRight.y);
+        rlAppendVertices2D(vertices, NULL, NULL, 6);
 
     rlEnd();
 #endif
@@ -781,26 +854,27 @@ void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3,
 {
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
+
+    // NOTE: Default raylib font character 95 is a white square
+    float vertices[8] = { rec.x, rec.y, rec.x, rec.y + rec.height, rec.x + rec.width, rec.y + rec.height, rec.x + rec.width, rec.y };
+    float texcoords[8] = {
+        texLeft, texTop,
+        texLeft, texBottom,
+        texRight, texBottom,
+        texRight, texTop
+    };
+    unsigned char colors[16] = {
+        col1.r, col1.g, col1.b, col1.a, col2.r, col2.g, col2.b, col2.a,
+        col3.r, col3.g, col3.b, col3.a, col4.r, col4.g, col4.b, col4.a
+    };
 
     rlBegin(RL_QUADS);
         rlNormal3f(0.0f, 0.0f, 1.0f);
-
-        // NOTE: Default raylib font character 95 is a white square
-        rlColor4ub(col1.r, col1.g, col1.b, col1.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(rec.x, rec.y);
-
-        rlColor4ub(col2.r, col2.g, col2.b, col2.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(rec.x, rec.y + rec.height);
-
-        rlColor4ub(col3.r, col3.g, col3.b, col3.a);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(rec.x + rec.width, rec.y + rec.height);
-
-        rlColor4ub(col4.r, col4.g, col4.b, col4.a);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(rec.x + rec.width, rec.y);
+        rlAppendVertices2D(vertices, texcoords, colors, 4);
     rlEnd();
 
     rlSetTexture(0);
@@ -818,17 +892,18 @@ void DrawRectangleLines(int posX, int posY, int width, int height, Color color)
 #else
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(posX + 1, posY + 1);
-        rlVertex2f(posX + width, posY + 1);
+        AddShapeVertex(posX + 1, posY + 1);
+        AddShapeVertex(posX + width, posY + 1);
 
-        rlVertex2f(posX + width, posY + 1);
-        rlVertex2f(posX + width, posY + height);
+        AddShapeVertex(posX + width, posY + 1);
+        AddShapeVertex(posX + width, posY + height);
 
-        rlVertex2f(posX + width, posY + height);
-        rlVertex2f(posX + 1, posY + height);
+        AddShapeVertex(posX + width, posY + height);
+        AddShapeVertex(posX + 1, posY + height);
 
-        rlVertex2f(posX + 1, posY + height);
-        rlVertex2f(posX + 1, posY + 1);
+        AddShapeVertex(posX + 1, posY + height);
+        AddShapeVertex(posX + 1, posY + 1);
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -883,8 +958,8 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        // Get the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = GetSmoothCircleStep(radius);
         segments = (int)(ceilf(2*PI/th)/4.0f);
         if (segments <= 0) segments = 4;
     }
@@ -922,170 +997,131 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
     rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
             const Vector2 center = centers[k];
+            const Vector2 *arc = GetUnitArc(angles[k], stepLength, segments, true);
+            if (arc == NULL) break;
 
             // NOTE: Every QUAD actually represents two segments
             for (int i = 0; i < segments/2; i++)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-                rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-                angle += (stepLength*2);
+                AddShapeVertexTexCoord(center.x, center.y, texLeft, texTop);
+                AddShapeVertexTexCoord(center.x + arc[2*i + 2].x*radius, center.y + arc[2*i + 2].y*radius, texRight, texTop);
+                AddShapeVertexTexCoord(center.x + arc[2*i + 1].x*radius, center.y + arc[2*i + 1].y*radius, texRight, texBottom);
+                AddShapeVertexTexCoord(center.x + arc[2*i].x*radius, center.y + arc[2*i].y*radius, texLeft, texBottom);
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
             if (segments%2)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-                rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
+                AddShapeVertexTexCoord(center.x, center.y, texLeft, texTop);
+                AddShapeVertexTexCoord(center.x + arc[segments].x*radius, center.y + arc[segments].y*radius, texRight, texBottom);
+                AddShapeVertexTexCoord(center.x + arc[segments - 1].x*radius, center.y + arc[segments - 1].y*radius, texLeft, texBottom);
+                AddShapeVertexTexCoord(center.x, center.y, texRight, texTop);
             }
         }
 
         // [2] Upper Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[0].x, point[0].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[1].x, point[1].y);
+        AddShapeVertexTexCoord(point[0].x, point[0].y, texLeft, texTop);
+        AddShapeVertexTexCoord(point[8].x, point[8].y, texLeft, texBottom);
+        AddShapeVertexTexCoord(point[9].x, point[9].y, texRight, texBottom);
+        AddShapeVertexTexCoord(point[1].x, point[1].y, texRight, texTop);
 
         // [4] Right Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[2].x, point[2].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[3].x, point[3].y);
+        AddShapeVertexTexCoord(point[2].x, point[2].y, texLeft, texTop);
+        AddShapeVertexTexCoord(point[9].x, point[9].y, texLeft, texBottom);
+        AddShapeVertexTexCoord(point[10].x, point[10].y, texRight, texBottom);
+        AddShapeVertexTexCoord(point[3].x, point[3].y, texRight, texTop);
 
         // [6] Bottom Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[5].x, point[5].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[4].x, point[4].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
+        AddShapeVertexTexCoord(point[11].x, point[11].y, texLeft, texTop);
+        AddShapeVertexTexCoord(point[5].x, point[5].y, texLeft, texBottom);
+        AddShapeVertexTexCoord(point[4].x, point[4].y, texRight, texBottom);
+        AddShapeVertexTexCoord(point[10].x, point[10].y, texRight, texTop);
 
         // [8] Left Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[7].x, point[7].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[6].x, point[6].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
+        AddShapeVertexTexCoord(point[7].x, point[7].y, texLeft, texTop);
+        AddShapeVertexTexCoord(point[6].x, point[6].y, texLeft, texBottom);
+        AddShapeVertexTexCoord(point[11].x, point[11].y, texRight, texBottom);
+        AddShapeVertexTexCoord(point[8].x, point[8].y, texRight, texTop);
 
         // [9] Middle Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
+        AddShapeVertexTexCoord(point[8].x, point[8].y, texLeft, texTop);
+        AddShapeVertexTexCoord(point[11].x, point[11].y, texLeft, texBottom);
+        AddShapeVertexTexCoord(point[10].x, point[10].y, texRight, texBottom);
+        AddShapeVertexTexCoord(point[9].x, point[9].y, texRight, texTop);
 
+        FlushShapeVertices();
     rlEnd();
     rlSetTexture(0);
 #else
     rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
 
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
             const Vector2 center = centers[k];
+            const Vector2 *arc = GetUnitArc(angles[k], stepLength, segments, false);
+            if (arc == NULL) break;
+
             for (int i = 0; i < segments; i++)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-                angle += stepLength;
+                AddShapeVertex(center.x, center.y);
+                AddShapeVertex(center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius);
+                AddShapeVertex(center.x + arc[i].x*radius, center.y + arc[i].y*radius);
             }
         }
 
         // [2] Upper Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[0].x, point[0].y);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[1].x, point[1].y);
-        rlVertex2f(point[0].x, point[0].y);
-        rlVertex2f(point[9].x, point[9].y);
+        AddShapeVertex(point[0].x, point[0].y);
+        AddShapeVertex(point[8].x, point[8].y);
+        AddShapeVertex(point[9].x, point[9].y);
+        AddShapeVertex(point[1].x, point[1].y);
+        AddShapeVertex(point[0].x, point[0].y);
+        AddShapeVertex(point[9].x, point[9].y);
 
         // [4] Right Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[10].x, point[10].y);
-        rlVertex2f(point[3].x, point[3].y);
-        rlVertex2f(point[2].x, point[2].y);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[3].x, point[3].y);
+        AddShapeVertex(point[9].x, point[9].y);
+        AddShapeVertex(point[10].x, point[10].y);
+        AddShapeVertex(point[3].x, point[3].y);
+        AddShapeVertex(point[2].x, point[2].y);
+        AddShapeVertex(point[9].x, point[9].y);
+        AddShapeVertex(point[3].x, point[3].y);
 
         // [6] Bottom Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[5].x, point[5].y);
-        rlVertex2f(point[4].x, point[4].y);
-        rlVertex2f(point[10].x, point[10].y);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[4].x, point[4].y);
+        AddShapeVertex(point[11].x, point[11].y);
+        AddShapeVertex(point[5].x, point[5].y);
+        AddShapeVertex(point[4].x, point[4].y);
+        AddShapeVertex(point[10].x, point[10].y);
+        AddShapeVertex(point[11].x, point[11].y);
+        AddShapeVertex(point[4].x, point[4].y);
 
         // [8] Left Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[7].x, point[7].y);
-        rlVertex2f(point[6].x, point[6].y);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[7].x, point[7].y);
-        rlVertex2f(point[11].x, point[11].y);
+        AddShapeVertex(point[7].x, point[7].y);
+        AddShapeVertex(point[6].x, point[6].y);
+        AddShapeVertex(point[11].x, point[11].y);
+        AddShapeVertex(point[8].x, point[8].y);
+        AddShapeVertex(point[7].x, point[7].y);
+        AddShapeVertex(point[11].x, point[11].y);
 
         // [9] Middle Rectangle
-        rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[11].x, point[11].y);
-        rlVertex2f(point[10].x, point[10].y);
-        rlVertex2f(point[9].x, point[9].y);
-        rlVertex2f(point[8].x, point[8].y);
-        rlVertex2f(point[10].x, point[10].y);
+        AddShapeVertex(point[8].x, point[8].y);
+        AddShapeVertex(point[11].x, point[11].y);
+        AddShapeVertex(point[10].x, point[10].y);
+        AddShapeVertex(point[9].x, point[9].y);
+        AddShapeVertex(point[8].x, point[8].y);
+        AddShapeVertex(point[10].x, point[10].y);
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -1111,8 +1147,8 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        // Get the maximum angle between segments based on the error rate (usually 0.5f)
+        float th = GetSmoothCircleStep(radius);
         segments = (int)(ceilf(2*PI/th)/2.0f);
         if (segments <= 0) segments = 4;
     }
@@ -1158,140 +1194,111 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
 #if defined(SUPPORT_QUADS_DRAW_MODE)
         rlSetTexture(GetShapesTexture().id);
         Rectangle shapeRect = GetShapesTextureRectangle();
+        float texLeft = shapeRect.x/texShapes.width;
+        float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+        float texTop = shapeRect.y/texShapes.height;
+        float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
         rlBegin(RL_QUADS);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
                 const Vector2 center = centers[k];
+                const Vector2 *arc = GetUnitArc(angles[k], stepLength, segments, false);
+                if (arc == NULL) break;
                 for (int i = 0; i < segments; i++)
                 {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
-
-                    rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-
-                    rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-
-                    rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-
-                    rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    angle += stepLength;
+                    AddShapeVertexTexCoord(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius, texLeft, texTop);
+                    AddShapeVertexTexCoord(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius, texRight, texTop);
+                    AddShapeVertexTexCoord(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius, texRight, texBottom);
+                    AddShapeVertexTexCoord(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius, texLeft, texBottom);
                 }
             }
 
             // Upper rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[0].x, point[0].y);
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[8].x, point[8].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[9].x, point[9].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[1].x, point[1].y);
+            AddShapeVertexTexCoord(point[0].x, point[0].y, texLeft, texTop);
+            AddShapeVertexTexCoord(point[8].x, point[8].y, texLeft, texBottom);
+            AddShapeVertexTexCoord(point[9].x, point[9].y, texRight, texBottom);
+            AddShapeVertexTexCoord(point[1].x, point[1].y, texRight, texTop);
 
             // Right rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[2].x, point[2].y);
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[10].x, point[10].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[11].x, point[11].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[3].x, point[3].y);
+            AddShapeVertexTexCoord(point[2].x, point[2].y, texLeft, texTop);
+            AddShapeVertexTexCoord(point[10].x, point[10].y, texLeft, texBottom);
+            AddShapeVertexTexCoord(point[11].x, point[11].y, texRight, texBottom);
+            AddShapeVertexTexCoord(point[3].x, point[3].y, texRight, texTop);
 
             // Lower rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[13].x, point[13].y);
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[5].x, point[5].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[4].x, point[4].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[12].x, point[12].y);
+            AddShapeVertexTexCoord(point[13].x, point[13].y, texLeft, texTop);
+            AddShapeVertexTexCoord(point[5].x, point[5].y, texLeft, texBottom);
+            AddShapeVertexTexCoord(point[4].x, point[4].y, texRight, texBottom);
+            AddShapeVertexTexCoord(point[12].x, point[12].y, texRight, texTop);
 
             // Left rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[15].x, point[15].y);
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[7].x, point[7].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(point[6].x, point[6].y);
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(point[14].x, point[14].y);
+            AddShapeVertexTexCoord(point[15].x, point[15].y, texLeft, texTop);
+            AddShapeVertexTexCoord(point[7].x, point[7].y, texLeft, texBottom);
+            AddShapeVertexTexCoord(point[6].x, point[6].y, texRight, texBottom);
+            AddShapeVertexTexCoord(point[14].x, point[14].y, texRight, texTop);
 
+            FlushShapeVertices();
         rlEnd();
         rlSetTexture(0);
 #else
         rlBegin(RL_TRIANGLES);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
                 const Vector2 center = centers[k];
+                const Vector2 *arc = GetUnitArc(angles[k], stepLength, segments, false);
+                if (arc == NULL) break;
 
                 for (int i = 0; i < segments; i++)
                 {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
-
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    AddShapeVertex(center.x + arc[i].x*innerRadius, center.y + arc[i].y*innerRadius);
+                    AddShapeVertex(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+                    AddShapeVertex(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-
-                    angle += stepLength;
+                    AddShapeVertex(center.x + arc[i + 1].x*innerRadius, center.y + arc[i + 1].y*innerRadius);
+                    AddShapeVertex(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
+                    AddShapeVertex(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
                 }
             }
 
             // Upper rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[0].x, point[0].y);
-            rlVertex2f(point[8].x, point[8].y);
-            rlVertex2f(point[9].x, point[9].y);
-            rlVertex2f(point[1].x, point[1].y);
-            rlVertex2f(point[0].x, point[0].y);
-            rlVertex2f(point[9].x, point[9].y);
+            AddShapeVertex(point[0].x, point[0].y);
+            AddShapeVertex(point[8].x, point[8].y);
+            AddShapeVertex(point[9].x, point[9].y);
+            AddShapeVertex(point[1].x, point[1].y);
+            AddShapeVertex(point[0].x, point[0].y);
+            AddShapeVertex(point[9].x, point[9].y);
 
             // Right rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[10].x, point[10].y);
-            rlVertex2f(point[11].x, point[11].y);
-            rlVertex2f(point[3].x, point[3].y);
-            rlVertex2f(point[2].x, point[2].y);
-            rlVertex2f(point[10].x, point[10].y);
-            rlVertex2f(point[3].x, point[3].y);
+            AddShapeVertex(point[10].x, point[10].y);
+            AddShapeVertex(point[11].x, point[11].y);
+            AddShapeVertex(point[3].x, point[3].y);
+            AddShapeVertex(point[2].x, point[2].y);
+            AddShapeVertex(point[10].x, point[10].y);
+            AddShapeVertex(point[3].x, point[3].y);
 
             // Lower rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[13].x, point[13].y);
-            rlVertex2f(point[5].x, point[5].y);
-            rlVertex2f(point[4].x, point[4].y);
-            rlVertex2f(point[12].x, point[12].y);
-            rlVertex2f(point[13].x, point[13].y);
-            rlVertex2f(point[4].x, point[4].y);
+            AddShapeVertex(point[13].x, point[13].y);
+            AddShapeVertex(point[5].x, point[5].y);
+            AddShapeVertex(point[4].x, point[4].y);
+            AddShapeVertex(point[12].x, point[12].y);
+            AddShapeVertex(point[13].x, point[13].y);
+            AddShapeVertex(point[4].x, point[4].y);
 
             // Left rectangle
-            rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(point[7].x, point[7].y);
-            rlVertex2f(point[6].x, point[6].y);
-            rlVertex2f(point[14].x, point[14].y);
-            rlVertex2f(point[15].x, point[15].y);
-            rlVertex2f(point[7].x, point[7].y);
-            rlVertex2f(point[14].x, point[14].y);
+            AddShapeVertex(point[7].x, point[7].y);
+            AddShapeVertex(point[6].x, point[6].y);
+            AddShapeVertex(point[14].x, point[14].y);
+            AddShapeVertex(point[15].x, point[15].y);
+            AddShapeVertex(point[7].x, point[7].y);
+            AddShapeVertex(point[14].x, point[14].y);
+            FlushShapeVertices();
         rlEnd();
 #endif
     }
@@ -1299,30 +1306,30 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     {
         // Use LINES to draw the outline
         rlBegin(RL_LINES);
+            rlColor4ub(color.r, color.g, color.b, color.a);
 
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
                 const Vector2 center = centers[k];
+                const Vector2 *arc = GetUnitArc(angles[k], stepLength, segments, false);
+                if (arc == NULL) break;
 
                 for (int i = 0; i < segments; i++)
                 {
-                    rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    AddShapeVertex(center.x + arc[i].x*outerRadius, center.y + arc[i].y*outerRadius);
+                    AddShapeVertex(center.x + arc[i + 1].x*outerRadius, center.y + arc[i + 1].y*outerRadius);
                 }
             }
 
             // And now the remaining 4 lines
             for (int i = 0; i < 8; i += 2)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlVertex2f(point[i].x, point[i].y);
-                rlVertex2f(point[i + 1].x, point[i + 1].y);
+                AddShapeVertex(point[i].x, point[i].y);
+                AddShapeVertex(point[i + 1].x, point[i + 1].y);
             }
 
+            FlushShapeVertices();
         rlEnd();
     }
 }
@@ -1334,30 +1341,29 @@ void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
     rlBegin(RL_QUADS);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(v1.x, v1.y);
-
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(v2.x, v2.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(v2.x, v2.y);
-
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(v3.x, v3.y);
+        AddShapeVertexTexCoord(v1.x, v1.y, texLeft, texTop);
+        AddShapeVertexTexCoord(v2.x, v2.y, texLeft, texBottom);
+        AddShapeVertexTexCoord(v2.x, v2.y, texRight, texBottom);
+        AddShapeVertexTexCoord(v3.x, v3.y, texRight, texTop);
+        FlushShapeVertices();
     rlEnd();
 
     rlSetTexture(0);
 #else
     rlBegin(RL_TRIANGLES);
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(v1.x, v1.y);
-        rlVertex2f(v2.x, v2.y);
-        rlVertex2f(v3.x, v3.y);
+        AddShapeVertex(v1.x, v1.y);
+        AddShapeVertex(v2.x, v2.y);
+        AddShapeVertex(v3.x, v3.y);
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -1368,14 +1374,15 @@ void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
-        rlVertex2f(v1.x, v1.y);
-        rlVertex2f(v2.x, v2.y);
+        AddShapeVertex(v1.x, v1.y);
+        AddShapeVertex(v2.x, v2.y);
 
-        rlVertex2f(v2.x, v2.y);
-        rlVertex2f(v3.x, v3.y);
+        AddShapeVertex(v2.x, v2.y);
+        AddShapeVertex(v3.x, v3.y);
 
-        rlVertex2f(v3.x, v3.y);
-        rlVertex2f(v1.x, v1.y);
+        AddShapeVertex(v3.x, v3.y);
+        AddShapeVertex(v1.x, v1.y);
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -1388,24 +1395,23 @@ void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
     {
         rlSetTexture(GetShapesTexture().id);
         Rectangle shapeRect = GetShapesTextureRectangle();
+        float texLeft = shapeRect.x/texShapes.width;
+        float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+        float texTop = shapeRect.y/texShapes.height;
+        float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
         rlBegin(RL_QUADS);
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             for (int i = 1; i < pointCount - 1; i++)
             {
-                rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(points[0].x, points[0].y);
-
-                rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(points[i].x, points[i].y);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(points[i + 1].x, points[i + 1].y);
+                AddShapeVertexTexCoord(points[0].x, points[0].y, texLeft, texTop);
+                AddShapeVertexTexCoord(points[i].x, points[i].y, texLeft, texBottom);
+                AddShapeVertexTexCoord(points[i + 1].x, points[i + 1].y, texRight, texBottom);
+                AddShapeVertexTexCoord(points[i + 1].x, points[i + 1].y, texRight, texTop);
             }
+
+            FlushShapeVertices();
         rlEnd();
         rlSetTexture(0);
     }
@@ -1424,17 +1430,19 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
             {
                 if ((i%2) == 0)
                 {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
+                    AddShapeVertex(points[i].x, points[i].y);
+                    AddShapeVertex(points[i - 2].x, points[i - 2].y);
+                    AddShapeVertex(points[i - 1].x, points[i - 1].y);
                 }
                 else
                 {
-                    rlVertex2f(points[i].x, points[i].y);
-                    rlVertex2f(points[i - 1].x, points[i - 1].y);
-                    rlVertex2f(points[i - 2].x, points[i - 2].y);
+                    AddShapeVertex(points[i].x, points[i].y);
+                    AddShapeVertex(points[i - 1].x, points[i - 1].y);
+                    AddShapeVertex(points[i - 2].x, points[i - 2].y);
                 }
             }
+
+            FlushShapeVertices();
         rlEnd();
     }
 }
@@ -1449,41 +1457,41 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
     rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < sides; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
             float nextAngle = centralAngle + angleStep;
 
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x, center.y);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            AddShapeVertexTexCoord(center.x, center.y, texLeft, texTop);
+            AddShapeVertexTexCoord(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius, texLeft, texBottom);
+            AddShapeVertexTexCoord(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius, texRight, texTop);
+            AddShapeVertexTexCoord(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius, texRight, texBottom);
 
             centralAngle = nextAngle;
         }
+
+        FlushShapeVertices();
     rlEnd();
     rlSetTexture(0);
 #else
     rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < sides; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            AddShapeVertex(center.x, center.y);
+            AddShapeVertex(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
+            AddShapeVertex(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
 
             centralAngle += angleStep;
         }
+
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -1496,15 +1504,16 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Colo
     float angleStep = 360.0f/(float)sides*DEG2RAD;
 
     rlBegin(RL_LINES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < sides; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
-
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
+            AddShapeVertex(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            AddShapeVertex(center.x + cosf(centralAngle + angleStep)*radius, center.y + sinf(centralAngle + angleStep)*radius);
 
             centralAngle += angleStep;
         }
+
+        FlushShapeVertices();
     rlEnd();
 }
 
@@ -1518,46 +1527,47 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(GetShapesTexture().id);
     Rectangle shapeRect = GetShapesTextureRectangle();
+    float texLeft = shapeRect.x/texShapes.width;
+    float texRight = (shapeRect.x + shapeRect.width)/texShapes.width;
+    float texTop = shapeRect.y/texShapes.height;
+    float texBottom = (shapeRect.y + shapeRect.height)/texShapes.height;
 
     rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < sides; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
             float nextAngle = centralAngle + exteriorAngle;
 
-            rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-
-            rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius);
-
-            rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+            AddShapeVertexTexCoord(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius, texLeft, texBottom);
+            AddShapeVertexTexCoord(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius, texLeft, texTop);
+            AddShapeVertexTexCoord(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius, texRight, texBottom);
+            AddShapeVertexTexCoord(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius, texRight, texTop);
 
             centralAngle = nextAngle;
         }
+
+        FlushShapeVertices();
     rlEnd();
     rlSetTexture(0);
 #else
     rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
         for (int i = 0; i < sides; i++)
         {
-            rlColor4ub(color.r, color.g, color.b, color.a);
             float nextAngle = centralAngle + exteriorAngle;
 
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
+            AddShapeVertex(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+            AddShapeVertex(center.x + cosf(centralAngle)*radius, center.y + sinf(centralAngle)*radius);
+            AddShapeVertex(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
 
-            rlVertex2f(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
-            rlVertex2f(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius);
-            rlVertex2f(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
+            AddShapeVertex(center.x + cosf(centralAngle)*innerRadius, center.y + sinf(centralAngle)*innerRadius);
+            AddShapeVertex(center.x + cosf(nextAngle)*innerRadius, center.y + sinf(nextAngle)*innerRadius);
+            AddShapeVertex(center.x + cosf(nextAngle)*radius, center.y + sinf(nextAngle)*radius);
 
             centralAngle = nextAngle;
         }
+
+        FlushShapeVertices();
     rlEnd();
 #endif
 }
@@ -1690,17 +1700,13 @@ void DrawSplineBasis(Vector2 *points, int pointCount, float thick, Color color)
 
     float a[4] = { 0 };
     float b[4] = { 0 };
-    float dy = 0.0f;
-    float dx = 0.0f;
-    float size = 0.0f;
 
-    Vector2 currentPoint = { 0 };
-    Vector2 nextPoint = { 0 };
-    Vector2 vertices[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
+    SplineStroke stroke = { 0 };
+    stroke.halfThick = 0.5f*thick;
+    stroke.color = color;
 
     for (int i = 0; i < (pointCount - 3); i++)
     {
-        float t = 0.0f;
         Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
 
         a[0] = (-p1.x + 3.0f*p2.x - 3.0f*p3.x + p4.x)/6.0f;
@@ -1713,50 +1719,15 @@ void DrawSplineBasis(Vector2 *points, int pointCount, float thick, Color color)
         b[2] = (-3.0f*p1.y + 3.0f*p3.y)/6.0f;
         b[3] = (p1.y + 4.0f*p2.y + p3.y)/6.0f;
 
-        currentPoint.x = a[3];
-        currentPoint.y = b[3];
-
-        if (i == 0) DrawCircleV(currentPoint, thick/2.0f, color);   // Draw init line circle-cap
-
-        if (i > 0)
-        {
-            vertices[0].x = currentPoint.x + dy*size;
-            vertices[0].y = currentPoint.y - dx*size;
-            vertices[1].x = currentPoint.x - dy*size;
-            vertices[1].y = currentPoint.y + dx*size;
-        }
-
-        for (int j = 1; j <= SPLINE_SEGMENT_DIVISIONS; j++)
-        {
-            t = ((float)j)/((float)SPLINE_SEGMENT_DIVISIONS);
-
-            nextPoint.x = a[3] + t*(a[2] + t*(a[1] + t*a[0]));
-            nextPoint.y = b[3] + t*(b[2] + t*(b[1] + t*b[0]));
-
-            dy = nextPoint.y - currentPoint.y;
-            dx = nextPoint.x - currentPoint.x;
-            size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
-
-            if ((i == 0) && (j == 1))
-            {
-                vertices[0].x = currentPoint.x + dy*size;
-                vertices[0].y = currentPoint.y - dx*size;
-                vertices[1].x = currentPoint.x - dy*size;
-                vertices[1].y = currentPoint.y + dx*size;
-            }
-
-            vertices[2*j + 1].x = nextPoint.x - dy*size;
-            vertices[2*j + 1].y = nextPoint.y + dx*size;
-            vertices[2*j].x = nextPoint.x + dy*size;
-            vertices[2*j].y = nextPoint.y - dx*size;
-
-            currentPoint = nextPoint;
-        }
+        if (i == 0) DrawCircleV((Vector2){ a[3], b[3] }, thick/2.0f, color);   // Draw init line circle-cap
 
-        DrawTriangleStrip(vertices, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+        // NOTE: Segments are joined, first point of a segment is the last point of previous one
+        SplineStrokeAddCubic(&stroke, a, b, (i > 0));
     }
 
-    DrawCircleV(currentPoint, thick/2.0f, color);   // Draw end line circle-cap
+    SplineStrokeEnd(&stroke);
+
+    DrawCircleV(stroke.current, thick/2.0f, color);   // Draw end line circle-cap
 }
 
 // Draw spline: Catmull-Rom, minimum 4 points
@@ -1764,65 +1735,36 @@ void DrawSplineCatmullRom(Vector2 *points, int pointCount, float thick, Color co
 {
     if (pointCount < 4) return;
 
-    float dy = 0.0f;
-    float dx = 0.0f;
-    float size = 0.0f;
+    float a[4] = { 0 };
+    float b[4] = { 0 };
 
-    Vector2 currentPoint = points[1];
-    Vector2 nextPoint = { 0 };
-    Vector2 vertices[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
+    SplineStroke stroke = { 0 };
+    stroke.halfThick = 0.5f*thick;
+    stroke.color = color;
 
-    DrawCircleV(currentPoint, thick/2.0f, color);   // Draw init line circle-cap
+    DrawCircleV(points[1], thick/2.0f, color);   // Draw init line circle-cap
 
     for (int i = 0; i < (pointCount - 3); i++)
     {
-        float t = 0.0f;
         Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
 
-        if (i > 0)
-        {
-            vertices[0].x = currentPoint.x + dy*size;
-            vertices[0].y = currentPoint.y - dx*size;
-            vertices[1].x = currentPoint.x - dy*size;
-            vertices[1].y = currentPoint.y + dx*size;
-        }
-
-        for (int j = 1; j <= SPLINE_SEGMENT_DIVISIONS; j++)
-        {
-            t = ((float)j)/((float)SPLINE_SEGMENT_DIVISIONS);
-
-            float q0 = (-1.0f*t*t*t) + (2.0f*t*t) + (-1.0f*t);
-            float q1 = (3.0f*t*t*t) + (-5.0f*t*t) + 2.0f;
-            float q2 = (-3.0f*t*t*t) + (4.0f*t*t) + t;
-            float q3 = t*t*t - t*t;
-
-            nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-            nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
+        a[0] = 0.5f*(-p1.x + 3.0f*p2.x - 3.0f*p3.x + p4.x);
+        a[1] = 0.5f*(2.0f*p1.x - 5.0f*p2.x + 4.0f*p3.x - p4.x);
+        a[2] = 0.5f*(-p1.x + p3.x);
+        a[3] = p2.x;
 
-            dy = nextPoint.y - currentPoint.y;
-            dx = nextPoint.x - currentPoint.x;
-            size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
+        b[0] = 0.5f*(-p1.y + 3.0f*p2.y - 3.0f*p3.y + p4.y);
+        b[1] = 0.5f*(2.0f*p1.y - 5.0f*p2.y + 4.0f*p3.y - p4.y);
+        b[2] = 0.5f*(-p1.y + p3.y);
+        b[3] = p2.y;
 
-            if ((i == 0) && (j == 1))
-            {
-                vertices[0].x = currentPoint.x + dy*size;
-                vertices[0].y = currentPoint.y - dx*size;
-                vertices[1].x = currentPoint.x - dy*size;
-                vertices[1].y = currentPoint.y + dx*size;
-            }
-
-            vertices[2*j + 1].x = nextPoint.x - dy*size;
-            vertices[2*j + 1].y = nextPoint.y + dx*size;
-            vertices[2*j].x = nextPoint.x + dy*size;
-            vertices[2*j].y = nextPoint.y - dx*size;
-
-            currentPoint = nextPoint;
-        }
-
-        DrawTriangleStrip(vertices, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+        // NOTE: Segments are joined, first point of a segment is the last point of previous one
+        SplineStrokeAddCubic(&stroke, a, b, (i > 0));
     }
 
-    DrawCircleV(currentPoint, thick/2.0f, color);   // Draw end line circle-cap
+    SplineStrokeEnd(&stroke);
+
+    DrawCircleV(stroke.current, thick/2.0f, color);   // Draw end line circle-cap
 }
 
 // Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
@@ -1874,14 +1816,6 @@ void DrawSplineSegmentLinear(Vector2 p1, Vector2 p2, float thick, Color color)
 // Draw spline segment: B-Spline, 4 points
 void DrawSplineSegmentBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    Vector2 currentPoint = { 0 };
-    Vector2 nextPoint = { 0 };
-    float t = 0.0f;
-
-    Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
     float a[4] = { 0 };
     float b[4] = { 0 };
 
@@ -1895,175 +1829,66 @@ void DrawSplineSegmentBasis(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, floa
     b[2] = (-3*p1.y + 3*p3.y)/6.0f;
     b[3] = (p1.y + 4*p2.y + p3.y)/6.0f;
 
-    currentPoint.x = a[3];
-    currentPoint.y = b[3];
-
-    for (int i = 0; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
+    SplineStroke stroke = { 0 };
+    stroke.halfThick = 0.5f*thick;
+    stroke.color = color;
 
-        nextPoint.x = a[3] + t*(a[2] + t*(a[1] + t*a[0]));
-        nextPoint.y = b[3] + t*(b[2] + t*(b[1] + t*b[0]));
-
-        float dy = nextPoint.y - currentPoint.y;
-        float dx = nextPoint.x - currentPoint.x;
-        float size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = currentPoint.x + dy*size;
-            points[0].y = currentPoint.y - dx*size;
-            points[1].x = currentPoint.x - dy*size;
-            points[1].y = currentPoint.y + dx*size;
-        }
-
-        points[2*i + 1].x = nextPoint.x - dy*size;
-        points[2*i + 1].y = nextPoint.y + dx*size;
-        points[2*i].x = nextPoint.x + dy*size;
-        points[2*i].y = nextPoint.y - dx*size;
-
-        currentPoint = nextPoint;
-    }
-
-    DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS+2, color);
+    SplineStrokeAddCubic(&stroke, a, b, false);
+    SplineStrokeEnd(&stroke);
 }
 
 // Draw spline segment: Catmull-Rom, 4 points
 void DrawSplineSegmentCatmullRom(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4, float thick, Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    Vector2 currentPoint = p1;
-    Vector2 nextPoint = { 0 };
-    float t = 0.0f;
-
-    Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 0; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float q0 = (-1*t*t*t) + (2*t*t) + (-1*t);
-        float q1 = (3*t*t*t) + (-5*t*t) + 2;
-        float q2 = (-3*t*t*t) + (4*t*t) + t;
-        float q3 = t*t*t - t*t;
-
-        nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-        nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
-
-        float dy = nextPoint.y - currentPoint.y;
-        float dx = nextPoint.x - currentPoint.x;
-        float size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
+    float a[4] = { 0 };
+    float b[4] = { 0 };
 
-        if (i == 1)
-        {
-            points[0].x = currentPoint.x + dy*size;
-            points[0].y = currentPoint.y - dx*size;
-            points[1].x = currentPoint.x - dy*size;
-            points[1].y = currentPoint.y + dx*size;
-        }
+    a[0] = 0.5f*(-p1.x + 3*p2.x - 3*p3.x + p4.x);
+    a[1] = 0.5f*(2*p1.x - 5*p2.x + 4*p3.x - p4.x);
+    a[2] = 0.5f*(-p1.x + p3.x);
+    a[3] = p2.x;
 
-        points[2*i + 1].x = nextPoint.x - dy*size;
-        points[2*i + 1].y = nextPoint.y + dx*size;
-        points[2*i].x = nextPoint.x + dy*size;
-        points[2*i].y = nextPoint.y - dx*size;
+    b[0] = 0.5f*(-p1.y + 3*p2.y - 3*p3.y + p4.y);
+    b[1] = 0.5f*(2*p1.y - 5*p2.y + 4*p3.y - p4.y);
+    b[2] = 0.5f*(-p1.y + p3.y);
+    b[3] = p2.y;
 
-        currentPoint = nextPoint;
-    }
+    SplineStroke stroke = { 0 };
+    stroke.halfThick = 0.5f*thick;
+    stroke.color = color;
 
-    DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    SplineStrokeAddCubic(&stroke, a, b, false);
+    SplineStrokeEnd(&stroke);
 }
 
 // Draw spline segment: Quadratic Bezier, 2 points, 1 control point
 void DrawSplineSegmentBezierQuadratic(Vector2 p1, Vector2 c2, Vector2 p3, float thick, Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
+    // NOTE: Bernstein polynomials expanded into powers of t, there is no cubic term
+    float a[4] = { 0.0f, p1.x - 2.0f*c2.x + p3.x, 2.0f*(c2.x - p1.x), p1.x };
+    float b[4] = { 0.0f, p1.y - 2.0f*c2.y + p3.y, 2.0f*(c2.y - p1.y), p1.y };
 
-    Vector2 previous = p1;
-    Vector2 current = { 0 };
-    float t = 0.0f;
-
-    Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float a = powf(1.0f - t, 2);
-        float b = 2.0f*(1.0f - t)*t;
-        float c = powf(t, 2);
-
-        // NOTE: The easing functions aren't suitable here because they don't take a control point
-        current.y = a*p1.y + b*c2.y + c*p3.y;
-        current.x = a*p1.x + b*c2.x + c*p3.x;
-
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
+    SplineStroke stroke = { 0 };
+    stroke.halfThick = 0.5f*thick;
+    stroke.color = color;
 
-        if (i == 1)
-        {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
-        }
-
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
-
-        previous = current;
-    }
-
-    DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    SplineStrokeAddCubic(&stroke, a, b, false);
+    SplineStrokeEnd(&stroke);
 }
 
 // Draw spline segment: Cubic Bezier, 2 points, 2 control points
 void DrawSplineSegmentBezierCubic(Vector2 p1, Vector2 c2, Vector2 c3, Vector2 p4, float thick, Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    Vector2 previous = p1;
-    Vector2 current = { 0 };
-    float t = 0.0f;
-
-    Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
+    // NOTE: Bernstein polynomials expanded into powers of t
+    float a[4] = { -p1.x + 3.0f*c2.x - 3.0f*c3.x + p4.x, 3.0f*p1.x - 6.0f*c2.x + 3.0f*c3.x, 3.0f*(c2.x - p1.x), p1.x };
+    float b[4] = { -p1.y + 3.0f*c2.y - 3.0f*c3.y + p4.y, 3.0f*p1.y - 6.0f*c2.y + 3.0f*c3.y, 3.0f*(c2.y - p1.y), p1.y };
 
-        float a = powf(1.0f - t, 3);
-        float b = 3.0f*powf(1.0f - t, 2)*t;
-        float c = 3.0f*(1.0f - t)*powf(t, 2);
-        float d = powf(t, 3);
+    SplineStroke stroke = { 0 };
+    stroke.halfThick = 0.5f*thick;
+    stroke.color = color;
 
-        current.y = a*p1.y + b*c2.y + c*c3.y + d*p4.y;
-        current.x = a*p1.x + b*c2.x + c*c3.x + d*p4.x;
-
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
-        }
-
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
-
-        previous = current;
-    }
-
-    DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    SplineStrokeAddCubic(&stroke, a, b, false);
+    SplineStrokeEnd(&stroke);
 }
 
 // Get spline point for a given t [0.0f .. 1.0f], Linear
@@ -2352,4 +2177,262 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return 0.5f*c*(t*t*t + 2.0f) + b;
 }
 
+// Get maximum angle between segments to draw a smooth circle of the given radius,
+// based on the error rate (usually 0.5f), results are cached by radius
+static float GetSmoothCircleStep(float radius)
+{
+    unsigned int bits = 0;
+    memcpy(&bits, &radius, sizeof(float));
+    int index = (int)((bits*2654435761u) >> 16)%SHAPES_CIRCLE_STEP_CACHE_SIZE;
+
+    if ((circleStepRadius[index] != radius) || (circleStepAngle[index] == 0.0f))
+    {
+        circleStepRadius[index] = radius;
+        circleStepAngle[index] = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+    }
+
+    return circleStepAngle[index];
+}
+
+// Get unit arc points for a circle piece, points are computed once and cached
+// NOTE: Angles are accumulated the same way shapes did drawing them, point i for
+// angle (startAngle + i*stepLength) or, by pairs, point 2*i for angle (startAngle + i*2*stepLength)
+// WARNING: Returned points are valid until next call
+static const Vector2 *GetUnitArc(float startAngle, float stepLength, int segments, bool pairs)
+{
+    Vector2 *points = NULL;
+
+    if (segments <= SHAPES_ARC_CACHE_MAX_SEGMENTS)
+    {
+        unsigned int hash = 2166136261u;
+        unsigned int key[4] = { 0 };
+        memcpy(&key[0], &startAngle, sizeof(float));
+        memcpy(&key[1], &stepLength, sizeof(float));
+        key[2] = (unsigned int)segments;
+        key[3] = (unsigned int)pairs;
+
+        for (int i = 0; i < 4; i++) hash = (hash ^ key[i])*16777619u;
+
+        UnitArc *arc = &arcCache[hash%SHAPES_ARC_CACHE_SIZE];
+
+        // Cache hit, points already computed
+        if ((arc->segments == segments) && (arc->startAngle == startAngle) &&
+            (arc->stepLength == stepLength) && (arc->pairs == pairs)) return arc->points;
+
+        arc->startAngle = startAngle;
+        arc->stepLength = stepLength;
+        arc->segments = segments;
+        arc->pairs = pairs;
+        points = arc->points;
+    }
+    else
+    {
+        if (arcPointsCapacity < (segments + 1))
+        {
+            Vector2 *newPoints = (Vector2 *)RL_REALLOC(arcPoints, (segments + 1)*sizeof(Vector2));
+            if (newPoints == NULL) return NULL;
+
+            arcPoints = newPoints;
+            arcPointsCapacity = segments + 1;
+        }
+
+        points = arcPoints;
+    }
+
+    float angle = startAngle;
+
+    if (pairs)
+    {
+        for (int i = 0; i < segments/2; i++)
+        {
+            points[2*i] = (Vector2){ cosf(DEG2RAD*angle), sinf(DEG2RAD*angle) };
+            points[2*i + 1] = (Vector2){ cosf(DEG2RAD*(angle + stepLength)), sinf(DEG2RAD*(angle + stepLength)) };
+            angle += (stepLength*2.0f);
+        }
+
+        points[2*(segments/2)] = (Vector2){ cosf(DEG2RAD*angle), sinf(DEG2RAD*angle) };
+        if ((segments%2) == 1) points[segments] = (Vector2){ cosf(DEG2RAD*(angle + stepLength)), sinf(DEG2RAD*(angle + stepLength)) };
+    }
+    else
+    {
+        for (int i = 0; i <= segments; i++)
+        {
+            points[i] = (Vector2){ cosf(DEG2RAD*angle), sinf(DEG2RAD*angle) };
+            angle += stepLength;
+        }
+    }
+
+    return points;
+}
+
+// Add strip vertex pair for a polyline point, tangent direction must be normalized
+// NOTE: Miter scale keeps stroke thickness on joins: 1/cos(angle/2) for a turn of angle
+static void SplineStrokeAddVertex(SplineStroke *stroke, Vector2 point, float tx, float ty, float miter)
+{
+    float nx = ty*stroke->halfThick*miter;
+    float ny = -tx*stroke->halfThick*miter;
+
+    stroke->strip[stroke->vertexCount] = (Vector2){ point.x + nx, point.y + ny };
+    stroke->strip[stroke->vertexCount + 1] = (Vector2){ point.x - nx, point.y - ny };
+    stroke->vertexCount += 2;
+
+    // Strip buffer full, draw it and keep last vertex pair to continue the strip
+    if (stroke->vertexCount >= (2*SPLINE_SEGMENT_MAX_DIVISIONS + 2))
+    {
+        DrawTriangleStrip(stroke->strip, stroke->vertexCount, stroke->color);
+
+        stroke->strip[0] = stroke->strip[stroke->vertexCount - 2];
+        stroke->strip[1] = stroke->strip[stroke->vertexCount - 1];
+        stroke->vertexCount = 2;
+    }
+}
+
+// Add point to spline stroke
+// NOTE: Strip vertex for previous point are computed using the direction
+// halfway between its incoming and outgoing segments
+static void SplineStrokeAddPoint(SplineStroke *stroke, Vector2 point)
+{
+    if (stroke->pointCount == 0)
+    {
+        stroke->current = point;
+        stroke->pointCount = 1;
+        return;
+    }
+
+    float dx = point.x - stroke->current.x;
+    float dy = point.y - stroke->current.y;
+    float length = sqrtf(dx*dx + dy*dy);
+
+    if (length < 0.001f) return;    // Skip (almost) duplicated points, direction can not be computed
+
+    dx /= length;
+    dy /= length;
+
+    if (stroke->pointCount == 1) SplineStrokeAddVertex(stroke, stroke->current, dx, dy, 1.0f);
+    else
+    {
+        float px = stroke->current.x - stroke->previous.x;
+        float py = stroke->current.y - stroke->previous.y;
+        float plength = sqrtf(px*px + py*py);
+
+        // Sum of unit directions length is 2*cos(angle/2), miter scale is clamped to SPLINE_MITER_LIMIT
+        // NOTE: Sharp turns get a clamped (shorter) miter instead of a spike
+        float tx = px/plength + dx;
+        float ty = py/plength + dy;
+        float tlength = sqrtf(tx*tx + ty*ty);
+        float miter = (tlength > (2.0f/SPLINE_MITER_LIMIT))? 2.0f/tlength : SPLINE_MITER_LIMIT;
+
+        // Polyline going backwards, use incoming direction
+        if (tlength < 0.001f) SplineStrokeAddVertex(stroke, stroke->current, px/plength, py/plength, 1.0f);
+        else SplineStrokeAddVertex(stroke, stroke->current, tx/tlength, ty/tlength, miter);
+    }
+
+    stroke->previous = stroke->current;
+    stroke->current = point;
+    stroke->pointCount++;
+}
+
+// Add cubic segment points to spline stroke, segment defined by polynomial coefficients:
+// x(t) = a[0]*t^3 + a[1]*t^2 + a[2]*t + a[3], y(t) = b[0]*t^3 + b[1]*t^2 + b[2]*t + b[3]
+// NOTE: Subdivisions are adapted to segment curvature, straight segments require only one,
+// distance between curve and subdivision is bounded by max(|P''(t)|)/(8*divisions^2)
+// WARNING: Error rate is measured in world units (before any camera transform), zoomed in
+// curves (Camera2D zoom > 1.0f) could look faceted, SPLINE_SEGMENT_ERROR_RATE can be reduced
+static void SplineStrokeAddCubic(SplineStroke *stroke, const float *a, const float *b, bool skipFirst)
+{
+    float x[SPLINE_SEGMENT_MAX_DIVISIONS + 1] = { 0 };
+    float y[SPLINE_SEGMENT_MAX_DIVISIONS + 1] = { 0 };
+
+    // Second derivative is linear in t, so its max magnitude is at t = 0 or t = 1
+    float ddx0 = 2.0f*a[1], ddy0 = 2.0f*b[1];
+    float ddx1 = 6.0f*a[0] + 2.0f*a[1], ddy1 = 6.0f*b[0] + 2.0f*b[1];
+    float curvature = sqrtf(fmaxf(ddx0*ddx0 + ddy0*ddy0, ddx1*ddx1 + ddy1*ddy1));
+
+    int divisions = (int)ceilf(sqrtf(curvature/(8.0f*SPLINE_SEGMENT_ERROR_RATE)));
+    if (divisions < 1) divisions = 1;
+    if (divisions > SPLINE_SEGMENT_MAX_DIVISIONS) divisions = SPLINE_SEGMENT_MAX_DIVISIONS;
+
+    // Evaluate all segment points in one pass per component,
+    // no dependencies between iterations so loops can be vectorized
+    const float step = 1.0f/(float)divisions;
+
+    for (int i = 0; i <= divisions; i++)
+    {
+        float t = step*(float)i;
+        x[i] = a[3] + t*(a[2] + t*(a[1] + t*a[0]));
+    }
+
+    for (int i = 0; i <= divisions; i++)
+    {
+        float t = step*(float)i;
+        y[i] = b[3] + t*(b[2] + t*(b[1] + t*b[0]));
+    }
+
+    for (int i = (skipFirst? 1 : 0); i <= divisions; i++) SplineStrokeAddPoint(stroke, (Vector2){ x[i], y[i] });
+}
+
+// End spline stroke, draw pending strip vertex
+static void SplineStrokeEnd(SplineStroke *stroke)
+{
+    if (stroke->pointCount >= 2)
+    {
+        float dx = stroke->current.x - stroke->previous.x;
+        float dy = stroke->current.y - stroke->previous.y;
+        float length = sqrtf(dx*dx + dy*dy);
+
+        SplineStrokeAddVertex(stroke, stroke->current, dx/length, dy/length, 1.0f);
+    }
+
+    if (stroke->vertexCount >= 4) DrawTriangleStrip(stroke->strip, stroke->vertexCount, stroke->color);
+
+    stroke->vertexCount = 0;
+}
+
+// Add shape vertex (position), current texture coordinate and color are used
+static void AddShapeVertex(float x, float y)
+{
+    shapeVertices.vertices[2*shapeVertices.vertexCount] = x;
+    shapeVertices.vertices[2*shapeVertices.vertexCount + 1] = y;
+    shapeVertices.vertexCount++;
+
+    if (shapeVertices.vertexCount == SHAPES_VERTEX_BLOCK_SIZE) FlushShapeVertices();
+}
+
+// Add shape vertex (position and texture coordinates)
+static void AddShapeVertexTexCoord(float x, float y, float u, float v)
+{
+    shapeVertices.texcoords[2*shapeVertices.vertexCount] = u;
+    shapeVertices.texcoords[2*shapeVertices.vertexCount + 1] = v;
+    shapeVertices.useTexcoords = true;
+
+    AddShapeVertex(x, y);
+}
+
+// Add shape vertex (position and color)
+static void AddShapeVertexColor(float x, float y, Color color)
+{
+    shapeVertices.colors[4*shapeVertices.vertexCount] = color.r;
+    shapeVertices.colors[4*shapeVertices.vertexCount + 1] = color.g;
+    shapeVertices.colors[4*shapeVertices.vertexCount + 2] = color.b;
+    shapeVertices.colors[4*shapeVertices.vertexCount + 3] = color.a;
+    shapeVertices.useColors = true;
+
+    AddShapeVertex(x, y);
+}
+
+// Append pending shape vertex to render batch
+// NOTE: Required before rlEnd(), all vertex are added with one single call
+static void FlushShapeVertices(void)
+{
+    if (shapeVertices.vertexCount > 0)
+    {
+        rlAppendVertices2D(shapeVertices.vertices, shapeVertices.useTexcoords? shapeVertices.texcoords : NULL,
+            shapeVertices.useColors? shapeVertices.colors : NULL, shapeVertices.vertexCount);
+    }
+
+    shapeVertices.vertexCount = 0;
+    shapeVertices.useTexcoords = false;
+    shapeVertices.useColors = false;
+}
+
 #endif      // SUPPORT_MODULE_RSHAPES
@@ -144,6 +144,7 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static void UnloadFontResource(void *resource); // Unload cached font, required by resources cache
 static int textLineSpacing = 15;                // Text vertical line spacing in pixels
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -376,6 +377,28 @@ Font LoadFont(const char *fileName)
     return font;
 }
 
+// Load font from file through resources cache
+// NOTE: Font is shared between all users loading same file, it must be released with UnloadFontCached()
+Font LoadFontCached(const char *fileName)
+{
+    Font *cached = (Font *)GetCachedResource(RESOURCE_FONT, fileName, 0);
+    if (cached != NULL) return *cached;
+
+    Font font = LoadFont(fileName);
+
+    // NOTE: Default font (returned on failure) is not cached
+    if ((font.texture.id > 0) && (font.texture.id != GetFontDefault().texture.id))
+    {
+        unsigned int ramSize = font.glyphCount*(sizeof(GlyphInfo) + sizeof(Rectangle));
+        for (int i = 0; i < font.glyphCount; i++) ramSize += GetPixelDataSize(font.glyphs[i].image.width, font.glyphs[i].image.height, font.glyphs[i].image.format);
+
+        AddCachedResource(RESOURCE_FONT, fileName, 0, &font, sizeof(Font), font.texture.id,
+                          ramSize, GetPixelDataSize(font.texture.width, font.texture.height, font.texture.format), UnloadFontResource);
+    }
+
+    return font;
+}
+
 // Load Font from TTF or BDF font file with generation parameters
 // NOTE: You can pass an array with desired characters, those characters should be available in the font
 // if array is NULL, default char set is selected 32..126
@@ -958,6 +981,15 @@ void UnloadFont(Font font)
     }
 }
 
+// Release font loaded with LoadFontCached(), font is unloaded when not referenced and cache is over budget
+void UnloadFontCached(Font font)
+{
+    if ((font.texture.id > 0) && (font.texture.id != GetFontDefault().texture.id) && !ReleaseCachedResource(RESOURCE_FONT, font.texture.id))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Font not loaded with LoadFontCached(), not released");
+    }
+}
+
 // Export font as code file, returns true on success
 bool ExportFontAsCode(Font font, const char *fileName)
 {
@@ -2079,6 +2111,12 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Unload cached font, required by resources cache
+static void UnloadFontResource(void *resource)
+{
+    UnloadFont(*(Font *)resource);
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -77,6 +77,14 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in block compression encoders]
+#include <stdint.h>             // Required for: SIZE_MAX [Used in InitImageDownscaler()]
+
+// SSE2 is always available on x86-64, used for direct pixel format conversion and image drawing
+#if !defined(__TINYC__) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in PackPixelsRGBA(), UnpackPixelsRGBA(), BlendPixels*()]
+    #define RL_TEXTURES_SIMD_SSE2
+#endif
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -244,15 +252,446 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef IMAGE_JOB_MIN_PIXELS
+    #define IMAGE_JOB_MIN_PIXELS  65536    // Minimum number of pixels processed by every image job chunk (worker threads)
+#endif
+
+#ifndef IMAGE_TRANSFORM_TILE_SIZE
+    #define IMAGE_TRANSFORM_TILE_SIZE 32   // Image rotation tiles size in pixels (cache blocking), multiple of 8
+#endif
+
+#ifndef KERNEL_SEPARABLE_EPSILON
+    #define KERNEL_SEPARABLE_EPSILON 1e-5f  // Relative tolerance to consider a convolution kernel separable (rank 1)
+#endif
+
+#ifndef MIPMAP_KAISER_RADIUS
+    #define MIPMAP_KAISER_RADIUS    1.5f    // Kaiser mipmaps filter radius (destination pixels)
+#endif
+
+#ifndef MIPMAP_KAISER_ALPHA
+    #define MIPMAP_KAISER_ALPHA     4.0f    // Kaiser mipmaps filter window shape, higher values are smoother
+#endif
+
+#define MIPMAP_ENCODE_TABLE_SIZE  4096      // Linear values to 8 bit conversion table entries [ImageMipmapsEx()]
+
+#define PALETTE_CACHE_BITS          12      // Nearest palette color lookups cached per job range: 1 << bits [LoadImagePaletteIndices()]
+#define PALETTE_SEARCH_CELLS     16384      // Palette nearest color search cells: 16*16*16 colors, 4 alpha values [LoadImagePaletteIndices()]
+
+#ifndef IMAGE_CONVERT_BLOCK_SIZE
+    #define IMAGE_CONVERT_BLOCK_SIZE 256    // Number of pixels converted per block on direct pixel format conversion
+#endif
+
+#ifndef IMAGE_STREAM_BUFFER_SIZE
+    #define IMAGE_STREAM_BUFFER_SIZE 16384  // Size of file data blocks read by streaming image loading [LoadImageResized()]
+#endif
+
+#define IMAGE_STREAM_MAX_SIZE  (1 << 24)    // Maximum source width/height streamed, bigger images use full loading [LoadImageResized()]
+
+#define INFLATE_WINDOW_SIZE      32768      // Deflate streams window size, matches distance limit
+#define INFLATE_FAST_BITS            9      // Huffman codes up to this length are decoded with a lookup table
+
+#define DEFLATE_HASH_BITS           15      // Deflate encoder matches hash table size: 1 << bits [ExportImage()]
+#define DEFLATE_MAX_CHAIN           16      // Deflate encoder maximum positions checked per match search
+#define DEFLATE_NICE_LENGTH        128      // Deflate encoder match length that stops searching
+
+#ifndef PNG_DEFLATE_CHUNK_SIZE
+    #define PNG_DEFLATE_CHUNK_SIZE 131072   // PNG export filtered data is compressed in independent chunks of this size
+#endif
+
+#ifndef MAX_IMAGE_EXPORT_REQUESTS
+    #define MAX_IMAGE_EXPORT_REQUESTS   8   // Maximum number of images waiting for background export, new requests wait for a free slot
+#endif
+
+#ifndef MAX_ANIM_DECODED_FRAMES
+    #define MAX_ANIM_DECODED_FRAMES     3   // Maximum number of animation frames decoded ahead of time [ImageAnim]
+#endif
+
+#ifndef MAX_TEXTURE_ASYNC_REQUESTS
+    #define MAX_TEXTURE_ASYNC_REQUESTS  256 // Maximum number of texture async requests loaded at the same time
+#endif
+
+#ifndef TEXTURE_ASYNC_UPLOAD_BUDGET
+    #define TEXTURE_ASYNC_UPLOAD_BUDGET 2.0f    // Default GPU upload time budget per frame (milliseconds)
+#endif
+
+#ifndef TEXTURE_ASYNC_UPLOAD_BAND_SIZE
+    #define TEXTURE_ASYNC_UPLOAD_BAND_SIZE 262144   // Texture data uploaded per step (bytes), bigger textures are uploaded by rows bands
+#endif
+
+#ifndef DITHER_PROGRESS_STEP
+    #define DITHER_PROGRESS_STEP     32    // Number of pixels processed between rows progress updates on ImageDither()
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Image processing job data, shared by pixels range processing functions
+// NOTE: Range functions only write pixels inside their range, so jobs can be split between threads
+typedef struct ImageJob {
+    Image image;                // Source image (or destination image for ImageFormat())
+    void *output;               // Output pixels data
+    Vector4 *pixels;            // Normalized pixels data (source for ImageFormat())
+    Color color;                // Color parameter: tint, color to replace
+    Color replace;              // Color parameter: replacement color
+    float factor;               // Float parameter: contrast
+    int value;                  // Integer parameter: brightness
+} ImageJob;
+
+// Image drawing job data, destination rows are processed independently
+typedef struct BlitJob {
+    Image *dst;                 // Destination image
+    Image src;                  // Source image
+    int srcX, srcY;             // Source rectangle position (clipped to source image)
+    int srcWidth, srcHeight;    // Source rectangle size (clipped to source image)
+    int dstX, dstY;             // Destination rectangle position
+    int dstWidth, dstHeight;    // Destination rectangle size (scaled source size)
+    int clipX, clipY;           // Destination rectangle position (clipped to destination image)
+    int clipWidth, clipHeight;  // Destination rectangle size (clipped to destination image)
+    int *columns;               // Source column for every clipped destination column (scaled drawing)
+    int *weights;               // Bilinear weight for every clipped destination column (8bit fraction)
+    Color tint;                 // Color tint applied to source
+    int blendMode;              // Blend mode (BlendMode type)
+    int filter;                 // Scaling filter (TextureFilter type)
+    bool opaque;                // Source has no alpha and no tint is applied, no blending required
+} BlitJob;
+
+// Block compression job data, rows of 4x4 pixels blocks are processed independently
+typedef struct BlockJob {
+    Color *pixels;              // Uncompressed pixels data (R8G8B8A8)
+    unsigned char *blocks;      // Compressed blocks data
+    int width;                  // Image width (pixels)
+    int height;                 // Image height (pixels)
+    int format;                 // Compressed pixel format
+    int quality;                // Compression quality (CompressQuality type)
+} BlockJob;
+
+// Colors histogram bin, colors reduced to 5 bits per channel [LoadImagePaletteQuantized()]
+typedef struct ColorBin {
+    unsigned int count;         // Pixels count
+    unsigned long long sum[4];  // Pixels channels sum (64-bit, 32-bit overflows above 16M pixels per bin)
+    int key;                    // Sorting key, bin mean value of box split channel
+} ColorBin;
+
+// Palette nearest color search, colors space is split in cells with nearest color candidates [LoadImagePaletteIndices()]
+// NOTE: Cells cover 16 values per color channel and 64 values for alpha: 16*16*16*4 cells
+typedef struct PaletteSearch {
+    const Color *palette;       // Palette colors (up to 256)
+    int count;                  // Palette colors count
+    int *cellStarts;            // Cells candidates ranges: [cellStarts[i], cellStarts[i + 1])
+    unsigned char *candidates;  // Cells candidates palette indices (ascending)
+} PaletteSearch;
+
+// Palette indices job data, pixels ranges are mapped independently
+typedef struct PaletteJob {
+    const Color *pixels;        // Source pixels (transparent pixels normalized to BLANK)
+    unsigned char *indices;     // Output palette indices
+    const PaletteSearch *search;    // Palette nearest color search
+} PaletteJob;
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Noise generation job data, rows (or pixels ranges) are generated independently
+typedef struct NoiseJob {
+    Color *pixels;              // Output pixels
+    int width, height;          // Image size
+    unsigned int key;           // White noise: counter-based generator key
+    unsigned int threshold;     // White noise: white pixels probability (24 bit fraction)
+    int offsetX, offsetY;       // Perlin noise: offset
+    float scale;                // Perlin noise: scale
+    const Vector2 *seeds;       // Cellular: tiles seeds
+    int tileSize;               // Cellular: tile size
+    int seedsPerRow, seedsPerCol;   // Cellular: seeds count per row and column
+} NoiseJob;
+#endif
+
+// Mipmaps generation settings for textures loaded from files
+typedef struct MipmapsConfig {
+    bool enabled;               // Generate mipmaps for loaded images (uncompressed images without mipmaps)
+    int filter;                 // Mipmaps filter (MipmapFilter type)
+    bool srgb;                  // Color channels averaged in linear space
+    float alphaCutoff;          // Alpha test coverage cutoff, 0.0f disables coverage preservation
+} MipmapsConfig;
+
+// Texture async loading request
+// NOTE: Requests being loaded are owned by loader thread, decoded requests are owned by render thread
+typedef struct TextureRequest {
+    int state;                  // Request state (TextureAsyncState type)
+    unsigned int sequence;      // Request order, requests are loaded and uploaded first in, first out
+    char *fileName;             // Image file name
+    bool decoding;              // Image is being decoded by loader thread
+    bool cancelled;             // Request unloaded while decoding, loader thread releases it
+    bool notified;              // Callback already called for this request
+    Image image;                // Decoded image, released once uploaded
+    Texture2D texture;          // Uploaded texture (size and format available once decoded)
+    int uploadedRows;           // Image rows already uploaded to texture
+    MipmapsConfig mipmaps;      // Mipmaps generation settings at request time
+    bool cached;                // Texture owned by resources cache, request keeps one reference
+} TextureRequest;
+
+// Texture async loader, shared between loader thread and render thread
+typedef struct TextureLoader {
+    ThreadMutex mutex;          // Requests state access mutex
+    ThreadCondition requestReady;   // Signaled when a new request is available (or loader closing)
+    ThreadHandle thread;        // Loader thread
+    bool initialized;           // Loader mutex and condition initialized
+    bool started;               // Loader thread running, otherwise requests are decoded by UpdateTextureAsync()
+    bool quit;                  // Loader thread must exit
+    unsigned int sequence;      // Requests counter
+    float uploadBudget;         // GPU upload time budget per UpdateTextureAsync() call (milliseconds)
+    Texture2D placeholder;      // Texture returned for not ready requests
+    bool defaultPlaceholder;    // Placeholder texture loaded internally
+    TextureAsyncCallback callback;  // Finished requests callback
+    TextureRequest requests[MAX_TEXTURE_ASYNC_REQUESTS];
+} TextureLoader;
+
+// Image export file format, resolved from file name extension
+// NOTE: Background exports resolve it on calling thread, IsFileExtension() is not reentrant
+typedef enum {
+    IMAGE_EXPORT_NONE = 0,      // File format not supported
+    IMAGE_EXPORT_PNG,           // PNG file
+    IMAGE_EXPORT_BMP,           // BMP file
+    IMAGE_EXPORT_TGA,           // TGA file
+    IMAGE_EXPORT_JPG,           // JPG file
+    IMAGE_EXPORT_QOI,           // QOI file
+    IMAGE_EXPORT_DDS,           // DDS file
+    IMAGE_EXPORT_KTX,           // KTX file
+    IMAGE_EXPORT_RAW            // Raw pixel data (no header)
+} ImageExportFormat;
+
+// Image background export request, image data is owned by request
+typedef struct ExportRequest {
+    Image image;                // Image to export
+    char *fileName;             // Export file name
+    int format;                 // Export file format (ImageExportFormat), resolved on calling thread
+} ExportRequest;
+
+// Image background exporter, requests are exported first in, first out
+typedef struct ImageExporter {
+    ThreadMutex mutex;          // Requests queue access mutex
+    ThreadCondition requestReady;   // Signaled when a new request is available (or exporter closing)
+    ThreadCondition requestDone;    // Signaled when a request is exported (queue slot available)
+    ThreadHandle thread;        // Exporter thread
+    bool initialized;           // Exporter mutex and conditions initialized
+    bool started;               // Exporter thread running, otherwise images are exported on calling thread
+    bool quit;                  // Exporter thread must exit once queue is empty
+    int first;                  // First request in queue
+    int count;                  // Number of requests in queue (including request being exported)
+    ExportRequest requests[MAX_IMAGE_EXPORT_REQUESTS];
+} ImageExporter;
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Animation decoded frame [ImageAnim]
+typedef struct AnimFrame {
+    unsigned char *data;        // Frame pixels (R8G8B8A8)
+    int index;                  // Frame index
+} AnimFrame;
+
+// Animated GIF stream decoder, frames are decoded in order (ahead of time by decoder thread, if available)
+// NOTE: GIF decoding state is only accessed by decoder thread (or by calling thread if not started),
+// decoded frames queue is shared and protected by mutex
+typedef struct AnimDecoder {
+    unsigned char *fileData;    // GIF file data
+    int dataSize;               // GIF file data size
+    stbi__context context;      // GIF data reader
+    stbi__gif *gif;             // GIF decoder state, including current frame canvas
+    unsigned char *history[2];  // Previous canvases, only required by frames disposed to previous (NULL otherwise)
+    int frameSize;              // Frame data size
+    int frameCount;             // Number of frames
+    int *frameStarts;           // Frames start time (milliseconds), frameCount + 1 values
+    int nextIndex;              // Next frame to be decoded
+
+    ThreadMutex mutex;          // Decoded frames queue mutex
+    ThreadCondition frameChange;    // Broadcasted when a frame is decoded, consumed or requested
+    ThreadHandle thread;        // Decoder thread
+    bool started;               // Decoder thread running, otherwise frames are decoded on demand by calling thread
+    bool quit;                  // Decoder thread must exit
+    bool error;                 // Decoding failed, no more frames available
+    int seekIndex;              // Requested frame not decoded yet, frames decoded before are skipped (-1 if none)
+    int first;                  // First decoded frame in queue
+    int count;                  // Number of decoded frames in queue
+    AnimFrame frames[MAX_ANIM_DECODED_FRAMES];
+} AnimDecoder;
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Deflate encoder bits writer, bits are written least significant bit first [ExportImage()]
+typedef struct DeflateWriter {
+    unsigned char *output;      // Output data
+    int size;                   // Output data size
+    unsigned long long bits;    // Bits not written yet
+    int count;                  // Number of bits not written yet
+} DeflateWriter;
+
+// PNG encoder job data, rows are filtered in parallel and filtered data chunks are compressed in parallel [ExportImage()]
+typedef struct PngEncoder {
+    const unsigned char *pixels;    // Source pixels data, 8 bit per channel
+    int width, height;          // Image size
+    int channels;               // Channels per pixel
+    unsigned char *filtered;    // Filtered rows, every row starts with filter type
+    int filteredSize;           // Filtered rows data size
+    int chunkCount;             // Number of compressed chunks
+    unsigned char **chunks;     // Compressed chunks data (deflate blocks)
+    int *chunkSizes;            // Compressed chunks data size
+    unsigned int *chunkAdlers;  // Chunks uncompressed data Adler-32 checksums
+    unsigned short codes[288];  // Fixed Huffman literal/length codes (bits reversed)
+    unsigned char codeLengths[288];     // Fixed Huffman literal/length codes lengths
+    unsigned char distanceCodes[30];    // Fixed distance codes (bits reversed)
+    unsigned char lengthSymbols[259];   // Match length to length symbol (0..28)
+    unsigned char distanceSymbols[512]; // Match distance to distance symbol: [distance - 1] up to 256, [256 + ((distance - 1) >> 7)] otherwise
+} PngEncoder;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PNG) || defined(SUPPORT_FILEFORMAT_QOI)
+// Image file stream, file data is read in small blocks [LoadImageResized()]
+typedef struct ImageStream {
+    FILE *file;                 // File handle
+    unsigned char *buffer;      // File data block
+    int size;                   // File data block size
+    int position;               // Read position in file data block
+    bool chunked;               // Data is split in PNG chunks (only IDAT chunks data is read)
+    unsigned int chunkSize;     // Remaining data in current chunk
+    bool error;                 // Read past the end of data
+} ImageStream;
+
+// Incremental area-averaging downscaler, source rows are added in order [LoadImageResized()]
+typedef struct ImageDownscaler {
+    int width, height;          // Source size
+    int newWidth, newHeight;    // Output size
+    int channels;               // Channels per pixel (8 bit)
+    int *columns;               // Output column for every source column
+    int *weights;               // Output column weight for every source column (remaining weight goes to next column)
+    unsigned long long *row;    // Current source row, horizontally downscaled (weighted sums)
+    unsigned long long *sums;   // Weighted sums for current and next output rows
+    int sourceRow;              // Next source row
+    int outputRow;              // Current output row
+    unsigned char *output;      // Output pixels data
+} ImageDownscaler;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// Huffman codes decoding table (canonical codes) [LoadImageResized()]
+typedef struct InflateHuffman {
+    short count[16];            // Number of codes for every code length
+    short symbol[288];          // Symbols ordered by code
+    short fast[1 << INFLATE_FAST_BITS];   // Short codes lookup: (symbol << 4) | length, 0 if code is longer
+} InflateHuffman;
+
+// Inflate (deflate decompression) stream state, data is decompressed on demand [LoadImageResized()]
+typedef struct InflateState {
+    ImageStream *stream;        // Compressed data stream
+    unsigned int bitBuffer;     // Bits not consumed yet
+    int bitCount;               // Number of bits in buffer
+    unsigned char window[INFLATE_WINDOW_SIZE];  // Last decompressed data, required by matches
+    unsigned int windowPosition;// Total decompressed data size (window position is wrapped)
+    InflateHuffman literals;    // Literal/length codes for current block
+    InflateHuffman distances;   // Distance codes for current block
+    int blockType;              // Current block type: 0-stored, 1-fixed codes, 2-dynamic codes, -1-no block
+    bool lastBlock;             // Current block is the last one
+    int storedSize;             // Stored block remaining data
+    int copyLength;             // Pending match length
+    int copyDistance;           // Pending match distance
+    bool error;                 // Corrupted or truncated data
+} InflateState;
+#endif
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Image kernel convolution job data, processed by rows ranges
+typedef struct ConvolutionJob {
+    Color *pixels;              // Source pixels
+    Vector4 *normalized;        // Source pixels (normalized)
+    Color *output;              // Convolution result
+    float *kernel;              // Convolution kernel
+    float *kernelRow;           // Separable kernel, horizontal factor
+    float *kernelColumn;        // Separable kernel, vertical factor
+    Vector4 *rows;              // Separable kernel, horizontal pass result (padded rows)
+    int *sums;                  // Box kernel, horizontal window sums (padded rows)
+    int kernelWidth;            // Kernel width (kernel is square)
+    int startRange;             // Kernel offset range start
+    int endRange;               // Kernel offset range end
+    int width;                  // Image width
+    int height;                 // Image height
+} ConvolutionJob;
+
+// Mipmap level generation job data, destination rows are processed independently
+typedef struct MipmapJob {
+    const unsigned char *input; // Source level pixels
+    unsigned char *output;      // Destination level pixels
+    int width, height;          // Source level size
+    int newWidth, newHeight;    // Destination level size
+    int channels;               // Channels per pixel (8 bit)
+    bool box;                   // Even size 2x2 box filter without conversion, integer averaging
+    int taps;                   // Filter taps per destination column and row
+    int *columns;               // Source column for every destination column tap
+    float *columnWeights;       // Weight for every destination column tap
+    int *rows;                  // Source row for every destination row tap
+    float *rowWeights;          // Weight for every destination row tap
+    const float *decode[4];     // Channels 8 bit to linear value conversion tables (256 entries)
+    const unsigned char *encode[4];  // Channels linear value to 8 bit conversion tables (MIPMAP_ENCODE_TABLE_SIZE entries)
+} MipmapJob;
+
+// Image transform job data, processed by rows or tiles rows ranges [ImageFlip*(), ImageRotate*()]
+typedef struct TransformJob {
+    const unsigned char *input; // Source pixels
+    unsigned char *output;      // Destination pixels (same as source for in-place transforms)
+    int width, height;          // Source size
+    int newWidth, newHeight;    // Destination size
+    int bytesPerPixel;          // Bytes per pixel (uncompressed formats, up to 16)
+    bool clockwise;             // 90 degrees rotation direction
+    float sinRadius;            // Arbitrary angle rotation sine
+    float cosRadius;            // Arbitrary angle rotation cosine
+} TransformJob;
+
+// Image dithering job data, rows are processed as a wavefront
+typedef struct DitherJob {
+    Color *pixels;              // Source pixels, error is diffused in-place
+    unsigned short *output;     // Dithered pixels (16bpp)
+    int width;                  // Image width
+    int height;                 // Image height
+    int rBpp, gBpp, bBpp, aBpp; // Bits per channel
+    volatile int *progress;     // Pixels processed per row
+    volatile int nextRow;       // Next row to be processed
+} DitherJob;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static TextureLoader textureLoader = { 0 };     // Texture async loader state
+static MipmapsConfig textureMipmaps = { 0 };    // Mipmaps generation for textures loaded from files
+static ImageExporter imageExporter = { 0 };     // Image background exporter state
+
+// ETC1/ETC2 intensity modifier tables, indexed by pixel index: (msb << 1) | lsb
+static const int etcModifiers[8][4] = {
+    { 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 },
+    { 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+};
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Perlin noise gradients, same as stb_perlin gradients basis
+static const float perlinGradients[12][3] = {
+    { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+    { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+    { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 }
+};
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Deflate length and distance symbols base values and extra bits (RFC 1951)
+static const short deflateLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const unsigned char deflateLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const unsigned short deflateDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const unsigned char deflateDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+#endif
+
+// ETC2 T and H modes distances table
+static const int etcDistances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+// ETC2 EAC alpha modifier tables
+static const int eacModifiers[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -262,9 +701,120 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
-static float HalfToFloat(unsigned short x);
-static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static int GetPixelComponentsCount(int format);             // Get number of components stored per pixel (uncompressed formats)
+
+// Pixels range processing functions, required by ParallelFor()
+static void LoadImageColorsRange(void *data, int start, int end);
+static void LoadImageDataNormalizedRange(void *data, int start, int end);
+static void FormatImageRange(void *data, int start, int end);
+static bool IsPixelFormatDirectConvertible(int format, int newFormat);  // Check if pixel format conversion can avoid float intermediate
+static void UnpackPixelsRGBA(const void *data, int format, int offset, int count, Color *output);  // Unpack 8bit or 16bit pixels to RGBA8
+static void PackPixelsRGBA(const Color *pixels, int count, int format, void *data, int offset);    // Pack RGBA8 pixels to 8bit or 16bit format
+static void ConvertImageRange(void *data, int start, int end);
+static void LoadBlitSourceRow(Image src, int x, int y, int count, Color *colors);                    // Load source pixels row as RGBA8 colors for image drawing
+static void BlendPixelsAlpha(Color *dst, const Color *src, int count, Color tint);                   // Blend source pixels over destination pixels (alpha blending)
+static void BlendPixelsPremultiplied(Color *dst, const Color *src, int count, Color tint);           // Blend premultiplied source pixels over destination pixels
+static void ImageDrawRange(void *data, int start, int end);
+static int GetMipmapsDataSize(int width, int height, int format, int mipmaps);  // Get data size of all mipmap levels
+static unsigned long long GetMipmapsConfigKey(MipmapsConfig config);          // Get mipmaps generation settings key, identifies cached textures variant
+static void UnloadImageResource(void *resource);                            // Unload cached image, required by resources cache
+static void UnloadTextureResource(void *resource);                          // Unload cached texture, required by resources cache
+static TextureRequest *GetNextTextureRequest(int state);                    // Get oldest texture async request in state (not decoding)
+static void DecodeTextureRequest(TextureRequest *request);                  // Decode texture async request image (mutex must be locked)
+static bool UploadTextureRequest(TextureRequest *request);                  // Upload next texture async request data step to GPU, returns true when finished
+static void TextureLoaderThread(void *data);                                // Loader thread: wait for requests and decode images
+static void ImageExporterThread(void *data);                                // Exporter thread: wait for requests and export images
+static int GetImageExportFormat(const char *fileName);                      // Get image export file format from file name extension
+static bool ExportImageFormat(Image image, const char *fileName, int format);   // Export image data to file in provided file format
+#if defined(SUPPORT_FILEFORMAT_GIF)
+static ImageAnim LoadAnimGIF(unsigned char *fileData, int dataSize);        // Load animated GIF stream (file data ownership is transferred)
+static int *ScanFramesGIF(const unsigned char *data, int dataSize, int *frameCount, bool *disposePrevious);  // Get GIF frames delay without decoding (milliseconds)
+static void RewindAnimDecoder(AnimDecoder *decoder);                        // Restart GIF decoding from first frame
+static bool DecodeAnimFrame(AnimDecoder *decoder);                          // Decode next GIF frame into decoder canvas (looped)
+static bool ReadAnimFrame(AnimDecoder *decoder, int index, unsigned char *output);  // Read decoded frame, frames before required one are skipped
+static void AnimDecoderThread(void *data);                                  // Decoder thread: decode frames ahead of time
+#endif
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize);  // Encode PNG file data (8 bit per channel)
+static void FilterRowsPNGRange(void *data, int start, int end);
+static void CompressChunksPNGRange(void *data, int start, int end);
+static int FindDeflateMatch(const unsigned char *data, const int *head, const int *prev, int base, int position, int maxLength, int *distance);  // Find longest previous match (hash chains)
+static void PutChunkPNG(unsigned char *output, const char *type, int size);   // Set PNG chunk length, type and CRC (chunk data must be already set)
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG) || defined(SUPPORT_FILEFORMAT_QOI)
+static int ReadStreamByte(ImageStream *stream);                             // Read one byte from image file stream
+static bool ReadStreamData(ImageStream *stream, unsigned char *data, int size); // Read data from image file stream
+static bool InitImageDownscaler(ImageDownscaler *scaler, int width, int height, int newWidth, int newHeight, int channels); // Init incremental area-averaging downscaler
+static void AddImageDownscalerRow(ImageDownscaler *scaler, const unsigned char *pixels); // Add next source row to downscaler
+static void CloseImageDownscaler(ImageDownscaler *scaler);                  // Unload downscaler working data
+static Image GetImageDownscaled(ImageDownscaler *scaler);                   // Get downscaled image
+#endif
+#if defined(SUPPORT_FILEFORMAT_PNG)
+static int InflateRead(InflateState *state, unsigned char *output, int count);  // Read decompressed data from inflate stream
+static bool LoadImageStreamPNG(ImageStream *stream, int newWidth, int newHeight, Image *image);  // Load PNG image row by row into downscaler
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+static bool LoadImageStreamQOI(ImageStream *stream, int newWidth, int newHeight, Image *image);  // Load QOI image row by row into downscaler
+#endif
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels);
+static void ResizeImageRange(void *data, int start, int end);
+static int GetBlockDataSize(int format);                                    // Get 4x4 pixels block data size for formats supported by block compression codec
+static int FitEndpointsBC1(const Color *colors, int count, bool fourColors, int quality, unsigned short *color0, unsigned short *color1); // Find BC1 endpoints for colors
+static void EncodeBlockBC1(const Color *block, unsigned char *output, bool alpha, int quality);      // Encode BC1 color block
+static void EncodeBlockBC2Alpha(const Color *block, unsigned char *output);                         // Encode BC2 explicit alpha block
+static void EncodeBlockBC3Alpha(const Color *block, unsigned char *output, int quality);            // Encode BC3 interpolated alpha block
+static int EncodeETCPlanar(const Color *block, int quality, unsigned long long *bits);              // Encode ETC2 planar mode block, returns error
+static int EncodeETCTH(const Color *block, unsigned long long *bits);                               // Encode ETC2 T or H mode block, returns error
+static void EncodeBlockETC(const Color *block, unsigned char *output, bool etc2, int quality);       // Encode ETC1/ETC2 color block
+static void EncodeBlockEAC(const Color *block, unsigned char *output, int quality);                  // Encode ETC2 EAC alpha block
+static void DecodeBlockBC1(const unsigned char *input, Color *block, int format);                   // Decode BC1 color block
+static void DecodeBlockETC(const unsigned char *input, Color *block, bool etc2);                    // Decode ETC1/ETC2 color block
+static void DecodeBlockAlpha(const unsigned char *input, Color *block, int format);                 // Decode BC2, BC3 or EAC alpha block
+static void CompressBlocksRange(void *data, int start, int end);
+static void DecompressBlocksRange(void *data, int start, int end);
+static int GetUniqueColors(const Color *pixels, int count, Color *colors, int maxColors, bool transparent);   // Get unique colors in appearance order, up to maxColors + 1
+static float GetColorBoxVariance(const ColorBin *bins, int start, int end, int *channel);      // Get colors histogram box largest channel variance
+static int CompareColorBins(const void *a, const void *b);                                      // Compare colors histogram bins keys, required by qsort()
+static int GetPaletteMedianCut(ColorBin *bins, int binCount, Color *palette, int paletteSize);  // Get palette from colors histogram (median cut)
+static PaletteSearch LoadPaletteSearch(const Color *palette, int count);                       // Load palette nearest color search cells
+static void UnloadPaletteSearch(PaletteSearch search);                                          // Unload palette nearest color search cells
+static int GetPaletteNearest(const PaletteSearch *search, int r, int g, int b, int a);          // Get palette color nearest to provided values
+static void LoadPaletteIndicesRange(void *data, int start, int end);
+#if defined(SUPPORT_IMAGE_GENERATION)
+static unsigned int GetNoiseHash(unsigned int value);                                           // Get value 32 bit hash, counter-based random generator
+static void GenImageWhiteNoiseRange(void *data, int start, int end);
+static void GetPerlinNoiseCell(int cell, const int *rows, const int *layers, float y, float z, int seed, float *factors, float *constants);  // Get Perlin noise cell corners terms for row
+static void GenImagePerlinNoiseRows(void *data, int start, int end);
+static void GenImageCellularRows(void *data, int start, int end);
+#endif
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ImageAlphaPremultiplyRange(void *data, int start, int end);
+static bool IsKernelSeparable(const float *kernel, int kernelWidth, float *kernelRow, float *kernelColumn);    // Check if convolution kernel is separable (rank 1)
+static void ImageKernelConvolutionRange(void *data, int start, int end);
+static void ImageConvolutionRowsRange(void *data, int start, int end);
+static void ImageConvolutionColumnsRange(void *data, int start, int end);
+static void ImageBoxSumRowsRange(void *data, int start, int end);
+static void ImageBoxSumColumnsRange(void *data, int start, int end);
+static void GetMipmapTaps(int size, int newSize, int filter, int taps, int *indices, float *weights);   // Get mipmap filter taps for every destination pixel of one axis
+static void ImageMipmapRowsRange(void *data, int start, int end);
+static void ScaleAlphaCoverage(unsigned char *pixels, int count, int channels, int cutoff, float coverage);  // Scale mipmap alpha to match alpha test coverage
+static void ImageDitherRows(void *data, int start, int end);
+static void ImageColorTintRange(void *data, int start, int end);
+static void ImageColorInvertRange(void *data, int start, int end);
+static void ImageColorContrastRange(void *data, int start, int end);
+static void ImageColorBrightnessRange(void *data, int start, int end);
+static void ImageColorReplaceRange(void *data, int start, int end);
+static void ImageRotate90(Image *image, bool clockwise);                   // Rotate image 90 degrees (in-place if square)
+static void SwapPixelsReversed(unsigned char *first, unsigned char *last, int count, int bytesPerPixel);    // Swap pixels going forward from first with pixels going backward from last
+static void TransposePixelsBlock(const unsigned char *src, int srcStride, unsigned char *dst, int dstStride, bool reverse, int width, int height, int bytesPerPixel);  // Copy pixels block transposed
+static void ImageFlipVerticalRange(void *data, int start, int end);
+static void ImageFlipHorizontalRange(void *data, int start, int end);
+static void ImageReverseRange(void *data, int start, int end);
+static void ImageRotateTilesRange(void *data, int start, int end);
+static void ImageTransposeTilesRange(void *data, int start, int end);
+static void ImageRotateRowsRange(void *data, int start, int end);
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -300,6 +850,74 @@ Image LoadImage(const char *fileName)
     return image;
 }
 
+// Load image from file through resources cache
+// NOTE: Image is shared between all users loading same file, it must not be modified,
+// it must be released with UnloadImageCached()
+Image LoadImageCached(const char *fileName)
+{
+    Image *cached = (Image *)GetCachedResource(RESOURCE_IMAGE, fileName, 0);
+    if (cached != NULL) return *cached;
+
+    Image image = LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        AddCachedResource(RESOURCE_IMAGE, fileName, 0, &image, sizeof(Image), (unsigned long long)(size_t)image.data,
+                          GetMipmapsDataSize(image.width, image.height, image.format, image.mipmaps), 0, UnloadImageResource);
+    }
+
+    return image;
+}
+
+// Load image from file downscaled to required size
+// NOTE: PNG (non-interlaced) and QOI files are decoded row by row with an area-averaging downscaler,
+// memory required is proportional to output size, other files are fully loaded and resized
+Image LoadImageResized(const char *fileName, int newWidth, int newHeight)
+{
+    Image image = { 0 };
+    bool streamed = false;
+
+    if ((newWidth <= 0) || (newHeight <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Invalid size requested to load image resized");
+        return image;
+    }
+
+#if defined(SUPPORT_FILEFORMAT_PNG) || defined(SUPPORT_FILEFORMAT_QOI)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        ImageStream stream = { 0 };
+        stream.file = file;
+        stream.buffer = (unsigned char *)RL_MALLOC(IMAGE_STREAM_BUFFER_SIZE);
+
+        if (stream.buffer != NULL)
+        {
+        #if defined(SUPPORT_FILEFORMAT_PNG)
+            if (IsFileExtension(fileName, ".png")) streamed = LoadImageStreamPNG(&stream, newWidth, newHeight, &image);
+        #endif
+        #if defined(SUPPORT_FILEFORMAT_QOI)
+            if (IsFileExtension(fileName, ".qoi")) streamed = LoadImageStreamQOI(&stream, newWidth, newHeight, &image);
+        #endif
+        }
+
+        RL_FREE(stream.buffer);
+        fclose(file);
+    }
+#endif
+
+    if (streamed) TRACELOG(LOG_INFO, "IMAGE: [%s] Data loaded and downscaled successfully (%ix%i | %s)", fileName, image.width, image.height, rlGetPixelFormatName(image.format));
+    else
+    {
+        // Image can not be streamed (file format, upscaling, interlacing...), full image is loaded
+        image = LoadImage(fileName);
+        if (image.data != NULL) ImageResize(&image, newWidth, newHeight);
+    }
+
+    return image;
+}
+
 // Load an image from RAW file data
 Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize)
 {
@@ -486,6 +1104,142 @@ Image LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileDat
     return image;
 }
 
+// Load animated image stream
+//  - Frames are decoded on demand, only a few frames are kept in memory
+//  - Frames delay is kept, frame for a given time is retrieved with GetAnimFrame()
+//  - Not animated image formats are loaded as a single frame animation
+ImageAnim LoadImageAnimStream(const char *fileName)
+{
+    ImageAnim anim = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (IsFileExtension(fileName, ".gif"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+        if (fileData != NULL) anim = LoadAnimGIF(fileData, dataSize);
+    }
+#else
+    if (false) { }
+#endif
+    else
+    {
+        anim.image = LoadImage(fileName);
+        if (anim.image.data != NULL) anim.frameCount = 1;
+    }
+
+    if (anim.frameCount > 0) TRACELOG(LOG_INFO, "IMAGE: [%s] Animation stream loaded successfully (%ix%i | %i frames | %.2f s)", fileName, anim.image.width, anim.image.height, anim.frameCount, anim.duration);
+
+    return anim;
+}
+
+// Load animated image stream from memory buffer, fileType refers to extension: i.e. ".gif"
+// NOTE: File data is copied, it is required while animation is loaded
+ImageAnim LoadImageAnimStreamFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    ImageAnim anim = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if ((strcmp(fileType, ".gif") == 0) || (strcmp(fileType, ".GIF") == 0))
+    {
+        if ((fileData != NULL) && (dataSize > 0))
+        {
+            unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+            memcpy(data, fileData, dataSize);
+
+            anim = LoadAnimGIF(data, dataSize);
+        }
+    }
+#else
+    if (false) { }
+#endif
+    else
+    {
+        anim.image = LoadImageFromMemory(fileType, fileData, dataSize);
+        if (anim.image.data != NULL) anim.frameCount = 1;
+    }
+
+    return anim;
+}
+
+// Check if an animated image stream is ready
+bool IsImageAnimReady(ImageAnim anim)
+{
+    return (IsImageReady(anim.image) && (anim.frameCount > 0));
+}
+
+// Unload animated image stream (frames and decoder)
+void UnloadImageAnim(ImageAnim anim)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    AnimDecoder *decoder = (AnimDecoder *)anim.ctxData;
+
+    if (decoder != NULL)
+    {
+        if (decoder->started)
+        {
+            LockThreadMutex(&decoder->mutex);
+            decoder->quit = true;
+            BroadcastThreadCondition(&decoder->frameChange);
+            UnlockThreadMutex(&decoder->mutex);
+
+            JoinThread(&decoder->thread);
+        }
+
+        CloseThreadCondition(&decoder->frameChange);
+        CloseThreadMutex(&decoder->mutex);
+
+        for (int i = 0; i < MAX_ANIM_DECODED_FRAMES; i++) RL_FREE(decoder->frames[i].data);
+        RL_FREE(decoder->history[0]);
+        RL_FREE(decoder->history[1]);
+        RL_FREE(decoder->gif->out);
+        RL_FREE(decoder->gif->background);
+        RL_FREE(decoder->gif->history);
+        RL_FREE(decoder->gif);
+        RL_FREE(decoder->frameStarts);
+        RL_FREE(decoder->fileData);
+        RL_FREE(decoder);
+    }
+#endif
+
+    RL_FREE(anim.frameDelays);
+    UnloadImage(anim.image);
+}
+
+// Get animation frame at time in seconds, animation is looped
+// NOTE: Returned image data is owned by animation and updated by next calls,
+// frames are decoded in order, going back in time requires decoding from first frame
+Image GetAnimFrame(ImageAnim *anim, float time)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    AnimDecoder *decoder = (AnimDecoder *)anim->ctxData;
+
+    if ((decoder != NULL) && (anim->frameCount > 1))
+    {
+        int total = decoder->frameStarts[anim->frameCount];
+        double position = fmod((double)time*1000.0, (double)total);
+        if (position < 0.0) position += total;
+
+        // Find frame containing time position (binary search)
+        int index = 0;
+        int last = anim->frameCount - 1;
+
+        while (index < last)
+        {
+            int middle = (index + last + 1)/2;
+
+            if (decoder->frameStarts[middle] <= position) index = middle;
+            else last = middle - 1;
+        }
+
+        if ((index != anim->currentFrame) && ReadAnimFrame(decoder, index, (unsigned char *)anim->image.data)) anim->currentFrame = index;
+    }
+#endif
+
+    return anim->image;
+}
+
 // Load image from memory buffer, fileType refers to extension: i.e. ".png"
 // WARNING: File extension must be provided in lower-case
 Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
@@ -708,103 +1462,131 @@ void UnloadImage(Image image)
     RL_FREE(image.data);
 }
 
+// Release image loaded with LoadImageCached(), image is unloaded when not referenced and cache is over budget
+void UnloadImageCached(Image image)
+{
+    if ((image.data != NULL) && !ReleaseCachedResource(RESOURCE_IMAGE, (unsigned long long)(size_t)image.data))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Image not loaded with LoadImageCached(), not released");
+    }
+}
+
 // Export image data to file
 // NOTE: File format depends on fileName extension
 bool ExportImage(Image image, const char *fileName)
 {
-    int result = 0;
+    return ExportImageFormat(image, fileName, GetImageExportFormat(fileName));
+}
 
-    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return result;
+// Queue image export on exporter thread, image data ownership is transferred to exporter
+// NOTE: Required by TakeScreenshot(), if queue is full it waits for a free slot,
+// if exporter thread can not be started image is exported on calling thread
+bool QueueImageExport(Image image, const char *fileName)
+{
+    if ((image.data == NULL) || (fileName == NULL))
+    {
+        UnloadImage(image);
+        return false;
+    }
 
-#if defined(SUPPORT_IMAGE_EXPORT)
-    int channels = 4;
-    bool allocatedData = false;
-    unsigned char *imgData = (unsigned char *)image.data;
+    // NOTE: File format is resolved on calling thread, exporter thread must not use IsFileExtension()
+    int format = GetImageExportFormat(fileName);
 
-    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    if (format == IMAGE_EXPORT_NONE)
     {
-        // NOTE: Getting Color array as RGBA unsigned char values
-        imgData = (unsigned char *)LoadImageColors(image);
-        allocatedData = true;
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image, file format not supported", fileName);
+        UnloadImage(image);
+        return false;
     }
 
-#if defined(SUPPORT_FILEFORMAT_PNG)
-    if (IsFileExtension(fileName, ".png"))
+    if (!imageExporter.initialized)
     {
-        int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
-        result = SaveFileData(fileName, fileData, dataSize);
-        RL_FREE(fileData);
+        InitThreadMutex(&imageExporter.mutex);
+        InitThreadCondition(&imageExporter.requestReady);
+        InitThreadCondition(&imageExporter.requestDone);
+        imageExporter.initialized = true;
     }
-#else
-    if (false) { }
-#endif
-#if defined(SUPPORT_FILEFORMAT_BMP)
-    else if (IsFileExtension(fileName, ".bmp")) result = stbi_write_bmp(fileName, image.width, image.height, channels, imgData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_TGA)
-    else if (IsFileExtension(fileName, ".tga")) result = stbi_write_tga(fileName, image.width, image.height, channels, imgData);
-#endif
-#if defined(SUPPORT_FILEFORMAT_JPG)
-    else if (IsFileExtension(fileName, ".jpg") ||
-             IsFileExtension(fileName, ".jpeg")) result = stbi_write_jpg(fileName, image.width, image.height, channels, imgData, 90);  // JPG quality: between 1 and 100
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOI)
-    else if (IsFileExtension(fileName, ".qoi"))
-    {
-        channels = 0;
-        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
-
-        if ((channels == 3) || (channels == 4))
-        {
-            qoi_desc desc = { 0 };
-            desc.width = image.width;
-            desc.height = image.height;
-            desc.channels = channels;
-            desc.colorspace = QOI_SRGB;
 
-            result = qoi_write(fileName, imgData, &desc);
-        }
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_KTX)
-    else if (IsFileExtension(fileName, ".ktx"))
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (!imageExporter.started)
     {
-        result = rl_save_ktx(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+        imageExporter.quit = false;
+        imageExporter.started = StartThread(&imageExporter.thread, ImageExporterThread, NULL);
+
+        if (!imageExporter.started) TRACELOG(LOG_WARNING, "IMAGE: Failed to start exporter thread, images exported on calling thread");
     }
 #endif
-    else if (IsFileExtension(fileName, ".raw"))
+
+    if (!imageExporter.started)
     {
-        // Export raw pixel data (without header)
-        // NOTE: It's up to the user to track image parameters
-        result = SaveFileData(fileName, image.data, GetPixelDataSize(image.width, image.height, image.format));
+        bool result = ExportImageFormat(image, fileName, format);
+        UnloadImage(image);
+
+        return result;
     }
 
-    if (allocatedData) RL_FREE(imgData);
-#endif      // SUPPORT_IMAGE_EXPORT
+    int length = (int)strlen(fileName);
+    char *name = (char *)RL_MALLOC(length + 1);
+    memcpy(name, fileName, length + 1);
 
-    if (result != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
-    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", fileName);
+    LockThreadMutex(&imageExporter.mutex);
 
-    return result;
+    while (imageExporter.count == MAX_IMAGE_EXPORT_REQUESTS) WaitThreadCondition(&imageExporter.requestDone, &imageExporter.mutex);
+
+    ExportRequest *request = &imageExporter.requests[(imageExporter.first + imageExporter.count)%MAX_IMAGE_EXPORT_REQUESTS];
+    request->image = image;
+    request->fileName = name;
+    request->format = format;
+    imageExporter.count++;
+
+    SignalThreadCondition(&imageExporter.requestReady);
+    UnlockThreadMutex(&imageExporter.mutex);
+
+    return true;
 }
 
-// Export image to memory buffer
-unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataSize)
+// Export image data to file on background thread, returns true if export is requested
+// NOTE: Image data is copied, export result is reported by log (same as ExportImage())
+bool ExportImageAsync(Image image, const char *fileName)
 {
-    unsigned char *fileData = NULL;
-    *dataSize = 0;
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL) || (fileName == NULL)) return false;
 
-    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return NULL;
+    return QueueImageExport(ImageCopy(image), fileName);
+}
 
-#if defined(SUPPORT_IMAGE_EXPORT)
-    int channels = 4;
+// Export pending images and stop exporter thread
+// NOTE: Called by CloseWindow(), pending requests are exported before returning
+void CloseImageExport(void)
+{
+    if (!imageExporter.initialized) return;
+
+    if (imageExporter.started)
+    {
+        LockThreadMutex(&imageExporter.mutex);
+        imageExporter.quit = true;
+        BroadcastThreadCondition(&imageExporter.requestReady);
+        UnlockThreadMutex(&imageExporter.mutex);
+
+        JoinThread(&imageExporter.thread);
+        imageExporter.started = false;
+    }
+
+    CloseThreadCondition(&imageExporter.requestDone);
+    CloseThreadCondition(&imageExporter.requestReady);
+    CloseThreadMutex(&imageExporter.mutex);
+    imageExporter.initialized = false;
+}
+
+// Export image to memory buffer
+unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataSize)
+{
+    unsigned char *fileData = NULL;
+    *dataSize = 0;
+
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return NULL;
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+    int channels = 4;
 
     if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
@@ -814,7 +1596,7 @@ unsigned char *ExportImageToMemory(Image image, const char *fileType, int *dataS
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
-        fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        fileData = EncodeImagePNG((const unsigned char *)image.data, image.width, image.height, channels, dataSize);
     }
 #endif
 
@@ -1057,15 +1839,23 @@ Image GenImageChecked(int width, int height, int checksX, int checksY, Color col
 
 // Generate image: white noise
 // NOTE: It requires GetRandomValue(), defined in [rcore]
+// NOTE: Pixels are generated by a counter-based generator (pixel index hash), generator key is obtained
+// with GetRandomValue(), so result depends on random seed but not on the number of worker threads
 Image GenImageWhiteNoise(int width, int height, float factor)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int i = 0; i < width*height; i++)
-    {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
-        else pixels[i] = BLACK;
-    }
+    if (factor < 0.0f) factor = 0.0f;
+    if (factor > 1.0f) factor = 1.0f;
+
+    NoiseJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.key = GetNoiseHash(((unsigned int)GetRandomValue(0, 0x7fff) << 15) | (unsigned int)GetRandomValue(0, 0x7fff));
+    job.threshold = (unsigned int)(factor*16777216.0f);
+
+    ParallelFor(width*height, IMAGE_JOB_MIN_PIXELS, GenImageWhiteNoiseRange, &job);
 
     Image image = {
         .data = pixels,
@@ -1079,38 +1869,20 @@ Image GenImageWhiteNoise(int width, int height, float factor)
 }
 
 // Generate image: perlin noise
+// NOTE: Rows are generated in parallel, result is the same as stb_perlin_fbm_noise3() per pixel
 Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
-
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
-
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
-
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
+    NoiseJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.offsetX = offsetX;
+    job.offsetY = offsetY;
+    job.scale = scale;
 
-            int intensity = (int)(np*255.0f);
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ParallelFor(height, IMAGE_JOB_MIN_PIXELS/width + 1, GenImagePerlinNoiseRows, &job);
 
     Image image = {
         .data = pixels,
@@ -1141,39 +1913,17 @@ Image GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (Vector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
+    NoiseJob job = { 0 };
+    job.pixels = pixels;
+    job.width = width;
+    job.height = height;
+    job.seeds = seeds;
+    job.tileSize = tileSize;
+    job.seedsPerRow = seedsPerRow;
+    job.seedsPerCol = seedsPerCol;
 
-            // I made this up, but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    // NOTE: Seeds are generated in order, rows are generated in parallel
+    ParallelFor(height, IMAGE_JOB_MIN_PIXELS/width + 1, GenImageCellularRows, &job);
 
     RL_FREE(seeds);
 
@@ -1292,30 +2042,18 @@ void ImageCrop(Image *image, Rectangle crop)
     else
     {
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+        int rowSize = (int)crop.width*bytesPerPixel;
+        unsigned char *data = (unsigned char *)image->data;
 
-        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
-
-        // OPTION 1: Move cropped data line-by-line
-        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
-        {
-            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
-            offsetSize += ((int)crop.width*bytesPerPixel);
-        }
-
-        /*
-        // OPTION 2: Move cropped data pixel-by-pixel or byte-by-byte
-        for (int y = (int)crop.y; y < (int)(crop.y + crop.height); y++)
+        // NOTE: Cropped rows are moved in-place (row destination never goes after row source),
+        // data buffer is shrunk once all rows are moved
+        for (int y = 0; y < (int)crop.height; y++)
         {
-            for (int x = (int)crop.x; x < (int)(crop.x + crop.width); x++)
-            {
-                //memcpy(croppedData + ((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) croppedData[((y - (int)crop.y)*(int)crop.width + (x - (int)crop.x))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
+            memmove(data + y*rowSize, data + (((int)crop.y + y)*image->width + (int)crop.x)*bytesPerPixel, rowSize);
         }
-        */
 
-        RL_FREE(image->data);
-        image->data = croppedData;
+        unsigned char *croppedData = (unsigned char *)RL_REALLOC(data, rowSize*(int)crop.height);
+        if (croppedData != NULL) image->data = croppedData;
         image->width = (int)crop.width;
         image->height = (int)crop.height;
     }
@@ -1331,189 +2069,36 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
-
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
+            // NOTE: Target format is uncompressed, data size is exactly width*height*bytesPerPixel
+            void *data = RL_MALLOC(GetPixelDataSize(image->width, image->height, newFormat));
+            ImageJob job = { 0 };
 
-            switch (image->format)
+            if (IsPixelFormatDirectConvertible(image->format, newFormat))
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
-
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
-
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 32bit
-
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
-
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+                // Direct conversion between 8bit and 16bit packed formats, no float intermediate required
+                job.image = *image;
+                job.output = data;
+                job.value = newFormat;
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, ConvertImageRange, &job);
+            }
+            else
+            {
+                Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-                    for (int i = 0; i < image->width*image->height; i++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+                job.image = *image;
+                job.image.data = data;
+                job.image.format = newFormat;
+                job.pixels = pixels;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, FormatImageRange, &job);
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
+                RL_FREE(pixels);
             }
 
-            RL_FREE(pixels);
-            pixels = NULL;
+            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+            image->data = data;
+            image->format = newFormat;
 
             // In case original image had mipmaps, generate mipmaps for formatted image
             // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
@@ -1525,10 +2110,87 @@ void ImageFormat(Image *image, int newFormat)
             #endif
             }
         }
+        else if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (GetBlockDataSize(newFormat) > 0))
+        {
+            ImageCompress(image, newFormat, COMPRESS_QUALITY_DEFAULT);
+        }
+        else if (GetBlockDataSize(image->format) > 0)
+        {
+            // Compressed data is decoded to R8G8B8A8 and then converted to new format
+            // NOTE: Original mipmaps are replaced by new ones generated from decoded data
+            Color *pixels = LoadImageColors(*image);
+            int mipmaps = image->mipmaps;
+
+            RL_FREE(image->data);
+            image->data = pixels;
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            image->mipmaps = 1;
+
+        #if defined(SUPPORT_IMAGE_MANIPULATION)
+            if (mipmaps > 1) ImageMipmaps(image);
+        #endif
+            ImageFormat(image, newFormat);
+        }
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
 
+// Compress image data to GPU block compressed format (DXT1/DXT3/DXT5, ETC1/ETC2/ETC2_EAC), mipmaps included
+// NOTE: Quality sets encoder speed/quality trade-off (CompressQuality type), blocks rows are compressed in parallel
+void ImageCompress(Image *image, int format, int quality)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (GetBlockDataSize(format) == 0)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported by encoder (%s)", rlGetPixelFormatName(format));
+        return;
+    }
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be compressed again");
+        return;
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(GetMipmapsDataSize(image->width, image->height, format, image->mipmaps));
+    int width = image->width;
+    int height = image->height;
+    int offset = 0;
+    int blocksOffset = 0;
+
+    BlockJob job = { 0 };
+    job.format = format;
+    job.quality = quality;
+
+    for (int i = 0; i < image->mipmaps; i++)
+    {
+        // NOTE: Mipmap levels in other formats are converted to R8G8B8A8 one by one
+        Image level = { (unsigned char *)image->data + offset, width, height, 1, image->format };
+
+        job.pixels = (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (Color *)level.data : LoadImageColors(level);
+        job.blocks = data + blocksOffset;
+        job.width = width;
+        job.height = height;
+
+        // NOTE: Blocks compression is much more expensive than pixels conversion, smaller chunks are used
+        ParallelFor((height + 3)/4, IMAGE_JOB_MIN_PIXELS/(64*width) + 1, CompressBlocksRange, &job);
+
+        if (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) RL_FREE(job.pixels);
+
+        offset += GetPixelDataSize(width, height, image->format);
+        blocksOffset += GetPixelDataSize(width, height, format);
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = format;
+}
+
 // Create an image from text (default font)
 Image ImageText(const char *text, int fontSize, Color color)
 {
@@ -1668,14 +2330,8 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
         unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+        // NOTE: Pixel layout matches bytes per pixel: 1 to 4 channels
+        ResizeImageData((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, bytesPerPixel);
 
         RL_FREE(image->data);
         image->data = output;
@@ -1689,7 +2345,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
+        ResizeImageData((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -1892,12 +2548,12 @@ void ImageAlphaClear(Image *image, Color color, float threshold)
             {
                 for (int i = 3; i < image->width*image->height*4; i += 4)
                 {
-                    if (HalfToFloat(((unsigned short *)image->data)[i]) <= threshold)
+                    if (rlHalfToFloat(((unsigned short *)image->data)[i]) <= threshold)
                     {
-                        ((unsigned short *)image->data)[i - 3] = FloatToHalf((float)color.r/255.0f);
-                        ((unsigned short *)image->data)[i - 2] = FloatToHalf((float)color.g/255.0f);
-                        ((unsigned short *)image->data)[i - 1] = FloatToHalf((float)color.b/255.0f);
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)color.a/255.0f);
+                        ((unsigned short *)image->data)[i - 3] = rlFloatToHalf((float)color.r/255.0f);
+                        ((unsigned short *)image->data)[i - 2] = rlFloatToHalf((float)color.g/255.0f);
+                        ((unsigned short *)image->data)[i - 1] = rlFloatToHalf((float)color.b/255.0f);
+                        ((unsigned short *)image->data)[i] = rlFloatToHalf((float)color.a/255.0f);
                     }
                 }
             } break;
@@ -1963,25 +2619,12 @@ void ImageAlphaPremultiply(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    float alpha = 0.0f;
     Color *pixels = LoadImageColors(*image);
 
-    for (int i = 0; i < image->width*image->height; i++)
-    {
-        if (pixels[i].a == 0)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-        }
-        else if (pixels[i].a < 255)
-        {
-            alpha = (float)pixels[i].a/255.0f;
-            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
-            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
-            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
-        }
-    }
+    ImageJob job = { 0 };
+    job.output = pixels;
+
+    ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, ImageAlphaPremultiplyRange, &job);
 
     RL_FREE(image->data);
 
@@ -2147,22 +2790,7 @@ void ImageKernelConvolution(Image *image, float* kernel, int kernelSize)
     }
 
     Color *pixels = LoadImageColors(*image);
-
-    Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+    Color *output = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
 
     int startRange = 0, endRange = 0;
     
@@ -2176,88 +2804,73 @@ void ImageKernelConvolution(Image *image, float* kernel, int kernelSize)
         startRange = -kernelWidth/2;
         endRange = kernelWidth/2 + 1;
     }
-    
-    for(int x = 0; x < image->height; x++)
+
+    ConvolutionJob job = { 0 };
+    job.width = image->width;
+    job.height = image->height;
+    job.pixels = pixels;
+    job.output = output;
+    job.kernel = kernel;
+    job.kernelWidth = kernelWidth;
+    job.startRange = startRange;
+    job.endRange = endRange;
+
+    // NOTE: Image pixels are addressed linearly (width*row + column), samples out of image data are considered zero,
+    // separable kernels are applied in two passes, an intermediate buffer with (kernelWidth - 1) padding rows is required
+    int paddedRows = image->height + kernelWidth - 1;
+    bool boxKernel = (kernelWidth > 1);
+    float *kernelRow = (float *)RL_MALLOC(2*kernelWidth*sizeof(float));
+    float *kernelColumn = kernelRow + kernelWidth;
+
+    for (int i = 1; i < kernelSize; i++) if (kernel[i] != kernel[0]) boxKernel = false;
+
+    if (boxKernel)
     {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-                    
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth * xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth * xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth * xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth * xkabs + ykabs].w = 0.0f;
-                    } 
-                    else
-                    {
-                        temp[kernelWidth * xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth * xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth * xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth * xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
+        // Box kernel: window sums are updated incrementally (running sums), cost does not depend on kernel size
+        job.sums = (int *)RL_MALLOC(paddedRows*image->width*4*sizeof(int));
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
+        ParallelFor(paddedRows, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageBoxSumRowsRange, &job);
+        ParallelFor(image->height, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageBoxSumColumnsRange, &job);
 
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
+        RL_FREE(job.sums);
+    }
+    else
+    {
+        // Normalized pixels, converted only once for all kernel samples
+        job.normalized = (Vector4 *)RL_MALLOC(image->width*image->height*sizeof(Vector4));
 
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
+        for (int i = 0; i < image->width*image->height; i++)
+        {
+            job.normalized[i] = (Vector4){ (float)pixels[i].r/255.0f, (float)pixels[i].g/255.0f, (float)pixels[i].b/255.0f, (float)pixels[i].a/255.0f };
+        }
 
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
+        if ((kernelWidth > 1) && IsKernelSeparable(kernel, kernelWidth, kernelRow, kernelColumn))
+        {
+            // Separable kernel: horizontal and vertical passes, 2*kernelWidth samples per pixel instead of kernelWidth^2
+            job.kernelRow = kernelRow;
+            job.kernelColumn = kernelColumn;
+            job.rows = (Vector4 *)RL_MALLOC(paddedRows*image->width*sizeof(Vector4));
 
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+            ParallelFor(paddedRows, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageConvolutionRowsRange, &job);
+            ParallelFor(image->height, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageConvolutionColumnsRange, &job);
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
+            RL_FREE(job.rows);
+        }
+        else
+        {
+            // NOTE: Every row is computed independently, image is processed in bands of rows
+            ParallelFor(image->height, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageKernelConvolutionRange, &job);
         }
-    }
 
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
-        
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
+        RL_FREE(job.normalized);
     }
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    RL_FREE(pixels);
+    RL_FREE(kernelRow);
 
-    image->data = pixels;
+    image->data = output;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
     ImageFormat(image, format);
 }
@@ -2267,6 +2880,16 @@ void ImageKernelConvolution(Image *image, float* kernel, int kernelSize)
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
 void ImageMipmaps(Image *image)
+{
+    ImageMipmapsEx(image, MIPMAP_FILTER_BOX, false, 0.0f);
+}
+
+// Generate all mipmap levels for a provided image, with selected filter (MipmapFilter)
+// NOTE 1: Every level is generated from previous level, directly into image data (scaled to include mipmap levels)
+// NOTE 2: If srgb is enabled, color channels are averaged in linear space, if alphaCutoff is provided,
+// levels alpha is scaled to keep the ratio of pixels passing alpha test (alpha > alphaCutoff) of base level
+// NOTE 3: 8 bit per channel formats are filtered directly, other formats levels use bicubic resize
+void ImageMipmapsEx(Image *image, int filter, bool srgb, float alphaCutoff)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2292,19 +2915,42 @@ void ImageMipmaps(Image *image)
         mipSize += GetPixelDataSize(mipWidth, mipHeight, image->format);       // Add mipmap size (in bytes)
     }
 
-    if (image->mipmaps < mipCount)
+    if (image->mipmaps >= mipCount)
     {
-        void *temp = RL_REALLOC(image->data, mipSize);
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
+        return;
+    }
+
+    void *temp = RL_REALLOC(image->data, mipSize);
+
+    if (temp == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        return;
+    }
+
+    image->data = temp;      // Assign new pointer (new size) to store mipmaps data
 
-        if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+    int channels = 0;
 
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: channels = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+        default: break;
+    }
+
+    if (channels == 0)
+    {
         // Pointer to allocated memory point where store next mipmap level data
         unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
 
         mipWidth = image->width/2;
         mipHeight = image->height/2;
         mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+        image->mipmaps = 1;
         Image imCopy = ImageCopy(*image);
 
         for (int i = 1; i < mipCount; i++)
@@ -2328,11 +2974,100 @@ void ImageMipmaps(Image *image)
         }
 
         UnloadImage(imCopy);
+        return;
     }
-    else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
-}
 
-// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+    // Channels conversion tables: linear values and sRGB values (alpha channel is always linear)
+    float decodeTables[2][256] = { 0 };
+    unsigned char *encodeTables = (unsigned char *)RL_MALLOC(2*MIPMAP_ENCODE_TABLE_SIZE);
+
+    for (int i = 0; i < 256; i++)
+    {
+        float value = (float)i/255.0f;
+
+        decodeTables[0][i] = value;
+        decodeTables[1][i] = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+    }
+
+    for (int i = 0; i < MIPMAP_ENCODE_TABLE_SIZE; i++)
+    {
+        float value = (float)i/(MIPMAP_ENCODE_TABLE_SIZE - 1);
+        float encoded = (value <= 0.0031308f)? value*12.92f : 1.055f*powf(value, 1.0f/2.4f) - 0.055f;
+
+        encodeTables[i] = (unsigned char)(value*255.0f + 0.5f);
+        encodeTables[MIPMAP_ENCODE_TABLE_SIZE + i] = (unsigned char)(encoded*255.0f + 0.5f);
+    }
+
+    int alphaChannel = ((channels == 2) || (channels == 4))? (channels - 1) : -1;
+    MipmapJob job = { 0 };
+    job.channels = channels;
+
+    for (int c = 0; c < channels; c++)
+    {
+        bool linear = !srgb || (c == alphaChannel);
+        job.decode[c] = decodeTables[linear? 0 : 1];
+        job.encode[c] = encodeTables + (linear? 0 : MIPMAP_ENCODE_TABLE_SIZE);
+    }
+
+    // Base level alpha test coverage, levels alpha is scaled to match it
+    int cutoff = (int)(alphaCutoff*255.0f);
+    bool coverage = (alphaChannel >= 0) && (alphaCutoff > 0.0f) && (alphaCutoff < 1.0f);
+    float baseCoverage = 0.0f;
+
+    if (coverage)
+    {
+        int covered = 0;
+        for (int i = 0; i < image->width*image->height; i++) covered += (((unsigned char *)image->data)[i*channels + alphaChannel] > cutoff);
+        baseCoverage = (float)covered/(image->width*image->height);
+    }
+
+    // Filter taps are required for every destination column and row
+    // NOTE: Box filter requires up to 3 taps (odd sizes), Kaiser filter taps cover its radius (up to 3x source pixels per destination pixel)
+    job.taps = (filter == MIPMAP_FILTER_KAISER)? ((int)ceilf(2.0f*MIPMAP_KAISER_RADIUS*3.0f) + 1) : 3;
+    job.columns = (int *)RL_MALLOC(image->width*job.taps*sizeof(int));
+    job.columnWeights = (float *)RL_MALLOC(image->width*job.taps*sizeof(float));
+    job.rows = (int *)RL_MALLOC(image->height*job.taps*sizeof(int));
+    job.rowWeights = (float *)RL_MALLOC(image->height*job.taps*sizeof(float));
+
+    job.input = (unsigned char *)image->data;
+    job.width = image->width;
+    job.height = image->height;
+
+    for (int i = 1; i < mipCount; i++)
+    {
+        job.newWidth = (job.width > 1)? job.width/2 : 1;
+        job.newHeight = (job.height > 1)? job.height/2 : 1;
+        job.output = (unsigned char *)job.input + job.width*job.height*channels;
+
+        TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i)", i, job.newWidth, job.newHeight);
+
+        job.box = (filter != MIPMAP_FILTER_KAISER) && !srgb && ((job.width%2) == 0) && ((job.height%2) == 0);
+
+        if (!job.box)
+        {
+            GetMipmapTaps(job.width, job.newWidth, filter, job.taps, job.columns, job.columnWeights);
+            GetMipmapTaps(job.height, job.newHeight, filter, job.taps, job.rows, job.rowWeights);
+        }
+
+        ParallelFor(job.newHeight, IMAGE_JOB_MIN_PIXELS/job.newWidth + 1, ImageMipmapRowsRange, &job);
+
+        if (coverage) ScaleAlphaCoverage(job.output, job.newWidth*job.newHeight, channels, cutoff, baseCoverage);
+
+        job.input = job.output;
+        job.width = job.newWidth;
+        job.height = job.newHeight;
+    }
+
+    image->mipmaps = mipCount;
+
+    RL_FREE(job.columns);
+    RL_FREE(job.columnWeights);
+    RL_FREE(job.rows);
+    RL_FREE(job.rowWeights);
+    RL_FREE(encodeTables);
+}
+
+// Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 // NOTE: In case selected bpp do not represent a known 16bit format,
 // dithered data is stored in the LSB part of the unsigned short
 void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
@@ -2374,77 +3109,71 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
         // NOTE: We will store the dithered data as unsigned short (16bpp)
         image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
-
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
-
         #define MIN(a,b) (((a)<(b))?(a):(b))
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                oldPixel = pixels[y*image->width + x];
-
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
-
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
-
-                pixels[y*image->width + x] = newPixel;
+        DitherJob job = { 0 };
+        job.pixels = pixels;
+        job.output = (unsigned short *)image->data;
+        job.width = image->width;
+        job.height = image->height;
+        job.rBpp = rBpp;
+        job.gBpp = gBpp;
+        job.bBpp = bBpp;
+        job.aBpp = aBpp;
+        job.progress = (int *)RL_CALLOC(image->height, sizeof(int));
+
+        // NOTE: Every job task processes full rows, so tasks count is just the number of threads
+        int taskCount = ((image->width*image->height) >= IMAGE_JOB_MIN_PIXELS)? GetWorkerThreadCount() : 1;
+        ParallelFor(taskCount, 1, ImageDitherRows, &job);
+
+        RL_FREE((void *)job.progress);
+        UnloadImageColors(pixels);
+    }
+}
 
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
+// Reduce image colors to a quantized palette (up to 256 colors), optionally dithered
+// NOTE: Image is converted to R8G8B8A8 to map colors and converted back to original format
+void ImageQuantize(Image *image, int maxPaletteSize, bool dither)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be quantized");
+        return;
+    }
 
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
+    if (maxPaletteSize > 256)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Quantized palette limited to 256 colors");
+        maxPaletteSize = 256;
+    }
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
+    int colorCount = 0;
+    Color *palette = LoadImagePaletteQuantized(*image, maxPaletteSize, &colorCount);
+    unsigned char *indices = LoadImagePaletteIndices(*image, palette, colorCount, dither);
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+    if (indices != NULL)
+    {
+        int format = image->format;
+        Color *pixels = (Color *)RL_MALLOC(image->width*image->height*sizeof(Color));
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
-            }
-        }
+        for (int i = 0; i < image->width*image->height; i++) pixels[i] = palette[indices[i]];
 
-        UnloadImageColors(pixels);
+        RL_FREE(image->data);
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image->mipmaps = 1;
+        ImageFormat(image, format);
     }
+
+    UnloadImagePaletteIndices(indices);
+    UnloadImagePalette(palette);
 }
 
 // Flip image vertically
+// NOTE: Rows are swapped in-place
 void ImageFlipVertical(Image *image)
 {
     // Security check to avoid program crash
@@ -2454,21 +3183,18 @@ void ImageFlipVertical(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
-        {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
-        }
+        TransformJob job = { 0 };
+        job.output = (unsigned char *)image->data;
+        job.width = image->width;
+        job.height = image->height;
+        job.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
 
-        RL_FREE(image->data);
-        image->data = flippedData;
+        ParallelFor(image->height/2, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageFlipVerticalRange, &job);
     }
 }
 
 // Flip image horizontally
+// NOTE: Rows pixels are reversed in-place
 void ImageFlipHorizontal(Image *image)
 {
     // Security check to avoid program crash
@@ -2478,42 +3204,19 @@ void ImageFlipHorizontal(Image *image)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
+        TransformJob job = { 0 };
+        job.output = (unsigned char *)image->data;
+        job.width = image->width;
+        job.height = image->height;
+        job.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
 
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
-
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
-            {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
-            }
-        }
-        */
+        ParallelFor(image->height, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageFlipHorizontalRange, &job);
     }
 }
 
 // Rotate image in degrees
+// NOTE: Multiples of 90 degrees move pixels exactly (180 degrees in-place),
+// other angles are resampled with bilinear filtering directly into rotated image
 void ImageRotate(Image *image, int degrees)
 {
     // Security check to avoid program crash
@@ -2523,52 +3226,44 @@ void ImageRotate(Image *image, int degrees)
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
     else
     {
-        float rad = degrees*PI/180.0f;
-        float sinRadius = sinf(rad);
-        float cosRadius = cosf(rad);
-
-        int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
-        int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
+        int angle = ((degrees%360) + 360)%360;
 
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_CALLOC(width*height, bytesPerPixel);
-
-        for (int y = 0; y < height; y++)
+        if (angle == 0) return;
+        else if (angle == 90) ImageRotate90(image, true);
+        else if (angle == 270) ImageRotate90(image, false);
+        else if (angle == 180)
         {
-            for (int x = 0; x < width; x++)
-            {
-                float oldX = ((x - width/2.0f)*cosRadius + (y - height/2.0f)*sinRadius) + image->width/2.0f;
-                float oldY = ((y - height/2.0f)*cosRadius - (x - width/2.0f)*sinRadius) + image->height/2.0f;
-
-                if ((oldX >= 0) && (oldX < image->width) && (oldY >= 0) && (oldY < image->height))
-                {
-                    int x1 = (int)floorf(oldX);
-                    int y1 = (int)floorf(oldY);
-                    int x2 = MIN(x1 + 1, image->width - 1);
-                    int y2 = MIN(y1 + 1, image->height - 1);
-
-                    float px = oldX - x1;
-                    float py = oldY - y1;
+            // Rotating 180 degrees reverses pixels order
+            TransformJob job = { 0 };
+            job.output = (unsigned char *)image->data;
+            job.width = image->width;
+            job.height = image->height;
+            job.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+
+            ParallelFor(image->width*image->height/2, IMAGE_JOB_MIN_PIXELS, ImageReverseRange, &job);
+        }
+        else
+        {
+            float rad = degrees*PI/180.0f;
 
-                    for (int i = 0; i < bytesPerPixel; i++)
-                    {
-                        float f1 = ((unsigned char *)image->data)[(y1*image->width + x1)*bytesPerPixel + i];
-                        float f2 = ((unsigned char *)image->data)[(y1*image->width + x2)*bytesPerPixel + i];
-                        float f3 = ((unsigned char *)image->data)[(y2*image->width + x1)*bytesPerPixel + i];
-                        float f4 = ((unsigned char *)image->data)[(y2*image->width + x2)*bytesPerPixel + i];
+            TransformJob job = { 0 };
+            job.input = (const unsigned char *)image->data;
+            job.width = image->width;
+            job.height = image->height;
+            job.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+            job.sinRadius = sinf(rad);
+            job.cosRadius = cosf(rad);
+            job.newWidth = (int)(fabsf(image->width*job.cosRadius) + fabsf(image->height*job.sinRadius));
+            job.newHeight = (int)(fabsf(image->height*job.cosRadius) + fabsf(image->width*job.sinRadius));
+            job.output = (unsigned char *)RL_CALLOC(job.newWidth*job.newHeight, job.bytesPerPixel);
 
-                        float val = f1*(1 - px)*(1 - py) + f2*px*(1 - py) + f3*(1 - px)*py + f4*px*py;
+            ParallelFor(job.newHeight, IMAGE_JOB_MIN_PIXELS/job.newWidth + 1, ImageRotateRowsRange, &job);
 
-                        rotatedData[(y*width + x)*bytesPerPixel + i] = (unsigned char)val;
-                    }
-                }
-            }
+            RL_FREE(image->data);
+            image->data = job.output;
+            image->width = job.newWidth;
+            image->height = job.newHeight;
         }
-
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        image->width = width;
-        image->height = height;
     }
 }
 
@@ -2580,28 +3275,7 @@ void ImageRotateCW(Image *image)
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + (image->height - y - 1))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + x)*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + (image->height - y - 1))*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + x)*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
-
-        image->width = height;
-        image->height = width;
-    }
+    else ImageRotate90(image, true);
 }
 
 // Rotate image counter-clockwise 90deg
@@ -2612,28 +3286,7 @@ void ImageRotateCCW(Image *image)
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
-        unsigned char *rotatedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                //memcpy(rotatedData + (x*image->height + y))*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - x - 1))*bytesPerPixel, bytesPerPixel);
-                for (int i = 0; i < bytesPerPixel; i++) rotatedData[(x*image->height + y)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - x - 1))*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = rotatedData;
-        int width = image->width;
-        int height = image-> height;
-
-        image->width = height;
-        image->height = width;
-    }
+    else ImageRotate90(image, false);
 }
 
 // Modify image color: tint
@@ -2644,23 +3297,11 @@ void ImageColorTint(Image *image, Color color)
 
     Color *pixels = LoadImageColors(*image);
 
-    float cR = (float)color.r/255;
-    float cG = (float)color.g/255;
-    float cB = (float)color.b/255;
-    float cA = (float)color.a/255;
-
-    for (int i = 0; i < image->width * image->height; i++)
-    {
-        unsigned char r = (unsigned char)(((float)pixels[i].r/255*cR)*255.0f);
-        unsigned char g = (unsigned char)(((float)pixels[i].g/255*cG)*255.0f);
-        unsigned char b = (unsigned char)(((float)pixels[i].b/255*cB)*255.0f);
-        unsigned char a = (unsigned char)(((float)pixels[i].a/255*cA)*255.0f);
+    ImageJob job = { 0 };
+    job.output = pixels;
+    job.color = color;
 
-        pixels[i].r = r;
-        pixels[i].g = g;
-        pixels[i].b = b;
-        pixels[i].a = a;
-    }
+    ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, ImageColorTintRange, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2679,12 +3320,10 @@ void ImageColorInvert(Image *image)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int i = 0; i < image->width * image->height; i++)
-    {
-        pixels[i].r = 255 - pixels[i].r;
-        pixels[i].g = 255 - pixels[i].g;
-        pixels[i].b = 255 - pixels[i].b;
-    }
+    ImageJob job = { 0 };
+    job.output = pixels;
+
+    ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, ImageColorInvertRange, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2716,36 +3355,11 @@ void ImageColorContrast(Image *image, float contrast)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int i = 0; i < image->width * image->height; i++)
-    {
-        float pR = (float)pixels[i].r/255.0f;
-        pR -= 0.5f;
-        pR *= contrast;
-        pR += 0.5f;
-        pR *= 255;
-        if (pR < 0) pR = 0;
-        if (pR > 255) pR = 255;
-
-        float pG = (float)pixels[i].g/255.0f;
-        pG -= 0.5f;
-        pG *= contrast;
-        pG += 0.5f;
-        pG *= 255;
-        if (pG < 0) pG = 0;
-        if (pG > 255) pG = 255;
-
-        float pB = (float)pixels[i].b/255.0f;
-        pB -= 0.5f;
-        pB *= contrast;
-        pB += 0.5f;
-        pB *= 255;
-        if (pB < 0) pB = 0;
-        if (pB > 255) pB = 255;
+    ImageJob job = { 0 };
+    job.output = pixels;
+    job.factor = contrast;
 
-        pixels[i].r = (unsigned char)pR;
-        pixels[i].g = (unsigned char)pG;
-        pixels[i].b = (unsigned char)pB;
-    }
+    ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, ImageColorContrastRange, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2768,25 +3382,11 @@ void ImageColorBrightness(Image *image, int brightness)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int i = 0; i < image->width * image->height; i++)
-    {
-        int cR = pixels[i].r + brightness;
-        int cG = pixels[i].g + brightness;
-        int cB = pixels[i].b + brightness;
-
-        if (cR < 0) cR = 1;
-        if (cR > 255) cR = 255;
-
-        if (cG < 0) cG = 1;
-        if (cG > 255) cG = 255;
-
-        if (cB < 0) cB = 1;
-        if (cB > 255) cB = 255;
+    ImageJob job = { 0 };
+    job.output = pixels;
+    job.value = brightness;
 
-        pixels[i].r = (unsigned char)cR;
-        pixels[i].g = (unsigned char)cG;
-        pixels[i].b = (unsigned char)cB;
-    }
+    ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, ImageColorBrightnessRange, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2805,19 +3405,12 @@ void ImageColorReplace(Image *image, Color color, Color replace)
 
     Color *pixels = LoadImageColors(*image);
 
-    for (int i = 0; i < image->width * image->height; i++)
-    {
-        if ((pixels[i].r == color.r) &&
-            (pixels[i].g == color.g) &&
-            (pixels[i].b == color.b) &&
-            (pixels[i].a == color.a))
-        {
-            pixels[i].r = replace.r;
-            pixels[i].g = replace.g;
-            pixels[i].b = replace.b;
-            pixels[i].a = replace.a;
-        }
-    }
+    ImageJob job = { 0 };
+    job.output = pixels;
+    job.color = color;
+    job.replace = replace;
+
+    ParallelFor(image->width*image->height, IMAGE_JOB_MIN_PIXELS, ImageColorReplaceRange, &job);
 
     int format = image->format;
     RL_FREE(image->data);
@@ -2837,7 +3430,19 @@ Color *LoadImageColors(Image image)
 
     Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    if (GetBlockDataSize(image.format) > 0)
+    {
+        // Block compressed data is decoded (first mipmap level)
+        BlockJob job = { 0 };
+        job.pixels = pixels;
+        job.blocks = (unsigned char *)image.data;
+        job.width = image.width;
+        job.height = image.height;
+        job.format = image.format;
+
+        ParallelFor((image.height + 3)/4, IMAGE_JOB_MIN_PIXELS/(4*image.width) + 1, DecompressBlocksRange, &job);
+    }
+    else if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
     else
     {
         if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
@@ -2848,189 +3453,197 @@ Color *LoadImageColors(Image image)
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R16G16B16A16)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 16bit to 8bit per channel");
 
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[i];
-                    pixels[i].g = ((unsigned char *)image.data)[i];
-                    pixels[i].b = ((unsigned char *)image.data)[i];
-                    pixels[i].a = 255;
+        ImageJob job = { 0 };
+        job.image = image;
+        job.output = pixels;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k];
-                    pixels[i].b = ((unsigned char *)image.data)[k];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 1];
+        ParallelFor(image.width*image.height, IMAGE_JOB_MIN_PIXELS, LoadImageColorsRange, &job);
+    }
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    return pixels;
+}
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
-                    pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
+// Load colors palette from image as a Color array (RGBA - 32bit)
+// NOTE: Memory allocated should be freed using UnloadImagePalette()
+Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+{
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = LoadImageColors(image);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    if (pixels != NULL)
+    {
+        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
-                    pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
-                    pixels[i].a = 255;
+        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+        // NOTE: Transparent pixels are not added to palette
+        palCount = GetUniqueColors(pixels, image.width*image.height, palette, maxPaletteSize, false);
 
-                    pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
-                    pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
-                    pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
-                    pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+        if (palCount > maxPaletteSize)
+        {
+            palCount = maxPaletteSize;
+            TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+        }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].r = ((unsigned char *)image.data)[k];
-                    pixels[i].g = ((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = ((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = ((unsigned char *)image.data)[k + 3];
+        UnloadImageColors(pixels);
+    }
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
-                    pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
-                    pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
-                    pixels[i].a = 255;
+    *colorCount = palCount;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+    return palette;
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
-                    pixels[i].a = 255;
+// Load quantized colors palette from image as a Color array (RGBA - 32bit)
+// NOTE 1: If image has up to maxPaletteSize colors, palette contains image colors (in appearance order),
+// otherwise colors are reduced to 5 bits per channel and palette is generated by median cut
+// NOTE 2: Transparent pixels (alpha = 0) are considered BLANK, palette includes BLANK if any
+// NOTE 3: Memory allocated should be freed using UnloadImagePalette()
+Color *LoadImagePaletteQuantized(Image image, int maxPaletteSize, int *colorCount)
+{
+    int palCount = 0;
+    Color *palette = NULL;
+    Color *pixels = (maxPaletteSize > 0)? LoadImageColors(image) : NULL;
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
-                    pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+    if (pixels != NULL)
+    {
+        int pixelCount = image.width*image.height;
+        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = 0;
-                    pixels[i].b = 0;
-                    pixels[i].a = 255;
+        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
-                    pixels[i].a = 255;
+        palCount = GetUniqueColors(pixels, pixelCount, palette, maxPaletteSize, true);
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
-                    pixels[i].a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+        if (palCount > maxPaletteSize)
+        {
+            // Colors histogram, bins are indexed by reduced color
+            int *binIndices = (int *)RL_MALLOC((1 << 20)*sizeof(int));
+            ColorBin *bins = (ColorBin *)RL_CALLOC((pixelCount < (1 << 20))? pixelCount : (1 << 20), sizeof(ColorBin));
+            int binCount = 0;
 
-                    k += 4;
-                } break;
-                default: break;
+            memset(binIndices, 0xff, (1 << 20)*sizeof(int));
+
+            for (int i = 0; i < pixelCount; i++)
+            {
+                Color color = (pixels[i].a == 0)? BLANK : pixels[i];
+                int key = ((color.r >> 3) << 15) | ((color.g >> 3) << 10) | ((color.b >> 3) << 5) | (color.a >> 3);
+
+                if (binIndices[key] < 0) binIndices[key] = binCount++;
+
+                ColorBin *bin = &bins[binIndices[key]];
+                bin->count++;
+                bin->sum[0] += color.r;
+                bin->sum[1] += color.g;
+                bin->sum[2] += color.b;
+                bin->sum[3] += color.a;
             }
+
+            palCount = GetPaletteMedianCut(bins, binCount, palette, maxPaletteSize);
+
+            RL_FREE(binIndices);
+            RL_FREE(bins);
         }
+
+        UnloadImageColors(pixels);
     }
 
-    return pixels;
+    *colorCount = palCount;
+
+    return palette;
 }
 
-// Load colors palette from image as a Color array (RGBA - 32bit)
-// NOTE: Memory allocated should be freed using UnloadImagePalette()
-Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
+// Load image pixels as palette colors indices, palette is limited to 256 colors
+// NOTE 1: Pixels are mapped to nearest palette color (RGBA distance), transparent pixels are considered BLANK
+// NOTE 2: If dither is enabled, color error is diffused (Floyd-Steinberg) and pixels are processed in order
+// NOTE 3: Memory allocated should be freed using UnloadImagePaletteIndices()
+unsigned char *LoadImagePaletteIndices(Image image, const Color *palette, int colorCount, bool dither)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+    if ((palette == NULL) || (colorCount < 1) || (colorCount > 256))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Palette not valid for indices, 1 to 256 colors supported");
+        return NULL;
+    }
 
-    int palCount = 0;
-    Color *palette = NULL;
+    unsigned char *indices = NULL;
     Color *pixels = LoadImageColors(image);
 
     if (pixels != NULL)
     {
-        palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+        int pixelCount = image.width*image.height;
+        indices = (unsigned char *)RL_MALLOC(pixelCount);
 
-        for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
+        PaletteSearch search = LoadPaletteSearch(palette, colorCount);
+
+        for (int i = 0; i < pixelCount; i++)
+        {
+            if (pixels[i].a == 0) pixels[i] = BLANK;
+        }
+
+        if (!dither)
+        {
+            PaletteJob job = { 0 };
+            job.pixels = pixels;
+            job.indices = indices;
+            job.search = &search;
 
-        for (int i = 0; i < image.width*image.height; i++)
+            ParallelFor(pixelCount, IMAGE_JOB_MIN_PIXELS, LoadPaletteIndicesRange, &job);
+        }
+        else
         {
-            if (pixels[i].a > 0)
+            // Color errors (x16) diffused to current and next rows, rows are padded with 1 pixel at both sides
+            int width = image.width;
+            int *errors = (int *)RL_CALLOC(2*(width + 2)*3, sizeof(int));
+
+            for (int y = 0; y < image.height; y++)
             {
-                bool colorInPalette = false;
+                int *current = errors + (y%2)*(width + 2)*3;
+                int *next = errors + ((y + 1)%2)*(width + 2)*3;
 
-                // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
+                memset(next, 0, (width + 2)*3*sizeof(int));
+
+                for (int x = 0; x < width; x++)
                 {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
+                    Color pixel = pixels[y*width + x];
+
+                    // NOTE: Transparent pixels are not dithered
+                    if (pixel.a == 0)
                     {
-                        colorInPalette = true;
-                        break;
+                        indices[y*width + x] = (unsigned char)GetPaletteNearest(&search, 0, 0, 0, 0);
+                        continue;
                     }
-                }
 
-                // Store color if not on the palette
-                if (!colorInPalette)
-                {
-                    palette[palCount] = pixels[i];      // Add pixels[i] to palette
-                    palCount++;
+                    int *error = current + (x + 1)*3;
+                    int value[3] = { pixel.r + error[0]/16, pixel.g + error[1]/16, pixel.b + error[2]/16 };
 
-                    // We reached the limit of colors supported by palette
-                    if (palCount >= maxPaletteSize)
+                    for (int c = 0; c < 3; c++)
                     {
-                        i = image.width*image.height;   // Finish palette get
-                        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors", maxPaletteSize);
+                        if (value[c] < 0) value[c] = 0;
+                        else if (value[c] > 255) value[c] = 255;
+                    }
+
+                    int index = GetPaletteNearest(&search, value[0], value[1], value[2], pixel.a);
+                    int difference[3] = { value[0] - palette[index].r, value[1] - palette[index].g, value[2] - palette[index].b };
+
+                    indices[y*width + x] = (unsigned char)index;
+
+                    for (int c = 0; c < 3; c++)
+                    {
+                        error[3 + c] += difference[c]*7;            // Right pixel
+                        next[x*3 + c] += difference[c]*3;           // Bottom-left pixel
+                        next[(x + 1)*3 + c] += difference[c]*5;     // Bottom pixel
+                        next[(x + 2)*3 + c] += difference[c];       // Bottom-right pixel
                     }
                 }
             }
+
+            RL_FREE(errors);
         }
 
+        UnloadPaletteSearch(search);
         UnloadImageColors(pixels);
     }
 
-    *colorCount = palCount;
-
-    return palette;
+    return indices;
 }
 
 // Unload color data loaded with LoadImageColors()
@@ -3045,6 +3658,12 @@ void UnloadImagePalette(Color *colors)
     RL_FREE(colors);
 }
 
+// Unload palette indices loaded with LoadImagePaletteIndices()
+void UnloadImagePaletteIndices(unsigned char *indices)
+{
+    RL_FREE(indices);
+}
+
 // Get image alpha border rectangle
 // NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
 Rectangle GetImageAlphaBorder(Image image, float threshold)
@@ -3183,7 +3802,7 @@ Color GetImageColor(Image image, int x, int y)
             } break;
             case PIXELFORMAT_UNCOMPRESSED_R16:
             {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
+                color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[y*image.width + x])*255.0f);
                 color.g = 0;
                 color.b = 0;
                 color.a = 255;
@@ -3191,18 +3810,18 @@ Color GetImageColor(Image image, int x, int y)
             } break;
             case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
             {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
+                color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3])*255.0f);
+                color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 1])*255.0f);
+                color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*3 + 2])*255.0f);
                 color.a = 255;
 
             } break;
             case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
             {
-                color.r = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.g = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.b = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
-                color.a = (unsigned char)(HalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
+                color.a = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[(y*image.width + x)*4])*255.0f);
 
             } break;
             default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
@@ -3213,6 +3832,142 @@ Color GetImageColor(Image image, int x, int y)
     return color;
 }
 
+//------------------------------------------------------------------------------------
+// Image view functions
+//------------------------------------------------------------------------------------
+// Get view of image pixels (base mipmap level)
+// NOTE: Compressed image formats not supported, view data is NULL
+ImageView GetImageView(Image image)
+{
+    return GetImageViewRec(image, (Rectangle){ 0, 0, (float)image.width, (float)image.height });
+}
+
+// Get view of image pixels region, clipped to image size
+ImageView GetImageViewRec(Image image, Rectangle rec)
+{
+    ImageView view = { 0 };
+
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return view;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed image formats not supported by image views");
+        return view;
+    }
+
+    int x = (int)rec.x;
+    int y = (int)rec.y;
+    int width = (int)rec.width;
+    int height = (int)rec.height;
+
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if ((x + width) > image.width) width = image.width - x;
+    if ((y + height) > image.height) height = image.height - y;
+
+    if ((width > 0) && (height > 0))
+    {
+        view.bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+        view.stride = image.width*view.bytesPerPixel;
+        view.data = (unsigned char *)image.data + y*view.stride + x*view.bytesPerPixel;
+        view.width = width;
+        view.height = height;
+        view.format = image.format;
+    }
+
+    return view;
+}
+
+// Get pointer to first pixel of view row
+// NOTE: Pointer can be used as a typed span for the view format (unsigned char *, unsigned short *, float *, Color *...)
+void *GetImageViewRow(ImageView view, int y)
+{
+    if ((view.data == NULL) || (y < 0) || (y >= view.height)) return NULL;
+
+    return (unsigned char *)view.data + y*view.stride;
+}
+
+// Read pixels span of view row as RGBA8 colors
+// NOTE: Conversion is equivalent to GetImageColor() for every pixel, span is clipped to view
+void ReadImageViewRow(ImageView view, int x, int y, int count, Color *colors)
+{
+    if ((view.data == NULL) || (colors == NULL) || (y < 0) || (y >= view.height)) return;
+    if (x < 0) { count += x; colors -= x; x = 0; }
+    if ((x + count) > view.width) count = view.width - x;
+    if (count <= 0) return;
+
+    unsigned char *span = (unsigned char *)view.data + y*view.stride + x*view.bytesPerPixel;
+
+    if ((view.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (view.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+        (view.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (view.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        UnpackPixelsRGBA(span, view.format, 0, count, colors);
+    }
+    else
+    {
+        ImageJob job = { 0 };
+        job.image = (Image){ span, count, 1, 1, view.format };
+        job.output = colors;
+
+        LoadImageColorsRange(&job, 0, count);
+    }
+}
+
+// Write RGBA8 colors to pixels span of view row
+// NOTE: Conversion is equivalent to ImageDrawPixel() for every pixel, span is clipped to view
+void WriteImageViewRow(ImageView view, int x, int y, int count, const Color *colors)
+{
+    if ((view.data == NULL) || (colors == NULL) || (y < 0) || (y >= view.height)) return;
+    if (x < 0) { count += x; colors -= x; x = 0; }
+    if ((x + count) > view.width) count = view.width - x;
+    if (count <= 0) return;
+
+    unsigned char *span = (unsigned char *)view.data + y*view.stride + x*view.bytesPerPixel;
+
+    if (view.format <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) PackPixelsRGBA(colors, count, view.format, span, 0);
+    else
+    {
+        // Floating point formats, converted from normalized values in small blocks
+        Vector4 block[IMAGE_CONVERT_BLOCK_SIZE];
+        ImageJob job = { 0 };
+        job.pixels = block;
+
+        for (int i = 0; i < count; i += IMAGE_CONVERT_BLOCK_SIZE)
+        {
+            int blockCount = ((count - i) < IMAGE_CONVERT_BLOCK_SIZE)? (count - i) : IMAGE_CONVERT_BLOCK_SIZE;
+
+            for (int k = 0; k < blockCount; k++)
+            {
+                block[k] = (Vector4){ (float)colors[i + k].r/255.0f, (float)colors[i + k].g/255.0f, (float)colors[i + k].b/255.0f, (float)colors[i + k].a/255.0f };
+            }
+
+            job.image = (Image){ span + i*view.bytesPerPixel, blockCount, 1, 1, view.format };
+            FormatImageRange(&job, 0, blockCount);
+        }
+    }
+}
+
+// Fill pixels span of view row with color
+// NOTE: Color is converted only once, span is clipped to view
+void FillImageViewRow(ImageView view, int x, int y, int count, Color color)
+{
+    if ((view.data == NULL) || (y < 0) || (y >= view.height)) return;
+    if (x < 0) { count += x; x = 0; }
+    if ((x + count) > view.width) count = view.width - x;
+    if (count <= 0) return;
+
+    unsigned char *span = (unsigned char *)view.data + y*view.stride + x*view.bytesPerPixel;
+    int size = count*view.bytesPerPixel;
+
+    WriteImageViewRow(view, x, y, 1, &color);
+
+    // Repeat first pixel data throughout the span, doubling copied size every time
+    for (int filled = view.bytesPerPixel; filled < size; filled *= 2)
+    {
+        memcpy(span + filled, span, ((size - filled) < filled)? (size - filled) : filled);
+    }
+}
+
 //------------------------------------------------------------------------------------
 // Image drawing functions
 //------------------------------------------------------------------------------------
@@ -3222,17 +3977,12 @@ void ImageClearBackground(Image *dst, Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    // Fill in first pixel based on image format
-    ImageDrawPixel(dst, 0, 0, color);
+    ImageView view = GetImageView(*dst);
 
-    unsigned char *pSrcPixel = (unsigned char *)dst->data;
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
+    // Fill in first row based on image format and repeat it for all other rows
+    FillImageViewRow(view, 0, 0, view.width, color);
 
-    // Repeat the first pixel data throughout the image
-    for (int i = 1; i < dst->width*dst->height; i++)
-    {
-        memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    for (int y = 1; y < view.height; y++) memcpy(GetImageViewRow(view, y), view.data, view.width*view.bytesPerPixel);
 }
 
 // Draw pixel within an image
@@ -3349,7 +4099,7 @@ void ImageDrawPixel(Image *dst, int x, int y, Color color)
             // NOTE: Calculate grayscale equivalent color (normalized to 32bit)
             Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-            ((unsigned short*)dst->data)[y*dst->width + x] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+            ((unsigned short*)dst->data)[y*dst->width + x] = rlFloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
 
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
@@ -3357,19 +4107,19 @@ void ImageDrawPixel(Image *dst, int x, int y, Color color)
             // NOTE: Calculate R32G32B32 equivalent color (normalized to 32bit)
             Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = FloatToHalf(coln.z);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3] = rlFloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 1] = rlFloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*3 + 2] = rlFloatToHalf(coln.z);
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
         {
             // NOTE: Calculate R32G32B32A32 equivalent color (normalized to 32bit)
             Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
 
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = FloatToHalf(coln.x);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = FloatToHalf(coln.y);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = FloatToHalf(coln.z);
-            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = FloatToHalf(coln.w);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4] = rlFloatToHalf(coln.x);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 1] = rlFloatToHalf(coln.y);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 2] = rlFloatToHalf(coln.z);
+            ((unsigned short *)dst->data)[(y*dst->width + x)*4 + 3] = rlFloatToHalf(coln.w);
 
         } break;
         default: break;
@@ -3575,29 +4325,13 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     if ((rec.x >= dst->width) || (rec.y >= dst->height)) return;
     if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return;
 
-    int sy = (int)rec.y;
-    int sx = (int)rec.x;
-
-    int bytesPerPixel = GetPixelDataSize(1, 1, dst->format);
-
-    // Fill in the first pixel of the first row based on image format
-    ImageDrawPixel(dst, sx, sy, color);
+    ImageView view = GetImageViewRec(*dst, rec);
 
-    int bytesOffset = ((sy*dst->width) + sx)*bytesPerPixel;
-    unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
-
-    // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x++)
-    {
-        memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, bytesPerPixel);
-    }
+    // Fill in the first row based on image format
+    FillImageViewRow(view, 0, 0, view.width, color);
 
     // Repeat the first row data for all other rows
-    int bytesPerRow = bytesPerPixel * (int)rec.width;
-    for (int y = 1; y < (int)rec.height; y++)
-    {
-        memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
-    }
+    for (int y = 1; y < view.height; y++) memcpy(GetImageViewRow(view, y), view.data, view.width*view.bytesPerPixel);
 }
 
 // Draw rectangle lines within an image
@@ -3612,18 +4346,29 @@ void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
 // Draw an image (source) within an image (destination)
 // NOTE: Color tint is applied to source image
 void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    ImageDrawEx(dst, src, srcRec, dstRec, tint, BLEND_ALPHA, TEXTURE_FILTER_BILINEAR);
+}
+
+// Draw an image (source) within an image (destination) with blend mode and scaling filter
+// NOTE: Supported blend modes: BLEND_ALPHA, BLEND_ALPHA_PREMULTIPLY
+// NOTE: Supported filters: TEXTURE_FILTER_POINT, TEXTURE_FILTER_BILINEAR (any other filter)
+void ImageDrawEx(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, int blendMode, int filter)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
         (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
     if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
-    if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    if ((dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (src.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
     else
     {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
+        BlitJob job = { 0 };
+        job.dst = dst;
+        job.src = src;
+        job.tint = tint;
+        job.blendMode = (blendMode == BLEND_ALPHA_PREMULTIPLY)? BLEND_ALPHA_PREMULTIPLY : BLEND_ALPHA;
+        job.filter = (filter == TEXTURE_FILTER_POINT)? TEXTURE_FILTER_POINT : TEXTURE_FILTER_BILINEAR;
 
         // Source rectangle out-of-bounds security checks
         if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
@@ -3631,97 +4376,87 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
         if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
 
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source, and we apply all required transform
+        // Check if source rectangle needs to be scaled to destination rectangle
+        // In that case, source rectangle is sampled for every destination pixel, no source copy is required
         if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
         {
-            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
-
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
-
-        // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
-        {
-            srcRec.x -= dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
+            job.srcX = (int)srcRec.x;
+            job.srcY = (int)srcRec.y;
+            job.srcWidth = (int)srcRec.width;
+            job.srcHeight = (int)srcRec.height;
+            job.dstX = (int)dstRec.x;
+            job.dstY = (int)dstRec.y;
+            job.dstWidth = (int)dstRec.width;
+            job.dstHeight = (int)dstRec.height;
+
+            // Destination rectangle clipped to destination image
+            job.clipX = (job.dstX < 0)? 0 : job.dstX;
+            job.clipY = (job.dstY < 0)? 0 : job.dstY;
+            job.clipWidth = (((job.dstX + job.dstWidth) > dst->width)? dst->width : (job.dstX + job.dstWidth)) - job.clipX;
+            job.clipHeight = (((job.dstY + job.dstHeight) > dst->height)? dst->height : (job.dstY + job.dstHeight)) - job.clipY;
         }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
-
-        if (dstRec.y < 0)
+        else
         {
-            srcRec.y -= dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
-
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
-
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
-
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32 and 16-bit equivalents
+            // Destination rectangle out-of-bounds security checks
+            if (dstRec.x < 0)
+            {
+                srcRec.x -= dstRec.x;
+                srcRec.width += dstRec.x;
+                dstRec.x = 0;
+            }
+            else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
 
-        Color colSrc, colDst, blend;
-        bool blendRequired = true;
+            if (dstRec.y < 0)
+            {
+                srcRec.y -= dstRec.y;
+                srcRec.height += dstRec.y;
+                dstRec.y = 0;
+            }
+            else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+            if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
+            if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+            job.srcX = (int)srcRec.x;
+            job.srcY = (int)srcRec.y;
+            job.srcWidth = job.dstWidth = job.clipWidth = (int)srcRec.width;
+            job.srcHeight = job.dstHeight = job.clipHeight = (int)srcRec.height;
+            job.dstX = job.clipX = (int)dstRec.x;
+            job.dstY = job.clipY = (int)dstRec.y;
+        }
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+        if ((job.srcWidth <= 0) || (job.srcHeight <= 0) || (job.clipWidth <= 0) || (job.clipHeight <= 0)) return;
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+        // Fast path: Avoid blend if source has no alpha to blend and no tint is applied
+        if ((tint.r == 255) && (tint.g == 255) && (tint.b == 255) && (tint.a == 255) &&
+            ((src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (src.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) job.opaque = true;
 
-        for (int y = 0; y < (int)srcRec.height; y++)
+        // Scaled drawing, source column (and bilinear weight) for every clipped destination column
+        if ((job.srcWidth != job.dstWidth) || (job.srcHeight != job.dstHeight))
         {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
+            job.columns = (int *)RL_MALLOC(job.clipWidth*sizeof(int));
+            job.weights = (int *)RL_CALLOC(job.clipWidth, sizeof(int));
 
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
+            for (int x = 0; x < job.clipWidth; x++)
             {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
-
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
+                int column = job.clipX - job.dstX + x;
+                int position = (int)(((2*(long long)column + 1)*job.srcWidth*256)/(2*job.dstWidth));
 
-                    SetPixelColor(pDst, blend, dst->format);
-
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
+                if (job.filter == TEXTURE_FILTER_POINT) job.columns[x] = position >> 8;
+                else
+                {
+                    position = (position < 128)? 0 : (position - 128);
+                    job.columns[x] = position >> 8;
+                    job.weights[x] = position & 0xff;
+                    if (job.columns[x] >= (job.srcWidth - 1)) { job.columns[x] = job.srcWidth - 1; job.weights[x] = 0; }
                 }
             }
-
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
         }
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+        ParallelFor(job.clipHeight, IMAGE_JOB_MIN_PIXELS/job.clipWidth + 1, ImageDrawRange, &job);
+
+        RL_FREE(job.columns);
+        RL_FREE(job.weights);
     }
 }
 
@@ -3764,6 +4499,12 @@ Texture2D LoadTexture(const char *fileName)
 
     if (image.data != NULL)
     {
+    #if defined(SUPPORT_IMAGE_MANIPULATION)
+        if (textureMipmaps.enabled && (image.mipmaps == 1) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            ImageMipmapsEx(&image, textureMipmaps.filter, textureMipmaps.srgb, textureMipmaps.alphaCutoff);
+        }
+    #endif
         texture = LoadTextureFromImage(image);
         UnloadImage(image);
     }
@@ -3771,6 +4512,27 @@ Texture2D LoadTexture(const char *fileName)
     return texture;
 }
 
+// Load texture from file through resources cache
+// NOTE: Texture is shared between all users loading same file with same SetTextureLoadMipmaps() settings,
+// it must be released with UnloadTextureCached()
+Texture2D LoadTextureCached(const char *fileName)
+{
+    unsigned long long variant = GetMipmapsConfigKey(textureMipmaps);
+
+    Texture2D *cached = (Texture2D *)GetCachedResource(RESOURCE_TEXTURE, fileName, variant);
+    if (cached != NULL) return *cached;
+
+    Texture2D texture = LoadTexture(fileName);
+
+    if (texture.id > 0)
+    {
+        AddCachedResource(RESOURCE_TEXTURE, fileName, variant, &texture, sizeof(Texture2D), texture.id,
+                          0, GetMipmapsDataSize(texture.width, texture.height, texture.format, texture.mipmaps), UnloadTextureResource);
+    }
+
+    return texture;
+}
+
 // Load a texture from image data
 // NOTE: image is not unloaded, it must be done manually
 Texture2D LoadTextureFromImage(Image image)
@@ -3953,6 +4715,15 @@ void UnloadTexture(Texture2D texture)
     }
 }
 
+// Release texture loaded with LoadTextureCached(), texture is unloaded when not referenced and cache is over budget
+void UnloadTextureCached(Texture2D texture)
+{
+    if ((texture.id > 0) && !ReleaseCachedResource(RESOURCE_TEXTURE, texture.id))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Texture not loaded with LoadTextureCached(), not released", texture.id);
+    }
+}
+
 // Check if a render texture is ready
 bool IsRenderTextureReady(RenderTexture2D target)
 {
@@ -3992,82 +4763,379 @@ void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
     rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
 }
 
-//------------------------------------------------------------------------------------
-// Texture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
+// Update GPU texture with animation frame at time in seconds
+// NOTE: Texture is only updated if frame changed, texture must be loaded from animation image
+void UpdateTextureAnim(Texture2D texture, ImageAnim *anim, float time)
 {
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+    if ((texture.width != anim->image.width) || (texture.height != anim->image.height) || (texture.format != anim->image.format))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Animation frame size or format does not match texture", texture.id);
+        return;
+    }
+
+    int previousFrame = anim->currentFrame;
+    Image frame = GetAnimFrame(anim, time);
+
+    if (anim->currentFrame != previousFrame) UpdateTexture(texture, frame.data);
 }
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filter)
+//------------------------------------------------------------------------------------
+// Texture async loading functions
+//------------------------------------------------------------------------------------
+// Request texture loading in background, returns request id (0 on failure)
+// NOTE: Image file is loaded and decoded on loader thread, GPU upload is done by UpdateTextureAsync(),
+// texture async functions must be called from the render thread, request ids are reused once unloaded
+// WARNING: Loaded textures are shared through resources cache with other requests and LoadTextureCached() users
+int LoadTextureAsync(const char *fileName)
 {
-    switch (filter)
+    int id = 0;
+
+    if (fileName == NULL) return id;
+
+    if (!textureLoader.initialized)
     {
-        case TEXTURE_FILTER_POINT:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+        InitThreadMutex(&textureLoader.mutex);
+        InitThreadCondition(&textureLoader.requestReady);
+        if (textureLoader.uploadBudget <= 0.0f) textureLoader.uploadBudget = TEXTURE_ASYNC_UPLOAD_BUDGET;
+        textureLoader.initialized = true;
+    }
 
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-        } break;
-        case TEXTURE_FILTER_BILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (!textureLoader.started)
+    {
+        textureLoader.quit = false;
+        textureLoader.started = StartThread(&textureLoader.thread, TextureLoaderThread, NULL);
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_TRILINEAR:
+        if (!textureLoader.started) TRACELOG(LOG_WARNING, "TEXTURE: Failed to start loader thread, textures decoded on render thread");
+    }
+#endif
+
+    // Textures already in resources cache (same file and mipmaps settings) are ready at request time
+    Texture2D *cached = (Texture2D *)GetCachedResource(RESOURCE_TEXTURE, fileName, GetMipmapsConfigKey(textureMipmaps));
+
+    LockThreadMutex(&textureLoader.mutex);
+
+    for (int i = 0; i < MAX_TEXTURE_ASYNC_REQUESTS; i++)
+    {
+        TextureRequest *request = &textureLoader.requests[i];
+
+        if ((request->state == TEXTURE_ASYNC_NONE) && !request->cancelled)
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+            int length = (int)strlen(fileName);
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+            memset(request, 0, sizeof(TextureRequest));
+            request->fileName = (char *)RL_MALLOC(length + 1);
+            memcpy(request->fileName, fileName, length + 1);
+            request->sequence = textureLoader.sequence++;
+            request->mipmaps = textureMipmaps;
+            request->state = TEXTURE_ASYNC_LOADING;
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            if (cached != NULL)
+            {
+                request->texture = *cached;
+                request->cached = true;
+                request->state = TEXTURE_ASYNC_READY;   // Callback notified by UpdateTextureAsync()
             }
-        } break;
-        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
+
+            id = i + 1;
+            break;
+        }
     }
-}
+
+    if ((id > 0) && (cached == NULL)) SignalThreadCondition(&textureLoader.requestReady);
+    UnlockThreadMutex(&textureLoader.mutex);
+
+    if ((id == 0) && (cached != NULL)) ReleaseCachedResource(RESOURCE_TEXTURE, cached->id);
+    if (id == 0) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to request async loading, too many requests (max: %i)", fileName, MAX_TEXTURE_ASYNC_REQUESTS);
+
+    return id;
+}
+
+// Get texture async request state (TextureAsyncState)
+int GetTextureAsyncState(int request)
+{
+    int state = TEXTURE_ASYNC_NONE;
+
+    if (textureLoader.initialized && (request > 0) && (request <= MAX_TEXTURE_ASYNC_REQUESTS))
+    {
+        LockThreadMutex(&textureLoader.mutex);
+        if (!textureLoader.requests[request - 1].cancelled) state = textureLoader.requests[request - 1].state;
+        UnlockThreadMutex(&textureLoader.mutex);
+    }
+
+    return state;
+}
+
+// Check if texture async request is uploaded and ready
+bool IsTextureAsyncReady(int request)
+{
+    return (GetTextureAsyncState(request) == TEXTURE_ASYNC_READY);
+}
+
+// Get requested texture, placeholder texture returned until ready
+// NOTE: Once image is decoded, placeholder is returned with the requested texture size
+Texture2D GetTextureAsync(int request)
+{
+    int state = GetTextureAsyncState(request);
+
+    if (state == TEXTURE_ASYNC_READY) return textureLoader.requests[request - 1].texture;
+
+    if (textureLoader.placeholder.id == 0)
+    {
+        // Default placeholder: 2x2 gray checked texture
+        Color pixels[4] = { LIGHTGRAY, GRAY, GRAY, LIGHTGRAY };
+
+        textureLoader.placeholder.id = rlLoadTexture(pixels, 2, 2, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        textureLoader.placeholder.width = 2;
+        textureLoader.placeholder.height = 2;
+        textureLoader.placeholder.mipmaps = 1;
+        textureLoader.placeholder.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        textureLoader.defaultPlaceholder = true;
+    }
+
+    Texture2D texture = textureLoader.placeholder;
+
+    if (state == TEXTURE_ASYNC_UPLOADING)
+    {
+        texture.width = textureLoader.requests[request - 1].texture.width;
+        texture.height = textureLoader.requests[request - 1].texture.height;
+    }
+
+    return texture;
+}
+
+// Unload texture async request (cancelled if still loading)
+void UnloadTextureAsync(int request)
+{
+    if (!textureLoader.initialized || (request <= 0) || (request > MAX_TEXTURE_ASYNC_REQUESTS)) return;
+
+    LockThreadMutex(&textureLoader.mutex);
+
+    TextureRequest *texRequest = &textureLoader.requests[request - 1];
+
+    if (texRequest->decoding) texRequest->cancelled = true;     // Released by loader thread once decoded
+    else if (texRequest->state != TEXTURE_ASYNC_NONE)
+    {
+        UnloadImage(texRequest->image);
+        if (texRequest->cached) ReleaseCachedResource(RESOURCE_TEXTURE, texRequest->texture.id);
+        else UnloadTexture(texRequest->texture);
+        RL_FREE(texRequest->fileName);
+        memset(texRequest, 0, sizeof(TextureRequest));
+    }
+
+    UnlockThreadMutex(&textureLoader.mutex);
+}
+
+// Upload decoded textures to GPU, limited by upload budget
+// NOTE: Called by EndDrawing(), at least one upload step is processed per call,
+// textures bigger than TEXTURE_ASYNC_UPLOAD_BAND_SIZE are uploaded by rows bands along multiple frames
+void UpdateTextureAsync(void)
+{
+    if (!textureLoader.initialized) return;
+
+    double startTime = GetTime();
+    double budget = (double)textureLoader.uploadBudget/1000.0;
+
+    LockThreadMutex(&textureLoader.mutex);
+
+    // Without loader thread, one image is decoded per call on render thread
+    if (!textureLoader.started)
+    {
+        TextureRequest *request = GetNextTextureRequest(TEXTURE_ASYNC_LOADING);
+        if (request != NULL) DecodeTextureRequest(request);
+    }
+
+    // Notify failed requests
+    for (TextureRequest *request = GetNextTextureRequest(TEXTURE_ASYNC_FAILED); request != NULL; request = GetNextTextureRequest(TEXTURE_ASYNC_FAILED))
+    {
+        request->notified = true;
+        if (textureLoader.callback != NULL) textureLoader.callback((int)(request - textureLoader.requests) + 1, (Texture2D){ 0 });
+    }
+
+    // Notify requests served from resources cache
+    for (TextureRequest *request = GetNextTextureRequest(TEXTURE_ASYNC_READY); request != NULL; request = GetNextTextureRequest(TEXTURE_ASYNC_READY))
+    {
+        request->notified = true;
+        if (textureLoader.callback != NULL) textureLoader.callback((int)(request - textureLoader.requests) + 1, request->texture);
+    }
+
+    // Upload decoded requests, first in first out
+    // NOTE: Decoded requests data is only accessed by render thread, mutex is only required to update state
+    TextureRequest *request = GetNextTextureRequest(TEXTURE_ASYNC_UPLOADING);
+    UnlockThreadMutex(&textureLoader.mutex);
+
+    while (request != NULL)
+    {
+        if (UploadTextureRequest(request))
+        {
+            int id = (int)(request - textureLoader.requests) + 1;
+            Texture2D texture = request->texture;
+
+            // Uploaded texture is added to resources cache, request keeps the reference
+            if (texture.id > 0)
+            {
+                request->cached = AddCachedResource(RESOURCE_TEXTURE, request->fileName, GetMipmapsConfigKey(request->mipmaps), &texture, sizeof(Texture2D),
+                                                    texture.id, 0, GetMipmapsDataSize(texture.width, texture.height, texture.format, texture.mipmaps), UnloadTextureResource);
+            }
+
+            LockThreadMutex(&textureLoader.mutex);
+            request->state = (texture.id > 0)? TEXTURE_ASYNC_READY : TEXTURE_ASYNC_FAILED;
+            request->notified = true;
+            request = GetNextTextureRequest(TEXTURE_ASYNC_UPLOADING);
+            UnlockThreadMutex(&textureLoader.mutex);
+
+            if (textureLoader.callback != NULL) textureLoader.callback(id, texture);
+        }
+
+        if ((GetTime() - startTime) >= budget) break;
+    }
+}
+
+// Set GPU upload time budget per UpdateTextureAsync() call (milliseconds)
+void SetTextureAsyncUploadBudget(float milliseconds)
+{
+    textureLoader.uploadBudget = (milliseconds > 0.0f)? milliseconds : TEXTURE_ASYNC_UPLOAD_BUDGET;
+}
+
+// Set placeholder texture for not ready requests
+// NOTE: Provided texture is not unloaded internally, default placeholder is used if texture.id = 0
+void SetTextureAsyncPlaceholder(Texture2D texture)
+{
+    if (textureLoader.defaultPlaceholder) UnloadTexture(textureLoader.placeholder);
+
+    textureLoader.placeholder = texture;
+    textureLoader.defaultPlaceholder = false;
+}
+
+// Set callback for finished texture async requests
+// NOTE: Callback is called from UpdateTextureAsync() on render thread
+void SetTextureAsyncCallback(TextureAsyncCallback callback)
+{
+    textureLoader.callback = callback;
+}
+
+// Stop texture loader thread and unload all texture async requests
+// NOTE: Called by CloseWindow(), before closing resources cache and graphics device
+void CloseTextureAsync(void)
+{
+    if (!textureLoader.initialized) return;
+
+    if (textureLoader.started)
+    {
+        LockThreadMutex(&textureLoader.mutex);
+        textureLoader.quit = true;
+        BroadcastThreadCondition(&textureLoader.requestReady);
+        UnlockThreadMutex(&textureLoader.mutex);
+
+        JoinThread(&textureLoader.thread);
+        textureLoader.started = false;
+    }
+
+    for (int i = 0; i < MAX_TEXTURE_ASYNC_REQUESTS; i++)
+    {
+        UnloadImage(textureLoader.requests[i].image);
+        if (textureLoader.requests[i].cached) ReleaseCachedResource(RESOURCE_TEXTURE, textureLoader.requests[i].texture.id);
+        else UnloadTexture(textureLoader.requests[i].texture);
+        RL_FREE(textureLoader.requests[i].fileName);
+        memset(&textureLoader.requests[i], 0, sizeof(TextureRequest));
+    }
+
+    if (textureLoader.defaultPlaceholder) UnloadTexture(textureLoader.placeholder);
+    textureLoader.placeholder = (Texture2D){ 0 };
+    textureLoader.defaultPlaceholder = false;
+
+    CloseThreadCondition(&textureLoader.requestReady);
+    CloseThreadMutex(&textureLoader.mutex);
+    textureLoader.initialized = false;
+}
+
+//------------------------------------------------------------------------------------
+// Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Set mipmaps generation for textures loaded from files (LoadTexture(), LoadTextureAsync())
+// NOTE: Mipmaps are generated with ImageMipmapsEx() for uncompressed images without mipmaps,
+// async requests generate mipmaps on loader thread with the settings available at request time
+void SetTextureLoadMipmaps(bool enabled, int filter, bool srgb, float alphaCutoff)
+{
+    textureMipmaps.enabled = enabled;
+    textureMipmaps.filter = filter;
+    textureMipmaps.srgb = srgb;
+    textureMipmaps.alphaCutoff = alphaCutoff;
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
 
 // Set texture wrapping mode
 void SetTextureWrap(Texture2D texture, int wrap)
@@ -4185,31 +5253,23 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
+        // Texture coordinates left and right sides, swapped if flipped horizontally
+        float left = flipX? (source.x + source.width)/width : source.x/width;
+        float right = flipX? source.x/width : (source.x + source.width)/width;
+        float top = source.y/height;
+        float bottom = (source.y + source.height)/height;
+
+        // Quad vertex: top-left, bottom-left, bottom-right and top-right corners
+        float vertices[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+        float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+
         rlSetTexture(texture.id);
         rlBegin(RL_QUADS);
 
             rlColor4ub(tint.r, tint.g, tint.b, tint.a);
             rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
-
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
-
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+            rlAppendVertices2D(vertices, texcoords, NULL, 4);
 
         rlEnd();
         rlSetTexture(0);
@@ -4315,6 +5375,48 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
         coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
         coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
 
+        // Patches quads, defined by grid cells between vertA, vertB, vertC and vertD lines
+        // NOTE: Three-patch layouts use one single column (vertical) or row (horizontal) spanning from A to D,
+        // center patch is drawn if drawCenter (also middle row of vertical layout), middle row if drawMiddle
+        Vector2 verts[4] = { vertA, vertB, vertC, vertD };
+        Vector2 coords[4] = { coordA, coordB, coordC, coordD };
+        bool singleColumn = (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL);
+        bool singleRow = (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL);
+        bool drawMiddleRow = singleColumn? drawCenter : drawMiddle;
+        float vertices[2*4*9] = { 0 };
+        float texcoords[2*4*9] = { 0 };
+        int vertexCount = 0;
+
+        for (int row = 0; row < (singleRow? 1 : 3); row++)
+        {
+            if ((row == 1) && !drawMiddleRow) continue;
+
+            int top = singleRow? 0 : row;
+            int bottom = singleRow? 3 : row + 1;
+
+            for (int col = 0; col < (singleColumn? 1 : 3); col++)
+            {
+                if ((col == 1) && !drawCenter) continue;
+
+                int left = singleColumn? 0 : col;
+                int right = singleColumn? 3 : col + 1;
+
+                // Quad vertex: bottom-left, bottom-right, top-right, top-left (texture and quad)
+                float quadVertices[8] = {
+                    verts[left].x, verts[bottom].y, verts[right].x, verts[bottom].y,
+                    verts[right].x, verts[top].y, verts[left].x, verts[top].y
+                };
+                float quadTexcoords[8] = {
+                    coords[left].x, coords[bottom].y, coords[right].x, coords[bottom].y,
+                    coords[right].x, coords[top].y, coords[left].x, coords[top].y
+                };
+
+                memcpy(vertices + 2*vertexCount, quadVertices, 8*sizeof(float));
+                memcpy(texcoords + 2*vertexCount, quadTexcoords, 8*sizeof(float));
+                vertexCount += 4;
+            }
+        }
+
         rlSetTexture(texture.id);
 
         rlPushMatrix();
@@ -4326,126 +5428,7 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
                 rlColor4ub(tint.r, tint.g, tint.b, tint.a);
                 rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
 
-                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
-                    {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
-                        {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
-                        }
-
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
-
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
-
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
-                {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                    }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
-                {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                }
+                rlAppendVertices2D(vertices, texcoords, NULL, vertexCount);
             rlEnd();
         rlPopMatrix();
 
@@ -4823,28 +5806,28 @@ Color GetPixelColor(void *srcPtr, int format)
         case PIXELFORMAT_UNCOMPRESSED_R16:
         {
             // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
             color.a = 255;
 
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
         {
             // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
             color.a = 255;
 
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
         {
             // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+            color.r = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
+            color.g = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
+            color.b = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
+            color.a = (unsigned char)(rlHalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
 
         } break;
         default: break;
@@ -4972,13 +5955,12 @@ int GetPixelDataSize(int width, int height, int format)
 
     dataSize = width*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
-    }
+    // Most compressed formats works on 4x4 blocks, partial blocks are stored complete
+    // NOTE: ASTC 8x8 works on 8x8 blocks (16 bytes), PVRT minimum size is 8x8 pixels
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if ((format == PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == PIXELFORMAT_COMPRESSED_PVRT_RGBA)) dataSize = ((width < 8)? 8 : width)*((height < 8)? 8 : height)*bpp/8;
+    else if (format == PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) dataSize = ((width + 3)/4)*((height + 3)/4)*16;
+    else if (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) dataSize = ((width + 7)/8)*((height + 7)/8)*16;
 
     return dataSize;
 }
@@ -4986,24 +5968,6 @@ int GetPixelDataSize(int width, int height, int format)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-// From https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-
-static float HalfToFloat(unsigned short x) {
-    const unsigned int e = (x&0x7C00)>>10; // exponent
-    const unsigned int m = (x&0x03FF)<<13; // mantissa
-    const float fm = (float)m;
-    const unsigned int v = (*(unsigned int*)&fm)>>23; // evil log2 bit hack to count leading zeros in denormalized format
-    const unsigned int r = (x&0x8000)<<16 | (e!=0)*((e+112)<<23|m) | ((e==0)&(m!=0))*((v-37)<<23|((m<<(150-v))&0x007FE000)); // sign : normalized : denormalized
-    return *(float*)&r;
-}
-
-static unsigned short FloatToHalf(float x) {
-    const unsigned int b = (*(unsigned int*)&x)+0x00001000; // round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b&0x7F800000)>>23; // exponent
-    const unsigned int m = b&0x007FFFFF; // mantissa; in line below: 0x007FF000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
-    return (b&0x80000000)>>16 | (e>112)*((((e-112)<<10)&0x7C00)|m>>13) | ((e<113)&(e>101))*((((0x007FF000+m)>>(125-e))+1)>>1) | (e>143)*0x7FFF; // sign : normalized : denormalized : saturate
-}
-
 // Get pixel data from image as Vector4 array (float normalized)
 static Vector4 *LoadImageDataNormalized(Image image)
 {
@@ -5012,132 +5976,6010 @@ static Vector4 *LoadImageDataNormalized(Image image)
     if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
     else
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+        ImageJob job = { 0 };
+        job.image = image;
+        job.output = pixels;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+        ParallelFor(image.width*image.height, IMAGE_JOB_MIN_PIXELS, LoadImageDataNormalizedRange, &job);
+    }
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    return pixels;
+}
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+// Get number of components stored per pixel (uncompressed formats)
+// NOTE: Packed 16bit formats (R5G6B5, R5G5B5A1, R4G4B4A4) are considered one component
+static int GetPixelComponentsCount(int format)
+{
+    int count = 1;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: count = 2; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: count = 3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: count = 4; break;
+        default: break;
+    }
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+    return count;
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Load image pixels range as Color values, required by LoadImageColors()
+static void LoadImageColorsRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Image image = job->image;
+    Color *pixels = (Color *)job->output;
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    for (int i = start, k = start*GetPixelComponentsCount(image.format); i < end; i++)
+    {
+        switch (image.format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                pixels[i].r = ((unsigned char *)image.data)[i];
+                pixels[i].g = ((unsigned char *)image.data)[i];
+                pixels[i].b = ((unsigned char *)image.data)[i];
+                pixels[i].a = 255;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                pixels[i].r = ((unsigned char *)image.data)[k];
+                pixels[i].g = ((unsigned char *)image.data)[k];
+                pixels[i].b = ((unsigned char *)image.data)[k];
+                pixels[i].a = ((unsigned char *)image.data)[k + 1];
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+                k += 2;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111000000) >> 6)*(255/31));
+                pixels[i].b = (unsigned char)((float)((pixel & 0b0000000000111110) >> 1)*(255/31));
+                pixels[i].a = (unsigned char)((pixel & 0b0000000000000001)*255);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111100000000000) >> 11)*(255/31));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000011111100000) >> 5)*(255/63));
+                pixels[i].b = (unsigned char)((float)(pixel & 0b0000000000011111)*(255/31));
+                pixels[i].a = 255;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].r = (unsigned char)((float)((pixel & 0b1111000000000000) >> 12)*(255/15));
+                pixels[i].g = (unsigned char)((float)((pixel & 0b0000111100000000) >> 8)*(255/15));
+                pixels[i].b = (unsigned char)((float)((pixel & 0b0000000011110000) >> 4)*(255/15));
+                pixels[i].a = (unsigned char)((float)(pixel & 0b0000000000001111)*(255/15));
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                pixels[i].r = ((unsigned char *)image.data)[k];
+                pixels[i].g = ((unsigned char *)image.data)[k + 1];
+                pixels[i].b = ((unsigned char *)image.data)[k + 2];
+                pixels[i].a = ((unsigned char *)image.data)[k + 3];
+
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                pixels[i].r = (unsigned char)((unsigned char *)image.data)[k];
+                pixels[i].g = (unsigned char)((unsigned char *)image.data)[k + 1];
+                pixels[i].b = (unsigned char)((unsigned char *)image.data)[k + 2];
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].g = 0;
+                pixels[i].b = 0;
+                pixels[i].a = 255;
+
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].g = (unsigned char)(((float *)image.data)[k + 1]*255.0f);
+                pixels[i].b = (unsigned char)(((float *)image.data)[k + 2]*255.0f);
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                pixels[i].r = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].g = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].b = (unsigned char)(((float *)image.data)[k]*255.0f);
+                pixels[i].a = (unsigned char)(((float *)image.data)[k]*255.0f);
+
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                pixels[i].r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].g = 0;
+                pixels[i].b = 0;
+                pixels[i].a = 255;
+
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                pixels[i].r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k + 1])*255.0f);
+                pixels[i].b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k + 2])*255.0f);
+                pixels[i].a = 255;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                pixels[i].r = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].g = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].b = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+                pixels[i].a = (unsigned char)(rlHalfToFloat(((unsigned short *)image.data)[k])*255.0f);
+
+                k += 4;
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Load image pixels range as normalized Vector4 values, required by LoadImageDataNormalized()
+static void LoadImageDataNormalizedRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Image image = job->image;
+    Vector4 *pixels = (Vector4 *)job->output;
+
+    for (int i = start, k = start*GetPixelComponentsCount(image.format); i < end; i++)
+    {
+        switch (image.format)
+        {
+            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+            {
+                pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+            {
+                pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                k += 2;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                pixels[i].w = 1.0f;
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+            {
+                unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+            {
+                pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+            {
+                pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                pixels[i].w = 1.0f;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32:
+            {
+                pixels[i].x = ((float *)image.data)[k];
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
+
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+            {
+                pixels[i].x = ((float *)image.data)[k];
+                pixels[i].y = ((float *)image.data)[k + 1];
+                pixels[i].z = ((float *)image.data)[k + 2];
+                pixels[i].w = 1.0f;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+            {
+                pixels[i].x = ((float *)image.data)[k];
+                pixels[i].y = ((float *)image.data)[k + 1];
+                pixels[i].z = ((float *)image.data)[k + 2];
+                pixels[i].w = ((float *)image.data)[k + 3];
+
+                k += 4;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16:
+            {
+                pixels[i].x = rlHalfToFloat(((unsigned short *)image.data)[k]);
+                pixels[i].y = 0.0f;
+                pixels[i].z = 0.0f;
+                pixels[i].w = 1.0f;
+
+                k += 1;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+            {
+                pixels[i].x = rlHalfToFloat(((unsigned short *)image.data)[k]);
+                pixels[i].y = rlHalfToFloat(((unsigned short *)image.data)[k + 1]);
+                pixels[i].z = rlHalfToFloat(((unsigned short *)image.data)[k + 2]);
+                pixels[i].w = 1.0f;
+
+                k += 3;
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+            {
+                pixels[i].x = rlHalfToFloat(((unsigned short *)image.data)[k]);
+                pixels[i].y = rlHalfToFloat(((unsigned short *)image.data)[k + 1]);
+                pixels[i].z = rlHalfToFloat(((unsigned short *)image.data)[k + 2]);
+                pixels[i].w = rlHalfToFloat(((unsigned short *)image.data)[k + 3]);
+
+                k += 4;
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Convert normalized pixels range to image format, required by ImageFormat()
+static void FormatImageRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Image *image = &job->image;
+    Vector4 *pixels = job->pixels;
+
+    switch (image->format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            for (int i = start; i < end; i++)
+            {
+                ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            for (int i = start*2, k = start; k < end; i += 2, k++)
+            {
+                ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+
+            for (int i = start; i < end; i++)
+            {
+                r = (unsigned char)(round(pixels[i].x*31.0f));
+                g = (unsigned char)(round(pixels[i].y*63.0f));
+                b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (int i = start*3, k = start; k < end; i += 3, k++)
+            {
+                ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+            unsigned char a = 0;
+
+            for (int i = start; i < end; i++)
+            {
+                r = (unsigned char)(round(pixels[i].x*31.0f));
+                g = (unsigned char)(round(pixels[i].y*31.0f));
+                b = (unsigned char)(round(pixels[i].z*31.0f));
+                a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+                ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned char r = 0;
+            unsigned char g = 0;
+            unsigned char b = 0;
+            unsigned char a = 0;
+
+            for (int i = start; i < end; i++)
+            {
+                r = (unsigned char)(round(pixels[i].x*15.0f));
+                g = (unsigned char)(round(pixels[i].y*15.0f));
+                b = (unsigned char)(round(pixels[i].z*15.0f));
+                a = (unsigned char)(round(pixels[i].w*15.0f));
+
+                ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+            }
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            for (int i = start*4, k = start; k < end; i += 4, k++)
+            {
+                ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // WARNING: Image is converted to GRAYSCALE equivalent 32bit
+            for (int i = start; i < end; i++)
+            {
+                ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            for (int i = start*3, k = start; k < end; i += 3, k++)
+            {
+                ((float *)image->data)[i] = pixels[k].x;
+                ((float *)image->data)[i + 1] = pixels[k].y;
+                ((float *)image->data)[i + 2] = pixels[k].z;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            for (int i = start*4, k = start; k < end; i += 4, k++)
+            {
+                ((float *)image->data)[i] = pixels[k].x;
+                ((float *)image->data)[i + 1] = pixels[k].y;
+                ((float *)image->data)[i + 2] = pixels[k].z;
+                ((float *)image->data)[i + 3] = pixels[k].w;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // WARNING: Image is converted to GRAYSCALE equivalent 16bit
+            for (int i = start; i < end; i++)
+            {
+                ((unsigned short *)image->data)[i] = rlFloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        {
+            for (int i = start*3, k = start; k < end; i += 3, k++)
+            {
+                ((unsigned short *)image->data)[i] = rlFloatToHalf(pixels[k].x);
+                ((unsigned short *)image->data)[i + 1] = rlFloatToHalf(pixels[k].y);
+                ((unsigned short *)image->data)[i + 2] = rlFloatToHalf(pixels[k].z);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            for (int i = start*4, k = start; k < end; i += 4, k++)
+            {
+                ((unsigned short *)image->data)[i] = rlFloatToHalf(pixels[k].x);
+                ((unsigned short *)image->data)[i + 1] = rlFloatToHalf(pixels[k].y);
+                ((unsigned short *)image->data)[i + 2] = rlFloatToHalf(pixels[k].z);
+                ((unsigned short *)image->data)[i + 3] = rlFloatToHalf(pixels[k].w);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Check if pixel format conversion can be done directly, without normalized float intermediate
+// NOTE: Supported conversions give exactly the same result than the normalized float conversion
+static bool IsPixelFormatDirectConvertible(int format, int newFormat)
+{
+    bool result = false;
+
+    bool source8bit = ((format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                       (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    bool source16bit = ((format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+                        (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4));
+    bool target8bit = ((newFormat == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (newFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+                       (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    bool target16bit = ((newFormat == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (newFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) ||
+                        (newFormat == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4));
+
+    // 8bit channels are exactly recovered from normalized values (v/255.0f*255.0f == v),
+    // so any 8bit format can go through RGBA8 before packing to target format
+    if (source8bit && (target8bit || target16bit)) result = true;
+
+    // 16bit packed formats are expanded to 8bit channels, only valid for formats without grayscale computation
+    if (source16bit && ((newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))) result = true;
+
+    return result;
+}
+
+// Unpack pixels from 8bit or 16bit packed format into RGBA8
+// NOTE: 16bit packed channels are expanded with same float operations than LoadImageDataNormalized() + ImageFormat()
+static void UnpackPixelsRGBA(const void *data, int format, int offset, int count, Color *output)
+{
+    const unsigned char *src8 = (const unsigned char *)data;
+    const unsigned short *src16 = (const unsigned short *)data + offset;
+    int i = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            src8 += offset;
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            for (; i <= (count - 16); i += 16)
+            {
+                __m128i gray = _mm_loadu_si128((const __m128i *)(src8 + i));
+                __m128i grayLo = _mm_unpacklo_epi8(gray, gray);
+                __m128i grayHi = _mm_unpackhi_epi8(gray, gray);
+                __m128i alphaLo = _mm_unpacklo_epi8(gray, _mm_set1_epi8(-1));
+                __m128i alphaHi = _mm_unpackhi_epi8(gray, _mm_set1_epi8(-1));
+
+                _mm_storeu_si128((__m128i *)(output + i), _mm_unpacklo_epi16(grayLo, alphaLo));
+                _mm_storeu_si128((__m128i *)(output + i + 4), _mm_unpackhi_epi16(grayLo, alphaLo));
+                _mm_storeu_si128((__m128i *)(output + i + 8), _mm_unpacklo_epi16(grayHi, alphaHi));
+                _mm_storeu_si128((__m128i *)(output + i + 12), _mm_unpackhi_epi16(grayHi, alphaHi));
+            }
+        #endif
+            for (; i < count; i++) output[i] = (Color){ src8[i], src8[i], src8[i], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            src8 += offset*2;
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            for (; i <= (count - 8); i += 8)
+            {
+                __m128i grayAlpha = _mm_loadu_si128((const __m128i *)(src8 + i*2));
+                __m128i gray = _mm_and_si128(grayAlpha, _mm_set1_epi16(0xff));
+                gray = _mm_or_si128(gray, _mm_slli_epi16(gray, 8));
+
+                _mm_storeu_si128((__m128i *)(output + i), _mm_unpacklo_epi16(gray, grayAlpha));
+                _mm_storeu_si128((__m128i *)(output + i + 4), _mm_unpackhi_epi16(gray, grayAlpha));
+            }
+        #endif
+            for (; i < count; i++) output[i] = (Color){ src8[i*2], src8[i*2], src8[i*2], src8[i*2 + 1] };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            src8 += offset*3;
+            for (; i < count; i++) output[i] = (Color){ src8[i*3], src8[i*3 + 1], src8[i*3 + 2], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(output, src8 + offset*4, count*sizeof(Color)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // Channel expansion tables, computed with same float operations than normalized conversion
+            unsigned char expand4[16] = { 0 };
+            unsigned char expand5[32] = { 0 };
+            unsigned char expand6[64] = { 0 };
+
+            for (int k = 0; k < 16; k++) expand4[k] = (unsigned char)(((float)k*(1.0f/15))*255.0f);
+            for (int k = 0; k < 32; k++) expand5[k] = (unsigned char)(((float)k*(1.0f/31))*255.0f);
+            for (int k = 0; k < 64; k++) expand6[k] = (unsigned char)(((float)k*(1.0f/63))*255.0f);
+
+            if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+            {
+                for (; i < count; i++) output[i] = (Color){ expand5[src16[i] >> 11], expand6[(src16[i] >> 5) & 0x3f], expand5[src16[i] & 0x1f], 255 };
+            }
+            else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+            {
+                for (; i < count; i++) output[i] = (Color){ expand5[src16[i] >> 11], expand5[(src16[i] >> 6) & 0x1f], expand5[(src16[i] >> 1) & 0x1f], (src16[i] & 0x1)? 255 : 0 };
+            }
+            else
+            {
+                for (; i < count; i++) output[i] = (Color){ expand4[src16[i] >> 12], expand4[(src16[i] >> 8) & 0xf], expand4[(src16[i] >> 4) & 0xf], expand4[src16[i] & 0xf] };
+            }
+        } break;
+        default: break;
+    }
+}
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+// Divide 16bit unsigned lanes by 255 (truncated), valid for values lower than 65535
+static inline __m128i Div255Epu16(__m128i value)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(value, _mm_set1_epi16(1)), _mm_srli_epi16(value, 8)), 8);
+}
+
+// Compute grayscale value of 4 RGBA8 pixels, same float operations than normalized conversion
+static inline __m128i GrayscaleEpi32(__m128i pixels)
+{
+    __m128i mask = _mm_set1_epi32(0xff);
+    __m128 r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(pixels, mask)), _mm_set1_ps(255.0f));
+    __m128 g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 8), mask)), _mm_set1_ps(255.0f));
+    __m128 b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 16), mask)), _mm_set1_ps(255.0f));
+    __m128 gray = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(0.299f)), _mm_mul_ps(g, _mm_set1_ps(0.587f))), _mm_mul_ps(b, _mm_set1_ps(0.114f)));
+
+    return _mm_cvttps_epi32(_mm_mul_ps(gray, _mm_set1_ps(255.0f)));
+}
+#endif
+
+// Pack RGBA8 pixels into 8bit or 16bit packed format
+// NOTE: Integer rounding is equivalent to normalized conversion: round(v/255.0f*31.0f) == (v*31 + 127)/255
+static void PackPixelsRGBA(const Color *pixels, int count, int format, void *data, int offset)
+{
+    unsigned char *dst8 = (unsigned char *)data;
+    unsigned short *dst16 = (unsigned short *)data + offset;
+    int i = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            int channels = (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)? 1 : 2;
+            dst8 += offset*channels;
+
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            for (; i <= (count - 8); i += 8)
+            {
+                __m128i pixelsLo = _mm_loadu_si128((const __m128i *)(pixels + i));
+                __m128i pixelsHi = _mm_loadu_si128((const __m128i *)(pixels + i + 4));
+                __m128i gray = _mm_packs_epi32(GrayscaleEpi32(pixelsLo), GrayscaleEpi32(pixelsHi));
+
+                if (channels == 1) _mm_storel_epi64((__m128i *)(dst8 + i), _mm_packus_epi16(gray, gray));
+                else
+                {
+                    __m128i alpha = _mm_packs_epi32(_mm_srli_epi32(pixelsLo, 24), _mm_srli_epi32(pixelsHi, 24));
+                    _mm_storeu_si128((__m128i *)(dst8 + i*2), _mm_or_si128(gray, _mm_slli_epi16(alpha, 8)));
+                }
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                float r = (float)pixels[i].r/255.0f;
+                float g = (float)pixels[i].g/255.0f;
+                float b = (float)pixels[i].b/255.0f;
+
+                dst8[i*channels] = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
+                if (channels == 2) dst8[i*2 + 1] = pixels[i].a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            dst8 += offset*3;
+            for (; i < count; i++)
+            {
+                dst8[i*3] = pixels[i].r;
+                dst8[i*3 + 1] = pixels[i].g;
+                dst8[i*3 + 2] = pixels[i].b;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst8 + offset*4, pixels, count*sizeof(Color)); break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            for (; i <= (count - 8); i += 8)
+            {
+                __m128i pixelsLo = _mm_loadu_si128((const __m128i *)(pixels + i));
+                __m128i pixelsHi = _mm_loadu_si128((const __m128i *)(pixels + i + 4));
+                __m128i mask = _mm_set1_epi32(0xff);
+                __m128i r = _mm_packs_epi32(_mm_and_si128(pixelsLo, mask), _mm_and_si128(pixelsHi, mask));
+                __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(pixelsLo, 8), mask), _mm_and_si128(_mm_srli_epi32(pixelsHi, 8), mask));
+                __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(pixelsLo, 16), mask), _mm_and_si128(_mm_srli_epi32(pixelsHi, 16), mask));
+                __m128i a = _mm_packs_epi32(_mm_srli_epi32(pixelsLo, 24), _mm_srli_epi32(pixelsHi, 24));
+                __m128i half = _mm_set1_epi16(127);
+                __m128i result;
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    r = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(31)), half));
+                    g = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(g, _mm_set1_epi16(63)), half));
+                    b = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(31)), half));
+                    result = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+                }
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    r = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(31)), half));
+                    g = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(g, _mm_set1_epi16(31)), half));
+                    b = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(31)), half));
+                    a = _mm_and_si128(_mm_cmpgt_epi16(a, _mm_set1_epi16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), _mm_set1_epi16(1));
+                    result = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 6)), _mm_or_si128(_mm_slli_epi16(b, 1), a));
+                }
+                else
+                {
+                    r = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(15)), half));
+                    g = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(g, _mm_set1_epi16(15)), half));
+                    b = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(15)), half));
+                    a = Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(a, _mm_set1_epi16(15)), half));
+                    result = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 12), _mm_slli_epi16(g, 8)), _mm_or_si128(_mm_slli_epi16(b, 4), a));
+                }
+
+                _mm_storeu_si128((__m128i *)(dst16 + i), result);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned short r = (unsigned short)((pixels[i].r*31 + 127)/255);
+                unsigned short b = (unsigned short)((pixels[i].b*31 + 127)/255);
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    unsigned short g = (unsigned short)((pixels[i].g*63 + 127)/255);
+                    dst16[i] = r << 11 | g << 5 | b;
+                }
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    unsigned short g = (unsigned short)((pixels[i].g*31 + 127)/255);
+                    unsigned short a = (pixels[i].a > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+                    dst16[i] = r << 11 | g << 6 | b << 1 | a;
+                }
+                else
+                {
+                    dst16[i] = (unsigned short)(((pixels[i].r*15 + 127)/255) << 12 | ((pixels[i].g*15 + 127)/255) << 8 |
+                                                ((pixels[i].b*15 + 127)/255) << 4 | ((pixels[i].a*15 + 127)/255));
+                }
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Convert pixels range directly between formats, required by ImageFormat()
+// NOTE: Pixels are converted in small blocks through RGBA8, block stays in cache
+static void ConvertImageRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Color block[IMAGE_CONVERT_BLOCK_SIZE];
+
+    for (int i = start; i < end; i += IMAGE_CONVERT_BLOCK_SIZE)
+    {
+        int count = ((end - i) < IMAGE_CONVERT_BLOCK_SIZE)? (end - i) : IMAGE_CONVERT_BLOCK_SIZE;
+        const Color *pixels = block;
+
+        if (job->image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixels = (const Color *)job->image.data + i;
+        else UnpackPixelsRGBA(job->image.data, job->image.format, i, count, block);
+
+        PackPixelsRGBA(pixels, count, job->value, job->output, i);
+    }
+}
+
+// Load source pixels row as RGBA8 colors for image drawing
+// NOTE: Conversion is equivalent to GetPixelColor() for every pixel
+static void LoadBlitSourceRow(Image src, int x, int y, int count, Color *colors)
+{
+    int bytesPerPixel = GetPixelDataSize(1, 1, src.format);
+    unsigned char *row = (unsigned char *)src.data + y*src.width*bytesPerPixel;
+
+    if ((src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (src.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+        (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        UnpackPixelsRGBA(row, src.format, x, count, colors);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++) colors[i] = GetPixelColor(row + (x + i)*bytesPerPixel, src.format);
+    }
+}
+
+// Blend source pixels over destination pixels (alpha blending)
+// NOTE: Results are equivalent to ColorAlphaBlend() for every pixel
+static void BlendPixelsAlpha(Color *dst, const Color *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+    const bool tinted = ((tint.r < 255) || (tint.g < 255) || (tint.b < 255) || (tint.a < 255));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+    const __m128i colorMask = _mm_set_epi32(0, -1, -1, -1);
+    const __m128i tintFactor = _mm_set_epi16(tint.a + 1, tint.b + 1, tint.g + 1, tint.r + 1, tint.a + 1, tint.b + 1, tint.g + 1, tint.r + 1);
+
+    // NOTE: Integer blending is computed with floats, all intermediate values are exactly
+    // representable (lower than 2^24) and truncated in the same points than ColorAlphaBlend()
+    for (; i <= (count - 4); i += 4)
+    {
+        __m128i colSrc = _mm_loadu_si128((const __m128i *)(src + i));
+
+        if (tinted)
+        {
+            __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(colSrc, zero), tintFactor), 8);
+            __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(colSrc, zero), tintFactor), 8);
+            colSrc = _mm_packus_epi16(lo, hi);
+        }
+
+        __m128i alpha = _mm_and_si128(colSrc, alphaMask);
+        __m128i transparent = _mm_cmpeq_epi32(alpha, zero);
+        __m128i opaque = _mm_cmpeq_epi32(alpha, alphaMask);
+
+        // Fast path: Avoid blend if source pixels are fully transparent or fully opaque
+        if (_mm_movemask_epi8(transparent) == 0xffff) continue;
+        if (_mm_movemask_epi8(opaque) == 0xffff)
+        {
+            _mm_storeu_si128((__m128i *)(dst + i), colSrc);
+            continue;
+        }
+
+        __m128i colDst = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i src16[2] = { _mm_unpacklo_epi8(colSrc, zero), _mm_unpackhi_epi8(colSrc, zero) };
+        __m128i dst16[2] = { _mm_unpacklo_epi8(colDst, zero), _mm_unpackhi_epi8(colDst, zero) };
+        __m128i out[4] = { 0 };
+
+        for (int k = 0; k < 4; k++)
+        {
+            __m128 s = _mm_cvtepi32_ps((k & 1)? _mm_unpackhi_epi16(src16[k/2], zero) : _mm_unpacklo_epi16(src16[k/2], zero));
+            __m128 d = _mm_cvtepi32_ps((k & 1)? _mm_unpackhi_epi16(dst16[k/2], zero) : _mm_unpacklo_epi16(dst16[k/2], zero));
+            __m128 srcAlpha = _mm_add_ps(_mm_shuffle_ps(s, s, _MM_SHUFFLE(3, 3, 3, 3)), _mm_set1_ps(1.0f));
+            __m128 srcInvAlpha = _mm_sub_ps(_mm_set1_ps(256.0f), srcAlpha);
+            __m128 dstAlpha = _mm_shuffle_ps(d, d, _MM_SHUFFLE(3, 3, 3, 3));
+
+            __m128i outAlpha = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(srcAlpha, _mm_set1_ps(256.0f)), _mm_mul_ps(dstAlpha, srcInvAlpha)), _mm_set1_ps(1.0f/256.0f)));
+            __m128 dstTerm = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(_mm_mul_ps(_mm_mul_ps(d, dstAlpha), srcInvAlpha), _mm_set1_ps(1.0f/256.0f))));
+            __m128i color = _mm_cvttps_epi32(_mm_div_ps(_mm_add_ps(_mm_mul_ps(s, srcAlpha), dstTerm), _mm_cvtepi32_ps(outAlpha)));
+
+            // NOTE: Color channels are truncated to 8bit, alpha channel is the output alpha
+            out[k] = _mm_or_si128(_mm_and_si128(_mm_and_si128(color, _mm_set1_epi32(0xff)), colorMask), _mm_andnot_si128(colorMask, outAlpha));
+        }
+
+        __m128i blend = _mm_packus_epi16(_mm_packs_epi32(out[0], out[1]), _mm_packs_epi32(out[2], out[3]));
+        blend = _mm_or_si128(_mm_and_si128(transparent, colDst), _mm_andnot_si128(transparent, blend));
+        blend = _mm_or_si128(_mm_and_si128(opaque, colSrc), _mm_andnot_si128(opaque, blend));
+
+        _mm_storeu_si128((__m128i *)(dst + i), blend);
+    }
+#endif
+
+    for (; i < count; i++) dst[i] = ColorAlphaBlend(dst[i], src[i], tint);
+}
+
+// Blend premultiplied source pixels over destination pixels
+// NOTE: Color tint is applied to source color as in ColorAlphaBlend()
+static void BlendPixelsPremultiplied(Color *dst, const Color *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tintFactor = _mm_set_epi16(tint.a + 1, tint.b + 1, tint.g + 1, tint.r + 1, tint.a + 1, tint.b + 1, tint.g + 1, tint.r + 1);
+
+    for (; i <= (count - 4); i += 4)
+    {
+        __m128i colSrc = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i colDst = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i result[2] = { 0 };
+
+        for (int k = 0; k < 2; k++)
+        {
+            __m128i s = _mm_srli_epi16(_mm_mullo_epi16((k == 0)? _mm_unpacklo_epi8(colSrc, zero) : _mm_unpackhi_epi8(colSrc, zero), tintFactor), 8);
+            __m128i d = (k == 0)? _mm_unpacklo_epi8(colDst, zero) : _mm_unpackhi_epi8(colDst, zero);
+
+            // Broadcast source alpha to all pixel channels: out = src + dst*(255 - src.a)/255
+            __m128i invAlpha = _mm_sub_epi16(_mm_set1_epi16(255), _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)));
+            result[k] = _mm_add_epi16(s, Div255Epu16(_mm_add_epi16(_mm_mullo_epi16(d, invAlpha), _mm_set1_epi16(127))));
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(result[0], result[1]));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int s[4] = { src[i].r, src[i].g, src[i].b, src[i].a };
+        unsigned int d[4] = { dst[i].r, dst[i].g, dst[i].b, dst[i].a };
+        unsigned int t[4] = { tint.r, tint.g, tint.b, tint.a };
+        unsigned char out[4] = { 0 };
+
+        for (int k = 0; k < 4; k++) s[k] = (s[k]*(t[k] + 1)) >> 8;
+        for (int k = 0; k < 4; k++)
+        {
+            unsigned int value = s[k] + (d[k]*(255 - s[3]) + 127)/255;
+            out[k] = (unsigned char)((value > 255)? 255 : value);
+        }
+
+        dst[i] = (Color){ out[0], out[1], out[2], out[3] };
+    }
+}
+
+// Draw source image rows range within destination image
+// NOTE: Every destination row is processed as: [load source row(s) -> sample -> blend -> store]
+static void ImageDrawRange(void *data, int start, int end)
+{
+    BlitJob *job = (BlitJob *)data;
+    Image *dst = job->dst;
+    Image src = job->src;
+
+    bool scaled = ((job->srcWidth != job->dstWidth) || (job->srcHeight != job->dstHeight));
+    int bytesPerPixelDst = GetPixelDataSize(1, 1, dst->format);
+    int bytesPerPixelSrc = GetPixelDataSize(1, 1, src.format);
+
+    // Row buffers: source rows (2 required for bilinear sampling), sampled source row and destination row
+    Color *buffer = (Color *)RL_MALLOC((2*job->srcWidth + 2*job->clipWidth)*sizeof(Color));
+    Color *srcRows[2] = { buffer, buffer + job->srcWidth };
+    int srcRowsY[2] = { -1, -1 };
+    Color *samples = buffer + 2*job->srcWidth;
+    Color *pixels = samples + job->clipWidth;
+
+    for (int y = start; y < end; y++)
+    {
+        int row = job->clipY - job->dstY + y;      // Row inside destination rectangle
+        unsigned char *pDst = (unsigned char *)dst->data + ((job->clipY + y)*dst->width + job->clipX)*bytesPerPixelDst;
+        const Color *colSrc = samples;
+
+        if (!scaled)
+        {
+            int sx = job->srcX + job->clipX - job->dstX;
+            int sy = job->srcY + row;
+
+            // Fast path: Avoid moving pixel by pixel if no blend required and same format
+            if (job->opaque && (src.format == dst->format))
+            {
+                memcpy(pDst, (unsigned char *)src.data + (sy*src.width + sx)*bytesPerPixelSrc, job->clipWidth*bytesPerPixelSrc);
+                continue;
+            }
+
+            if (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) colSrc = (const Color *)src.data + sy*src.width + sx;
+            else LoadBlitSourceRow(src, sx, sy, job->clipWidth, samples);
+        }
+        else
+        {
+            // Source rows required by sampling, fixed point position (8bit fraction)
+            int position = (int)(((2*(long long)row + 1)*job->srcHeight*256)/(2*job->dstHeight));
+            int fraction = 0;
+            int sy[2] = { 0 };
+
+            if (job->filter == TEXTURE_FILTER_POINT) sy[0] = position >> 8;
+            else
+            {
+                position = (position < 128)? 0 : (position - 128);
+                sy[0] = position >> 8;
+                fraction = position & 0xff;
+                if (sy[0] >= (job->srcHeight - 1)) { sy[0] = job->srcHeight - 1; fraction = 0; }
+            }
+
+            sy[1] = (fraction > 0)? (sy[0] + 1) : sy[0];
+
+            const Color *rows[2] = { 0 };
+
+            for (int k = 0; k < 2; k++)
+            {
+                if (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) rows[k] = (const Color *)src.data + (job->srcY + sy[k])*src.width + job->srcX;
+                else
+                {
+                    // Reuse converted source rows, consecutive destination rows usually share them
+                    int slot = (srcRowsY[0] == sy[k])? 0 : ((srcRowsY[1] == sy[k])? 1 : -1);
+
+                    if (slot == -1)
+                    {
+                        // Replace the cached row not required by current destination row
+                        slot = (srcRowsY[0] == sy[1 - k])? 1 : 0;
+                        LoadBlitSourceRow(src, job->srcX, job->srcY + sy[k], job->srcWidth, srcRows[slot]);
+                        srcRowsY[slot] = sy[k];
+                    }
+
+                    rows[k] = srcRows[slot];
+                }
+            }
+
+            if (job->filter == TEXTURE_FILTER_POINT)
+            {
+                for (int x = 0; x < job->clipWidth; x++) samples[x] = rows[0][job->columns[x]];
+            }
+            else
+            {
+                for (int x = 0; x < job->clipWidth; x++)
+                {
+                    int sx = job->columns[x];
+                    int fx = job->weights[x];
+                    int sx1 = (fx > 0)? (sx + 1) : sx;
+                    const unsigned char *c00 = (const unsigned char *)&rows[0][sx];
+                    const unsigned char *c01 = (const unsigned char *)&rows[0][sx1];
+                    const unsigned char *c10 = (const unsigned char *)&rows[1][sx];
+                    const unsigned char *c11 = (const unsigned char *)&rows[1][sx1];
+                    unsigned char *out = (unsigned char *)&samples[x];
+
+                    for (int c = 0; c < 4; c++)
+                    {
+                        int top = c00[c]*(256 - fx) + c01[c]*fx;
+                        int bottom = c10[c]*(256 - fx) + c11[c]*fx;
+                        out[c] = (unsigned char)((top*(256 - fraction) + bottom*fraction + 32768) >> 16);
+                    }
+                }
+            }
+        }
+
+        // Blend sampled source pixels over destination pixels
+        Color *colDst = (dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? (Color *)pDst : pixels;
+
+        if ((colDst == pixels) && !job->opaque)
+        {
+            for (int x = 0; x < job->clipWidth; x++) pixels[x] = GetPixelColor(pDst + x*bytesPerPixelDst, dst->format);
+        }
+
+        if (job->opaque) memcpy(colDst, colSrc, job->clipWidth*sizeof(Color));
+        else if (job->blendMode == BLEND_ALPHA_PREMULTIPLY) BlendPixelsPremultiplied(colDst, colSrc, job->clipWidth, job->tint);
+        else BlendPixelsAlpha(colDst, colSrc, job->clipWidth, job->tint);
+
+        if (colDst == pixels)
+        {
+            for (int x = 0; x < job->clipWidth; x++) SetPixelColor(pDst + x*bytesPerPixelDst, pixels[x], dst->format);
+        }
+    }
+
+    RL_FREE(buffer);
+}
+
+#if defined(SUPPORT_FILEFORMAT_PNG) || defined(SUPPORT_FILEFORMAT_QOI)
+// Read one byte from image file stream, -1 on end of data
+// NOTE: Chunked streams (PNG) only return data from consecutive IDAT chunks
+static int ReadStreamByte(ImageStream *stream)
+{
+    if (stream->chunked)
+    {
+        while (stream->chunkSize == 0)
+        {
+            // Current chunk finished: skip its CRC, image data continues only if next chunk is IDAT
+            unsigned char header[12] = { 0 };
+
+            stream->chunked = false;
+            if (!ReadStreamData(stream, header, 12) || (memcmp(header + 8, "IDAT", 4) != 0))
+            {
+                stream->error = true;
+                return -1;
+            }
+
+            stream->chunked = true;
+            stream->chunkSize = ((unsigned int)header[4] << 24) | ((unsigned int)header[5] << 16) | ((unsigned int)header[6] << 8) | header[7];
+        }
+
+        stream->chunkSize--;
+    }
+
+    if (stream->position >= stream->size)
+    {
+        stream->size = (int)fread(stream->buffer, 1, IMAGE_STREAM_BUFFER_SIZE, stream->file);
+        stream->position = 0;
+
+        if (stream->size <= 0)
+        {
+            stream->size = 0;
+            stream->error = true;
+            return -1;
+        }
+    }
+
+    return stream->buffer[stream->position++];
+}
+
+// Read data from image file stream, returns false if not enough data available
+static bool ReadStreamData(ImageStream *stream, unsigned char *data, int size)
+{
+    for (int i = 0; (i < size) && !stream->error; i++)
+    {
+        int value = ReadStreamByte(stream);
+        if (data != NULL) data[i] = (unsigned char)value;
+    }
+
+    return !stream->error;
+}
+
+// Init incremental area-averaging downscaler, output size must not be bigger than source size
+// NOTE: Returns false if sizes are not supported or memory can not be allocated (full loading is used)
+static bool InitImageDownscaler(ImageDownscaler *scaler, int width, int height, int newWidth, int newHeight, int channels)
+{
+    if ((width > IMAGE_STREAM_MAX_SIZE) || (height > IMAGE_STREAM_MAX_SIZE)) return false;
+    if ((newWidth > width) || (newHeight > height)) return false;
+
+    // NOTE: Sizes are computed in size_t, output size could overflow on 32 bit platforms
+    size_t rowLength = (size_t)newWidth*channels;
+    if ((size_t)newHeight > SIZE_MAX/rowLength) return false;
+
+    scaler->width = width;
+    scaler->height = height;
+    scaler->newWidth = newWidth;
+    scaler->newHeight = newHeight;
+    scaler->channels = channels;
+    scaler->sourceRow = 0;
+    scaler->outputRow = 0;
+    scaler->columns = (int *)RL_MALLOC(2*(size_t)width*sizeof(int));
+    scaler->row = (unsigned long long *)RL_MALLOC(rowLength*sizeof(unsigned long long));
+    scaler->sums = (unsigned long long *)RL_CALLOC(2*rowLength, sizeof(unsigned long long));
+    scaler->output = (unsigned char *)RL_MALLOC(rowLength*newHeight);
+
+    if ((scaler->columns == NULL) || (scaler->row == NULL) || (scaler->sums == NULL) || (scaler->output == NULL))
+    {
+        CloseImageDownscaler(scaler);
+        RL_FREE(scaler->output);
+        scaler->output = NULL;
+        return false;
+    }
+
+    scaler->weights = scaler->columns + width;
+
+    // Source column x covers [x*newWidth, (x + 1)*newWidth) and output column covers [column*width, (column + 1)*width),
+    // source column weight is split between two output columns when crossing the boundary
+    for (int x = 0; x < width; x++)
+    {
+        long long start = (long long)x*newWidth;
+        long long end = start + newWidth;
+        int column = (int)(start/width);
+        long long boundary = (long long)(column + 1)*width;
+
+        scaler->columns[x] = column;
+        scaler->weights[x] = (int)(((end < boundary)? end : boundary) - start);
+    }
+
+    return true;
+}
+
+// Add next source row to downscaler, output rows are written when completed
+static void AddImageDownscalerRow(ImageDownscaler *scaler, const unsigned char *pixels)
+{
+    int channels = scaler->channels;
+    int newWidth = scaler->newWidth;
+    unsigned long long *current = scaler->sums;
+    unsigned long long *next = scaler->sums + newWidth*channels;
+
+    // Horizontal downscale: weighted sums of source columns
+    // NOTE: Every output column sums (width*255) at most, 64 bit required for widths above 16M pixels
+    memset(scaler->row, 0, newWidth*channels*sizeof(unsigned long long));
+
+    for (int x = 0; x < scaler->width; x++)
+    {
+        unsigned long long *row = scaler->row + scaler->columns[x]*channels;
+        unsigned int weight = (unsigned int)scaler->weights[x];
+        const unsigned char *pixel = pixels + (size_t)x*channels;
+
+        for (int c = 0; c < channels; c++) row[c] += weight*pixel[c];
+
+        if (weight < (unsigned int)newWidth)
+        {
+            for (int c = 0; c < channels; c++) row[channels + c] += ((unsigned int)newWidth - weight)*pixel[c];
+        }
+    }
+
+    // Vertical downscale: source row weight is split between current and next output rows
+    long long start = (long long)scaler->sourceRow*scaler->newHeight;
+    long long end = start + scaler->newHeight;
+    long long boundary = (long long)(scaler->outputRow + 1)*scaler->height;
+    unsigned long long weight = (unsigned long long)(((end < boundary)? end : boundary) - start);
+
+    for (int i = 0; i < newWidth*channels; i++)
+    {
+        current[i] += weight*scaler->row[i];
+        if (weight < (unsigned long long)scaler->newHeight) next[i] += ((unsigned long long)scaler->newHeight - weight)*scaler->row[i];
+    }
+
+    scaler->sourceRow++;
+
+    if (end >= boundary)
+    {
+        // Output row completed, every output pixel total weight is (width*height)
+        unsigned long long area = (unsigned long long)scaler->width*scaler->height;
+        unsigned char *output = scaler->output + (size_t)scaler->outputRow*newWidth*channels;
+
+        for (int i = 0; i < newWidth*channels; i++) output[i] = (unsigned char)((current[i] + area/2)/area);
+
+        memcpy(current, next, newWidth*channels*sizeof(unsigned long long));
+        memset(next, 0, newWidth*channels*sizeof(unsigned long long));
+        scaler->outputRow++;
+    }
+}
+
+// Unload downscaler working data, output pixels data is not freed
+static void CloseImageDownscaler(ImageDownscaler *scaler)
+{
+    RL_FREE(scaler->columns);
+    RL_FREE(scaler->row);
+    RL_FREE(scaler->sums);
+
+    scaler->columns = NULL;
+    scaler->row = NULL;
+    scaler->sums = NULL;
+}
+
+// Get downscaled image, pixel format depends on channels per pixel
+static Image GetImageDownscaled(ImageDownscaler *scaler)
+{
+    Image image = { 0 };
+
+    image.data = scaler->output;
+    image.width = scaler->newWidth;
+    image.height = scaler->newHeight;
+    image.mipmaps = 1;
+
+    if (scaler->channels == 1) image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    else if (scaler->channels == 2) image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    else if (scaler->channels == 3) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+    else image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+// Get bits from inflate stream, bits are read LSB first
+static unsigned int InflateBits(InflateState *state, int count)
+{
+    while (state->bitCount < count)
+    {
+        int value = ReadStreamByte(state->stream);
+
+        if (value < 0) { state->error = true; value = 0; }
+
+        state->bitBuffer |= (unsigned int)value << state->bitCount;
+        state->bitCount += 8;
+    }
+
+    unsigned int bits = state->bitBuffer & ((1u << count) - 1);
+    state->bitBuffer >>= count;
+    state->bitCount -= count;
+
+    return bits;
+}
+
+// Build canonical Huffman decoding table from codes lengths
+// NOTE: Incomplete codes are accepted, over-subscribed codes are not
+static bool InflateBuildHuffman(InflateHuffman *huffman, const unsigned char *lengths, int count)
+{
+    short offsets[16] = { 0 };
+
+    memset(huffman->count, 0, sizeof(huffman->count));
+    memset(huffman->fast, 0, sizeof(huffman->fast));
+
+    for (int i = 0; i < count; i++) huffman->count[lengths[i]]++;
+    if (huffman->count[0] == count) return true;
+
+    int left = 1;
+    for (int len = 1; len < 16; len++)
+    {
+        left = (left << 1) - huffman->count[len];
+        if (left < 0) return false;
+    }
+
+    for (int len = 1; len < 15; len++) offsets[len + 1] = offsets[len] + huffman->count[len];
+    for (int i = 0; i < count; i++) if (lengths[i] != 0) huffman->symbol[offsets[lengths[i]]++] = (short)i;
+
+    // Fast lookup table for short codes, indexed by next stream bits (codes are stored bit reversed)
+    for (int len = 1, code = 0, index = 0; len <= INFLATE_FAST_BITS; len++, code <<= 1)
+    {
+        for (int i = 0; i < huffman->count[len]; i++, code++, index++)
+        {
+            int reversed = 0;
+            for (int b = 0; b < len; b++) reversed |= ((code >> b) & 1) << (len - 1 - b);
+
+            for (int k = reversed; k < (1 << INFLATE_FAST_BITS); k += (1 << len)) huffman->fast[k] = (short)((huffman->symbol[index] << 4) | len);
+        }
+    }
+
+    return true;
+}
+
+// Decode one symbol from inflate stream, -1 on error
+static int InflateDecode(InflateState *state, const InflateHuffman *huffman)
+{
+    // NOTE: Valid zlib streams end with a 4 bytes checksum, so peeking fast lookup bits never reads past the stream
+    while (state->bitCount < INFLATE_FAST_BITS)
+    {
+        int value = ReadStreamByte(state->stream);
+
+        if (value < 0) { state->error = true; return -1; }
+
+        state->bitBuffer |= (unsigned int)value << state->bitCount;
+        state->bitCount += 8;
+    }
+
+    int entry = huffman->fast[state->bitBuffer & ((1 << INFLATE_FAST_BITS) - 1)];
+
+    if (entry > 0)
+    {
+        state->bitBuffer >>= (entry & 15);
+        state->bitCount -= (entry & 15);
+        return entry >> 4;
+    }
+
+    // Codes longer than fast lookup bits are decoded bit by bit
+    for (int len = 1, code = 0, first = 0, index = 0; len < 16; len++)
+    {
+        code |= (int)InflateBits(state, 1);
+
+        if ((code - huffman->count[len]) < first) return huffman->symbol[index + (code - first)];
+
+        index += huffman->count[len];
+        first = (first + huffman->count[len]) << 1;
+        code <<= 1;
+    }
+
+    state->error = true;
+    return -1;
+}
+
+// Read inflate block header and codes tables
+static bool InflateBlockHeader(InflateState *state)
+{
+    static const unsigned char order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    unsigned char lengths[320] = { 0 };
+
+    state->lastBlock = (InflateBits(state, 1) == 1);
+    state->blockType = (int)InflateBits(state, 2);
+
+    if (state->blockType == 0)
+    {
+        // Stored block, data starts at next byte boundary
+        InflateBits(state, state->bitCount & 7);
+
+        unsigned int size = InflateBits(state, 16);
+        unsigned int complement = InflateBits(state, 16);
+
+        if (size != (~complement & 0xffff)) return false;
+        state->storedSize = (int)size;
+    }
+    else if (state->blockType == 1)
+    {
+        // Fixed Huffman codes
+        for (int i = 0; i < 288; i++) lengths[i] = (i < 144)? 8 : (i < 256)? 9 : (i < 280)? 7 : 8;
+        for (int i = 0; i < 30; i++) lengths[288 + i] = 5;
+
+        InflateBuildHuffman(&state->literals, lengths, 288);
+        InflateBuildHuffman(&state->distances, lengths + 288, 30);
+    }
+    else if (state->blockType == 2)
+    {
+        // Dynamic Huffman codes, codes lengths are also Huffman coded
+        int literalCount = (int)InflateBits(state, 5) + 257;
+        int distanceCount = (int)InflateBits(state, 5) + 1;
+        int codeCount = (int)InflateBits(state, 4) + 4;
+
+        if ((literalCount > 286) || (distanceCount > 30)) return false;
+
+        for (int i = 0; i < codeCount; i++) lengths[order[i]] = (unsigned char)InflateBits(state, 3);
+        if (!InflateBuildHuffman(&state->literals, lengths, 19)) return false;
+
+        memset(lengths, 0, sizeof(lengths));
+
+        for (int i = 0; i < (literalCount + distanceCount);)
+        {
+            int symbol = InflateDecode(state, &state->literals);
+            int repeat = 0;
+            unsigned char value = 0;
+
+            if (symbol < 0) return false;
+            else if (symbol < 16) { lengths[i++] = (unsigned char)symbol; continue; }
+            else if (symbol == 16)
+            {
+                if (i == 0) return false;
+                value = lengths[i - 1];
+                repeat = 3 + (int)InflateBits(state, 2);
+            }
+            else if (symbol == 17) repeat = 3 + (int)InflateBits(state, 3);
+            else repeat = 11 + (int)InflateBits(state, 7);
+
+            if ((i + repeat) > (literalCount + distanceCount)) return false;
+            while (repeat-- > 0) lengths[i++] = value;
+        }
+
+        // End of block code is required
+        if (lengths[256] == 0) return false;
+
+        if (!InflateBuildHuffman(&state->literals, lengths, literalCount)) return false;
+        if (!InflateBuildHuffman(&state->distances, lengths + literalCount, distanceCount)) return false;
+    }
+    else return false;
+
+    return !state->error;
+}
+
+// Read decompressed data from inflate stream, returns number of bytes read
+static int InflateRead(InflateState *state, unsigned char *output, int count)
+{
+    static const short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const unsigned char lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const unsigned short distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const unsigned char distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    // NOTE: Decompressed data is written to output only, matches are copied from output when possible
+    // and sliding window is updated once at the end, avoiding a window write per byte
+    int size = 0;
+
+    while ((size < count) && !state->error)
+    {
+        if (state->copyLength > 0)
+        {
+            // Pending match, copied from previous output
+            int distance = state->copyDistance;
+            int length = ((count - size) < state->copyLength)? (count - size) : state->copyLength;
+
+            if (distance > size)
+            {
+                // Match source starts before this call output, copy from window up to window end or output start
+                unsigned int position = (state->windowPosition + size - distance) & (INFLATE_WINDOW_SIZE - 1);
+                if (length > (distance - size)) length = distance - size;
+                if (length > (int)(INFLATE_WINDOW_SIZE - position)) length = INFLATE_WINDOW_SIZE - position;
+
+                memcpy(output + size, state->window + position, length);
+            }
+            else if (distance >= length) memcpy(output + size, output + size - distance, length);
+            else for (int i = 0; i < length; i++) output[size + i] = output[size + i - distance];    // Overlapped copy
+
+            size += length;
+            state->copyLength -= length;
+        }
+        else if ((state->blockType == 0) && (state->storedSize > 0))
+        {
+            output[size++] = (unsigned char)InflateBits(state, 8);
+            state->storedSize--;
+        }
+        else if (state->blockType > 0)
+        {
+            int symbol = InflateDecode(state, &state->literals);
+
+            if (symbol < 0) break;
+            else if (symbol < 256) output[size++] = (unsigned char)symbol;
+            else if (symbol == 256) state->blockType = -1;      // End of block
+            else
+            {
+                symbol -= 257;
+                if (symbol >= 29) { state->error = true; break; }
+
+                int length = lengthBase[symbol] + (int)InflateBits(state, lengthExtra[symbol]);
+                int distanceSymbol = InflateDecode(state, &state->distances);
+
+                if ((distanceSymbol < 0) || (distanceSymbol >= 30)) { state->error = true; break; }
+
+                int distance = distanceBase[distanceSymbol] + (int)InflateBits(state, distanceExtra[distanceSymbol]);
+
+                if ((unsigned int)distance > (state->windowPosition + size)) { state->error = true; break; }
+
+                state->copyLength = length;
+                state->copyDistance = distance;
+            }
+        }
+        else
+        {
+            // No current block, read next block header (if any)
+            if (state->lastBlock) break;
+            if (!InflateBlockHeader(state)) state->error = true;
+        }
+    }
+
+    // Update sliding window with last decompressed data
+    int start = (size > INFLATE_WINDOW_SIZE)? (size - INFLATE_WINDOW_SIZE) : 0;
+    unsigned int position = (state->windowPosition + start) & (INFLATE_WINDOW_SIZE - 1);
+    int first = ((size - start) < (int)(INFLATE_WINDOW_SIZE - position))? (size - start) : (int)(INFLATE_WINDOW_SIZE - position);
+
+    memcpy(state->window + position, output + start, first);
+    memcpy(state->window, output + start + first, size - start - first);
+    state->windowPosition += size;
+
+    return size;
+}
+
+// Paeth predictor, required by PNG rows unfiltering
+static inline int PaethPredictor(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+
+    if ((pa <= pb) && (pa <= pc)) return a;
+    else if (pb <= pc) return b;
+    else return c;
+}
+
+// Load PNG image row by row into downscaler
+// NOTE: Supported: all color types and bit depths, non-interlaced, 16 bit channels are reduced to 8 bit
+static bool LoadImageStreamPNG(ImageStream *stream, int newWidth, int newHeight, Image *image)
+{
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+    unsigned char header[13] = { 0 };
+    unsigned char chunk[8] = { 0 };
+    unsigned char palette[256*4] = { 0 };
+    unsigned char transparent[6] = { 0 };
+    bool hasHeader = false;
+    bool hasTransparency = false;
+
+    if (!ReadStreamData(stream, chunk, 8) || (memcmp(chunk, signature, 8) != 0)) return false;
+
+    // Read chunks up to first IDAT chunk
+    for (int i = 0; i < 256; i++) palette[i*4 + 3] = 255;
+
+    while (true)
+    {
+        if (!ReadStreamData(stream, chunk, 8)) return false;
+
+        unsigned int length = ((unsigned int)chunk[0] << 24) | ((unsigned int)chunk[1] << 16) | ((unsigned int)chunk[2] << 8) | chunk[3];
+
+        if (memcmp(chunk + 4, "IDAT", 4) == 0)
+        {
+            stream->chunked = true;
+            stream->chunkSize = length;
+            break;
+        }
+        else if ((memcmp(chunk + 4, "IHDR", 4) == 0) && (length == 13))
+        {
+            if (!ReadStreamData(stream, header, 13)) return false;
+            hasHeader = true;
+        }
+        else if ((memcmp(chunk + 4, "PLTE", 4) == 0) && (length <= 256*3) && ((length%3) == 0))
+        {
+            for (unsigned int k = 0; k < length/3; k++) if (!ReadStreamData(stream, palette + k*4, 3)) return false;
+        }
+        else if ((memcmp(chunk + 4, "tRNS", 4) == 0) && hasHeader)
+        {
+            if (header[9] == 3)
+            {
+                if (length > 256) return false;
+                for (unsigned int k = 0; k < length; k++) if (!ReadStreamData(stream, palette + k*4 + 3, 1)) return false;
+            }
+            else if (length <= 6)
+            {
+                if (!ReadStreamData(stream, transparent, length)) return false;
+            }
+            else return false;
+
+            hasTransparency = true;
+        }
+        else if (memcmp(chunk + 4, "IEND", 4) == 0) return false;
+        else if (!ReadStreamData(stream, NULL, length)) return false;
+
+        if (!ReadStreamData(stream, NULL, 4)) return false;     // Chunk CRC
+    }
+
+    if (!hasHeader) return false;
+
+    int width = (int)(((unsigned int)header[0] << 24) | ((unsigned int)header[1] << 16) | ((unsigned int)header[2] << 8) | header[3]);
+    int height = (int)(((unsigned int)header[4] << 24) | ((unsigned int)header[5] << 16) | ((unsigned int)header[6] << 8) | header[7]);
+    int depth = header[8];
+    int colorType = header[9];
+
+    // Interlaced images are not streamed
+    if ((width <= 0) || (height <= 0) || (width > IMAGE_STREAM_MAX_SIZE) || (height > IMAGE_STREAM_MAX_SIZE)) return false;
+    if ((header[10] != 0) || (header[11] != 0) || (header[12] != 0)) return false;
+
+    int samples = (colorType == 0)? 1 : (colorType == 2)? 3 : (colorType == 3)? 1 : (colorType == 4)? 2 : (colorType == 6)? 4 : 0;
+    if ((samples == 0) || ((depth != 1) && (depth != 2) && (depth != 4) && (depth != 8) && (depth != 16))) return false;
+    if (((samples > 1) && (depth < 8)) || ((colorType == 3) && (depth > 8))) return false;
+
+    int channels = (colorType == 3)? 3 : samples;
+    if (hasTransparency && ((colorType == 0) || (colorType == 2) || (colorType == 3))) channels++;
+
+    // zlib stream header: deflate method, no preset dictionary
+    int cmf = ReadStreamByte(stream);
+    int flg = ReadStreamByte(stream);
+    if ((cmf < 0) || (flg < 0) || ((cmf & 15) != 8) || ((((cmf << 8) | flg)%31) != 0) || ((flg & 32) != 0)) return false;
+
+    ImageDownscaler scaler = { 0 };
+    if (!InitImageDownscaler(&scaler, width, height, newWidth, newHeight, channels)) return false;
+
+    // NOTE: Width is limited to IMAGE_STREAM_MAX_SIZE, row size (up to 2^27 bytes) fits int
+    int rowSize = (int)(((long long)width*samples*depth + 7)/8);
+    int filterStride = (samples*depth + 7)/8;       // Bytes per complete pixel (minimum 1)
+    InflateState *state = (InflateState *)RL_CALLOC(1, sizeof(InflateState));
+    unsigned char *rows = (unsigned char *)RL_CALLOC(2*((size_t)rowSize + 1) + (size_t)width*channels, 1);
+
+    if ((state == NULL) || (rows == NULL))
+    {
+        RL_FREE(state);
+        RL_FREE(rows);
+        CloseImageDownscaler(&scaler);
+        RL_FREE(scaler.output);
+        return false;
+    }
+
+    state->stream = stream;
+    state->blockType = -1;
+
+    unsigned char *current = rows;
+    unsigned char *previous = rows + rowSize + 1;
+    unsigned char *pixels = rows + 2*(rowSize + 1);
+    int maxValue = (1 << depth) - 1;
+    bool success = true;
+
+    for (int y = 0; y < height; y++)
+    {
+        if (InflateRead(state, current, rowSize + 1) != (rowSize + 1)) { success = false; break; }
+
+        // Unfilter row data, first byte is the row filter type
+        unsigned char *row = current + 1;
+        unsigned char *above = previous + 1;
+
+        switch (current[0])
+        {
+            case 0: break;
+            case 1: for (int i = filterStride; i < rowSize; i++) row[i] += row[i - filterStride]; break;
+            case 2: for (int i = 0; i < rowSize; i++) row[i] += above[i]; break;
+            case 3:
+            {
+                for (int i = 0; i < rowSize; i++) row[i] += (unsigned char)((((i >= filterStride)? row[i - filterStride] : 0) + above[i]) >> 1);
+            } break;
+            case 4:
+            {
+                for (int i = 0; i < rowSize; i++)
+                {
+                    row[i] += (unsigned char)PaethPredictor((i >= filterStride)? row[i - filterStride] : 0, above[i], (i >= filterStride)? above[i - filterStride] : 0);
+                }
+            } break;
+            default: success = false; break;
+        }
+
+        if (!success) break;
+
+        // Convert row samples to 8 bit channels
+        for (int x = 0; x < width; x++)
+        {
+            unsigned char *pixel = pixels + x*channels;
+            int value[4] = { 0 };
+
+            for (int c = 0; c < samples; c++)
+            {
+                if (depth == 8) value[c] = row[x*samples + c];
+                else if (depth == 16) value[c] = (row[(x*samples + c)*2] << 8) | row[(x*samples + c)*2 + 1];
+                else value[c] = (row[(x*depth) >> 3] >> (8 - depth - ((x*depth) & 7))) & maxValue;
+            }
+
+            if (colorType == 3) memcpy(pixel, palette + value[0]*4, channels);
+            else
+            {
+                for (int c = 0; c < samples; c++) pixel[c] = (unsigned char)((depth == 16)? (value[c] >> 8) : (depth < 8)? (value[c]*255/maxValue) : value[c]);
+
+                if (channels > samples)
+                {
+                    // Transparent color key, compared with full depth samples
+                    bool key = true;
+                    for (int c = 0; c < samples; c++) if (value[c] != ((transparent[c*2] << 8) | transparent[c*2 + 1])) key = false;
+
+                    pixel[samples] = key? 0 : 255;
+                }
+            }
+        }
+
+        AddImageDownscalerRow(&scaler, pixels);
+
+        unsigned char *temp = previous;
+        previous = current;
+        current = temp;
+    }
+
+    RL_FREE(rows);
+    RL_FREE(state);
+    CloseImageDownscaler(&scaler);
+
+    if (success) *image = GetImageDownscaled(&scaler);
+    else RL_FREE(scaler.output);
+
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_QOI)
+// Load QOI image row by row into downscaler
+// NOTE: Output is always RGBA, as loaded by LoadImage()
+static bool LoadImageStreamQOI(ImageStream *stream, int newWidth, int newHeight, Image *image)
+{
+    unsigned char header[14] = { 0 };
+
+    if (!ReadStreamData(stream, header, 14) || (memcmp(header, "qoif", 4) != 0)) return false;
+
+    int width = (int)(((unsigned int)header[4] << 24) | ((unsigned int)header[5] << 16) | ((unsigned int)header[6] << 8) | header[7]);
+    int height = (int)(((unsigned int)header[8] << 24) | ((unsigned int)header[9] << 16) | ((unsigned int)header[10] << 8) | header[11]);
+
+    if ((width <= 0) || (height <= 0) || (width > IMAGE_STREAM_MAX_SIZE) || (height > IMAGE_STREAM_MAX_SIZE)) return false;
+    if ((header[12] != 3) && (header[12] != 4)) return false;
+
+    ImageDownscaler scaler = { 0 };
+    if (!InitImageDownscaler(&scaler, width, height, newWidth, newHeight, 4)) return false;
+
+    unsigned char *pixels = (unsigned char *)RL_MALLOC((size_t)width*4);
+
+    if (pixels == NULL)
+    {
+        CloseImageDownscaler(&scaler);
+        RL_FREE(scaler.output);
+        return false;
+    }
+
+    unsigned char index[64*4] = { 0 };
+    unsigned char pixel[4] = { 0, 0, 0, 255 };
+    int run = 0;
+
+    for (int y = 0; (y < height) && !stream->error; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (run > 0) run--;
+            else
+            {
+                int op = ReadStreamByte(stream);
+
+                if (op == 0xfe) ReadStreamData(stream, pixel, 3);                // QOI_OP_RGB
+                else if (op == 0xff) ReadStreamData(stream, pixel, 4);           // QOI_OP_RGBA
+                else if ((op & 0xc0) == 0x00) memcpy(pixel, index + op*4, 4);   // QOI_OP_INDEX
+                else if ((op & 0xc0) == 0x40)                                   // QOI_OP_DIFF
+                {
+                    pixel[0] += ((op >> 4) & 0x03) - 2;
+                    pixel[1] += ((op >> 2) & 0x03) - 2;
+                    pixel[2] += (op & 0x03) - 2;
+                }
+                else if ((op & 0xc0) == 0x80)                                   // QOI_OP_LUMA
+                {
+                    int next = ReadStreamByte(stream);
+                    int greenDiff = (op & 0x3f) - 32;
+
+                    pixel[0] += greenDiff - 8 + ((next >> 4) & 0x0f);
+                    pixel[1] += greenDiff;
+                    pixel[2] += greenDiff - 8 + (next & 0x0f);
+                }
+                else run = op & 0x3f;                                           // QOI_OP_RUN
+
+                memcpy(index + ((pixel[0]*3 + pixel[1]*5 + pixel[2]*7 + pixel[3]*11)%64)*4, pixel, 4);
+            }
+
+            memcpy(pixels + x*4, pixel, 4);
+        }
+
+        if (!stream->error) AddImageDownscalerRow(&scaler, pixels);
+    }
+
+    bool success = !stream->error;
+
+    RL_FREE(pixels);
+    CloseImageDownscaler(&scaler);
+
+    if (success) *image = GetImageDownscaled(&scaler);
+    else RL_FREE(scaler.output);
+
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Encode PNG file data, 8 bit per channel pixels data (1 to 4 channels), returned data must be freed
+// NOTE: Rows are filtered in parallel, filtered data is split in chunks compressed in parallel (fixed Huffman codes),
+// every chunk matches can reference previous chunk window and non-last chunks end with a sync flush (empty stored block),
+// so compressed chunks are concatenated in a single zlib stream, every compressed chunk is stored in its own IDAT chunk,
+// result does not depend on the number of threads
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize)
+{
+    PngEncoder encoder = { 0 };
+    encoder.pixels = pixels;
+    encoder.width = width;
+    encoder.height = height;
+    encoder.channels = channels;
+    encoder.filteredSize = (width*channels + 1)*height;
+    encoder.filtered = (unsigned char *)RL_MALLOC(encoder.filteredSize);
+
+    ParallelFor(height, IMAGE_JOB_MIN_PIXELS/width + 1, FilterRowsPNGRange, &encoder);
+
+    // Fixed Huffman codes (RFC 1951, 3.2.6), codes bits are reversed to be written least significant bit first
+    for (int i = 0; i < 288; i++)
+    {
+        int code = 0;
+        int length = 0;
+
+        if (i < 144) { code = 0x30 + i; length = 8; }
+        else if (i < 256) { code = 0x190 + i - 144; length = 9; }
+        else if (i < 280) { code = i - 256; length = 7; }
+        else { code = 0xc0 + i - 280; length = 8; }
+
+        int reversed = 0;
+        for (int k = 0; k < length; k++) reversed |= ((code >> k) & 1) << (length - 1 - k);
+
+        encoder.codes[i] = (unsigned short)reversed;
+        encoder.codeLengths[i] = (unsigned char)length;
+    }
+
+    for (int i = 0; i < 30; i++)
+    {
+        int reversed = 0;
+        for (int k = 0; k < 5; k++) reversed |= ((i >> k) & 1) << (4 - k);
+        encoder.distanceCodes[i] = (unsigned char)reversed;
+
+        for (int distance = deflateDistanceBase[i]; distance < (deflateDistanceBase[i] + (1 << deflateDistanceExtra[i])); distance++)
+        {
+            encoder.distanceSymbols[(distance <= 256)? (distance - 1) : (256 + ((distance - 1) >> 7))] = (unsigned char)i;
+        }
+    }
+
+    // NOTE: Length 258 has its own symbol, it is set last
+    for (int i = 0; i < 29; i++)
+    {
+        for (int length = deflateLengthBase[i]; (length < (deflateLengthBase[i] + (1 << deflateLengthExtra[i]))) && (length <= 258); length++) encoder.lengthSymbols[length] = (unsigned char)i;
+    }
+
+    encoder.chunkCount = (encoder.filteredSize + PNG_DEFLATE_CHUNK_SIZE - 1)/PNG_DEFLATE_CHUNK_SIZE;
+    encoder.chunks = (unsigned char **)RL_CALLOC(encoder.chunkCount, sizeof(unsigned char *));
+    encoder.chunkSizes = (int *)RL_CALLOC(encoder.chunkCount, sizeof(int));
+    encoder.chunkAdlers = (unsigned int *)RL_CALLOC(encoder.chunkCount, sizeof(unsigned int));
+
+    ParallelFor(encoder.chunkCount, 1, CompressChunksPNGRange, &encoder);
+
+    // Combine chunks Adler-32 checksums (same as zlib adler32_combine())
+    unsigned int adler = 1;
+    int idatSize = 0;
+
+    for (int i = 0; i < encoder.chunkCount; i++)
+    {
+        int length = (i < (encoder.chunkCount - 1))? PNG_DEFLATE_CHUNK_SIZE : (encoder.filteredSize - i*PNG_DEFLATE_CHUNK_SIZE);
+        unsigned int remainder = (unsigned int)(length%65521);
+        unsigned int sum1 = adler & 0xffff;
+        unsigned int sum2 = (remainder*sum1)%65521;
+
+        sum1 += (encoder.chunkAdlers[i] & 0xffff) + 65521 - 1;
+        sum2 += (adler >> 16) + (encoder.chunkAdlers[i] >> 16) + 65521 - remainder;
+        if (sum1 >= 65521) sum1 -= 65521;
+        if (sum1 >= 65521) sum1 -= 65521;
+        if (sum2 >= (65521 << 1)) sum2 -= (65521 << 1);
+        if (sum2 >= 65521) sum2 -= 65521;
+        adler = (sum2 << 16) | sum1;
+
+        idatSize += encoder.chunkSizes[i];
+    }
+
+    // File data: signature, IHDR chunk, IDAT chunks (compressed chunks and Adler-32 checksum) and IEND chunk
+    *dataSize = 8 + 25 + idatSize + 16 + 12;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(*dataSize);
+    unsigned char *chunk = fileData + 8;
+    static const unsigned char colorTypes[5] = { 0, 0, 4, 2, 6 };   // Grayscale, gray alpha, RGB, RGBA
+
+    memcpy(fileData, "\x89PNG\r\n\x1a\n", 8);
+
+    chunk[8] = (unsigned char)(width >> 24);
+    chunk[9] = (unsigned char)(width >> 16);
+    chunk[10] = (unsigned char)(width >> 8);
+    chunk[11] = (unsigned char)width;
+    chunk[12] = (unsigned char)(height >> 24);
+    chunk[13] = (unsigned char)(height >> 16);
+    chunk[14] = (unsigned char)(height >> 8);
+    chunk[15] = (unsigned char)height;
+    chunk[16] = 8;                      // Bit depth
+    chunk[17] = colorTypes[channels];   // Color type
+    chunk[18] = 0;                      // Compression method
+    chunk[19] = 0;                      // Filter method
+    chunk[20] = 0;                      // Interlace method
+    PutChunkPNG(chunk, "IHDR", 13);
+    chunk += 25;
+
+    for (int i = 0; i < encoder.chunkCount; i++)
+    {
+        memcpy(chunk, encoder.chunks[i], encoder.chunkSizes[i]);
+        chunk += encoder.chunkSizes[i];
+        RL_FREE(encoder.chunks[i]);
+    }
+
+    chunk[8] = (unsigned char)(adler >> 24);
+    chunk[9] = (unsigned char)(adler >> 16);
+    chunk[10] = (unsigned char)(adler >> 8);
+    chunk[11] = (unsigned char)adler;
+    PutChunkPNG(chunk, "IDAT", 4);
+    chunk += 16;
+
+    PutChunkPNG(chunk, "IEND", 0);
+
+    RL_FREE(encoder.chunks);
+    RL_FREE(encoder.chunkSizes);
+    RL_FREE(encoder.chunkAdlers);
+    RL_FREE(encoder.filtered);
+
+    return fileData;
+}
+
+// Get PNG filtered byte: x current byte, a left byte, b up byte, c up left byte
+static inline unsigned char FilterPNGByte(int filter, int x, int a, int b, int c)
+{
+    int predicted = 0;
+
+    switch (filter)
+    {
+        case 1: predicted = a; break;
+        case 2: predicted = b; break;
+        case 3: predicted = (a + b) >> 1; break;
+        case 4:
+        {
+            // Paeth predictor
+            int pa = abs(b - c);
+            int pb = abs(a - c);
+            int pc = abs(a + b - 2*c);
+
+            predicted = ((pa <= pb) && (pa <= pc))? a : ((pb <= pc)? b : c);
+        } break;
+        default: break;
+    }
+
+    return (unsigned char)(x - predicted);
+}
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+// Get PNG filtered bytes for 16 bytes, same as FilterPNGByte()
+static inline __m128i FilterPNGBytesSSE2(int filter, __m128i x, __m128i a, __m128i b, __m128i c)
+{
+    __m128i predicted = _mm_setzero_si128();
+
+    switch (filter)
+    {
+        case 1: predicted = a; break;
+        case 2: predicted = b; break;
+        case 3: predicted = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1))); break;  // Rounded down average
+        case 4:
+        {
+            // Paeth predictor, computed with 16 bit values
+            __m128i zero = _mm_setzero_si128();
+            __m128i halves[2] = { zero, zero };
+
+            for (int h = 0; h < 2; h++)
+            {
+                __m128i a16 = h? _mm_unpackhi_epi8(a, zero) : _mm_unpacklo_epi8(a, zero);
+                __m128i b16 = h? _mm_unpackhi_epi8(b, zero) : _mm_unpacklo_epi8(b, zero);
+                __m128i c16 = h? _mm_unpackhi_epi8(c, zero) : _mm_unpacklo_epi8(c, zero);
+                __m128i pa = _mm_sub_epi16(b16, c16);
+                __m128i pb = _mm_sub_epi16(a16, c16);
+                __m128i pc = _mm_add_epi16(pa, pb);
+
+                pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+                pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+                pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+                __m128i notA = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc));
+                __m128i notB = _mm_cmpgt_epi16(pb, pc);
+                __m128i bc = _mm_or_si128(_mm_and_si128(notB, c16), _mm_andnot_si128(notB, b16));
+
+                halves[h] = _mm_or_si128(_mm_and_si128(notA, bc), _mm_andnot_si128(notA, a16));
+            }
+
+            predicted = _mm_packus_epi16(halves[0], halves[1]);
+        } break;
+        default: break;
+    }
+
+    return _mm_sub_epi8(x, predicted);
+}
+#endif
+
+// Filter PNG rows range, required by EncodeImagePNG()
+// NOTE: Filter with the lowest sum of filtered values (as signed bytes) is selected for every row
+static void FilterRowsPNGRange(void *data, int start, int end)
+{
+    PngEncoder *encoder = (PngEncoder *)data;
+    int bpp = encoder->channels;
+    int stride = encoder->width*bpp;
+    unsigned char *zeros = (unsigned char *)RL_CALLOC(stride, 1);
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *row = encoder->pixels + (size_t)y*stride;
+        const unsigned char *up = (y > 0)? (row - stride) : zeros;
+        unsigned char *output = encoder->filtered + (size_t)y*(stride + 1);
+        int sums[5] = { 0 };
+        int i = bpp;
+
+        // NOTE: First pixel has no left neighbour (a = c = 0)
+        for (int f = 0; f < 5; f++)
+        {
+            for (int k = 0; k < bpp; k++) sums[f] += abs((signed char)FilterPNGByte(f, row[k], 0, up[k], 0));
+        }
+
+    #if defined(RL_TEXTURES_SIMD_SSE2)
+        // Absolute value of signed bytes is min(x, -x) as unsigned bytes, summed with _mm_sad_epu8()
+        __m128i zero = _mm_setzero_si128();
+        __m128i totals[5] = { zero, zero, zero, zero, zero };
+
+        for (; (i + 16) <= stride; i += 16)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(row + i));
+            __m128i a = _mm_loadu_si128((const __m128i *)(row + i - bpp));
+            __m128i b = _mm_loadu_si128((const __m128i *)(up + i));
+            __m128i c = _mm_loadu_si128((const __m128i *)(up + i - bpp));
+            __m128i filtered[5] = {
+                x, FilterPNGBytesSSE2(1, x, a, b, c), FilterPNGBytesSSE2(2, x, a, b, c),
+                FilterPNGBytesSSE2(3, x, a, b, c), FilterPNGBytesSSE2(4, x, a, b, c)
+            };
+
+            for (int f = 0; f < 5; f++) totals[f] = _mm_add_epi64(totals[f], _mm_sad_epu8(_mm_min_epu8(filtered[f], _mm_sub_epi8(zero, filtered[f])), zero));
+        }
+
+        for (int f = 0; f < 5; f++) sums[f] += _mm_cvtsi128_si32(totals[f]) + _mm_cvtsi128_si32(_mm_srli_si128(totals[f], 8));
+    #endif
+
+        for (int k = i; k < stride; k++)
+        {
+            for (int f = 0; f < 5; f++) sums[f] += abs((signed char)FilterPNGByte(f, row[k], row[k - bpp], up[k], up[k - bpp]));
+        }
+
+        int filter = 0;
+        for (int f = 1; f < 5; f++) if (sums[f] < sums[filter]) filter = f;
+
+        output[0] = (unsigned char)filter;
+        output++;
+
+        for (int k = 0; k < bpp; k++) output[k] = FilterPNGByte(filter, row[k], 0, up[k], 0);
+
+        i = bpp;
+    #if defined(RL_TEXTURES_SIMD_SSE2)
+        for (; (i + 16) <= stride; i += 16)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(row + i));
+            __m128i a = _mm_loadu_si128((const __m128i *)(row + i - bpp));
+            __m128i b = _mm_loadu_si128((const __m128i *)(up + i));
+            __m128i c = _mm_loadu_si128((const __m128i *)(up + i - bpp));
+
+            _mm_storeu_si128((__m128i *)(output + i), FilterPNGBytesSSE2(filter, x, a, b, c));
+        }
+    #endif
+        for (; i < stride; i++) output[i] = FilterPNGByte(filter, row[i], row[i - bpp], up[i], up[i - bpp]);
+    }
+
+    RL_FREE(zeros);
+}
+
+// Set PNG chunk length, type and CRC, chunk data must be already set (after length and type)
+static void PutChunkPNG(unsigned char *output, const char *type, int size)
+{
+    output[0] = (unsigned char)(size >> 24);
+    output[1] = (unsigned char)(size >> 16);
+    output[2] = (unsigned char)(size >> 8);
+    output[3] = (unsigned char)size;
+    memcpy(output + 4, type, 4);
+
+    unsigned int crc = stbiw__crc32(output + 4, size + 4);
+    output[size + 8] = (unsigned char)(crc >> 24);
+    output[size + 9] = (unsigned char)(crc >> 16);
+    output[size + 10] = (unsigned char)(crc >> 8);
+    output[size + 11] = (unsigned char)crc;
+}
+
+// Write deflate bits, up to 16 bits per call
+static inline void PutDeflateBits(DeflateWriter *writer, unsigned int value, int count)
+{
+    writer->bits |= (unsigned long long)value << writer->count;
+    writer->count += count;
+
+    if (writer->count >= 32)
+    {
+        writer->output[writer->size] = (unsigned char)writer->bits;
+        writer->output[writer->size + 1] = (unsigned char)(writer->bits >> 8);
+        writer->output[writer->size + 2] = (unsigned char)(writer->bits >> 16);
+        writer->output[writer->size + 3] = (unsigned char)(writer->bits >> 24);
+        writer->size += 4;
+        writer->bits >>= 32;
+        writer->count -= 32;
+    }
+}
+
+// Get deflate hash of 4 bytes, matches shorter than 4 bytes are not searched
+static inline unsigned int GetDeflateHash(const unsigned char *data)
+{
+    return ((((unsigned int)data[0] << 24) | ((unsigned int)data[1] << 16) | ((unsigned int)data[2] << 8) | data[3])*2654435761u) >> (32 - DEFLATE_HASH_BITS);
+}
+
+// Find longest previous match for data at position, returns match length (0 if no match of at least 4 bytes)
+// NOTE: Hash chains store absolute positions, prev is indexed by position relative to base
+static int FindDeflateMatch(const unsigned char *data, const int *head, const int *prev, int base, int position, int maxLength, int *distance)
+{
+    if (maxLength < 4) return 0;
+    if (maxLength > 258) maxLength = 258;
+
+    int best = 0;
+    int limit = position - INFLATE_WINDOW_SIZE;
+    int candidate = head[GetDeflateHash(data + position)];
+
+    for (int chain = 0; (chain < DEFLATE_MAX_CHAIN) && (candidate >= 0) && (candidate >= limit); chain++)
+    {
+        // Check byte after current best match first, most candidates fail there
+        if (data[candidate + best] == data[position + best])
+        {
+            int length = 0;
+            while ((length < maxLength) && (data[candidate + length] == data[position + length])) length++;
+
+            if (length > best)
+            {
+                best = length;
+                *distance = position - candidate;
+
+                if ((best >= DEFLATE_NICE_LENGTH) || (best == maxLength)) break;
+            }
+        }
+
+        candidate = prev[candidate - base];
+    }
+
+    return (best >= 4)? best : 0;
+}
+
+// Compress PNG filtered data chunks range, required by EncodeImagePNG()
+// NOTE: Every chunk is a fixed Huffman codes block (lazy matching, same as stb_image_write),
+// or stored blocks if data is not compressible, output is a complete IDAT chunk (zlib header included
+// on first chunk), chunk Adler-32 checksum is also computed
+static void CompressChunksPNGRange(void *data, int start, int end)
+{
+    PngEncoder *encoder = (PngEncoder *)data;
+    const unsigned char *input = encoder->filtered;
+    int inputSize = encoder->filteredSize;
+    int *head = (int *)RL_MALLOC((1 << DEFLATE_HASH_BITS)*sizeof(int));
+    int *prev = (int *)RL_MALLOC((INFLATE_WINDOW_SIZE + PNG_DEFLATE_CHUNK_SIZE)*sizeof(int));
+
+    #define INSERT_POSITION(pos) do { if (((pos) + 4) <= inputSize) { unsigned int h = GetDeflateHash(input + (pos)); prev[(pos) - base] = head[h]; head[h] = (pos); } } while (0)
+
+    for (int chunk = start; chunk < end; chunk++)
+    {
+        int chunkStart = chunk*PNG_DEFLATE_CHUNK_SIZE;
+        int chunkEnd = ((chunkStart + PNG_DEFLATE_CHUNK_SIZE) < inputSize)? (chunkStart + PNG_DEFLATE_CHUNK_SIZE) : inputSize;
+        int chunkSize = chunkEnd - chunkStart;
+        int base = (chunkStart > INFLATE_WINDOW_SIZE)? (chunkStart - INFLATE_WINDOW_SIZE) : 0;
+        bool last = (chunk == (encoder->chunkCount - 1));
+
+        for (int i = 0; i < (1 << DEFLATE_HASH_BITS); i++) head[i] = -1;
+
+        // Previous chunk window is available for matches
+        for (int i = base; i < chunkStart; i++) INSERT_POSITION(i);
+
+        // NOTE: IDAT chunk length and type (8 bytes) and zlib header (2 bytes) are set before data
+        int dataStart = (chunk == 0)? 10 : 8;
+        bool stored = false;
+        DeflateWriter writer = { 0 };
+        writer.output = (unsigned char *)RL_MALLOC(dataStart + chunkSize + chunkSize/8 + 64 + 4);
+        writer.output[8] = 0x78;            // Deflate, 32K window
+        writer.output[9] = 0x01;            // Fastest compression level
+        writer.size = dataStart;
+
+        PutDeflateBits(&writer, last? 1 : 0, 1);    // Final block
+        PutDeflateBits(&writer, 1, 2);              // Fixed Huffman codes
+
+        for (int i = chunkStart; (i < chunkEnd) && !stored;)
+        {
+            int distance = 0;
+            int length = FindDeflateMatch(input, head, prev, base, i, chunkEnd - i, &distance);
+
+            INSERT_POSITION(i);
+
+            // Lazy matching: current byte is written as literal if next position match is longer
+            if ((length > 0) && (length < DEFLATE_NICE_LENGTH))
+            {
+                int nextDistance = 0;
+                if (FindDeflateMatch(input, head, prev, base, i + 1, chunkEnd - i - 1, &nextDistance) > length) length = 0;
+            }
+
+            if (length > 0)
+            {
+                int symbol = encoder->lengthSymbols[length];
+                PutDeflateBits(&writer, encoder->codes[257 + symbol], encoder->codeLengths[257 + symbol]);
+                if (deflateLengthExtra[symbol] > 0) PutDeflateBits(&writer, length - deflateLengthBase[symbol], deflateLengthExtra[symbol]);
+
+                symbol = encoder->distanceSymbols[(distance <= 256)? (distance - 1) : (256 + ((distance - 1) >> 7))];
+                PutDeflateBits(&writer, encoder->distanceCodes[symbol], 5);
+                if (deflateDistanceExtra[symbol] > 0) PutDeflateBits(&writer, distance - deflateDistanceBase[symbol], deflateDistanceExtra[symbol]);
+
+                for (int k = 1; k < length; k++) INSERT_POSITION(i + k);
+                i += length;
+            }
+            else
+            {
+                PutDeflateBits(&writer, encoder->codes[input[i]], encoder->codeLengths[input[i]]);
+                i++;
+            }
+
+            // NOTE: Compression is stopped if first 16KB of chunk data are not compressed
+            if (((i - chunkStart) >= 16384) && ((i - chunkStart) < (16384 + 258)) && ((writer.size - dataStart) >= (i - chunkStart))) stored = true;
+        }
+
+        if (!stored)
+        {
+            PutDeflateBits(&writer, encoder->codes[256], encoder->codeLengths[256]);   // End of block
+
+            // Sync flush: empty stored block header, next chunk starts on byte boundary
+            if (!last) PutDeflateBits(&writer, 0, 3);
+
+            while (writer.count > 0)
+            {
+                writer.output[writer.size++] = (unsigned char)writer.bits;
+                writer.bits >>= 8;
+                writer.count -= 8;
+            }
+
+            if (!last)
+            {
+                memcpy(writer.output + writer.size, "\x00\x00\xff\xff", 4);
+                writer.size += 4;
+            }
+
+            // Store data uncompressed if compression is not effective
+            if ((writer.size - dataStart) > (chunkSize + 5*((chunkSize + 65534)/65535))) stored = true;
+        }
+
+        if (stored)
+        {
+            writer.size = dataStart;
+
+            for (int i = chunkStart; i < chunkEnd; i += 65535)
+            {
+                int blockSize = ((chunkEnd - i) < 65535)? (chunkEnd - i) : 65535;
+
+                writer.output[writer.size] = (last && ((i + blockSize) == chunkEnd))? 1 : 0;
+                writer.output[writer.size + 1] = (unsigned char)blockSize;
+                writer.output[writer.size + 2] = (unsigned char)(blockSize >> 8);
+                writer.output[writer.size + 3] = (unsigned char)~blockSize;
+                writer.output[writer.size + 4] = (unsigned char)(~blockSize >> 8);
+                memcpy(writer.output + writer.size + 5, input + i, blockSize);
+                writer.size += 5 + blockSize;
+            }
+        }
+
+        PutChunkPNG(writer.output, "IDAT", writer.size - 8);
+
+        encoder->chunks[chunk] = writer.output;
+        encoder->chunkSizes[chunk] = writer.size + 4;
+
+        // Chunk data Adler-32 checksum
+        unsigned int sum1 = 1;
+        unsigned int sum2 = 0;
+
+        for (int i = chunkStart; i < chunkEnd;)
+        {
+            int blockEnd = ((i + 5552) < chunkEnd)? (i + 5552) : chunkEnd;
+
+            for (; i < blockEnd; i++)
+            {
+                sum1 += input[i];
+                sum2 += sum1;
+            }
+
+            sum1 %= 65521;
+            sum2 %= 65521;
+        }
+
+        encoder->chunkAdlers[chunk] = (sum2 << 16) | sum1;
+    }
+
+    #undef INSERT_POSITION
+
+    RL_FREE(head);
+    RL_FREE(prev);
+}
+#endif
+
+// Get data size of all mipmap levels (in bytes)
+static int GetMipmapsDataSize(int width, int height, int format, int mipmaps)
+{
+    int size = 0;
+
+    for (int i = 0; i < mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, format);
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    return size;
+}
+
+// Get mipmaps generation settings key, textures loaded with different settings are cached separately
+// NOTE: Settings are not relevant when generation is disabled, key is 0 in that case
+static unsigned long long GetMipmapsConfigKey(MipmapsConfig config)
+{
+    unsigned long long key = 0;
+
+    if (config.enabled)
+    {
+        unsigned int cutoffBits = 0;
+        memcpy(&cutoffBits, &config.alphaCutoff, sizeof(unsigned int));
+
+        key = 1ULL | ((config.srgb? 1ULL : 0ULL) << 1) | ((unsigned long long)(config.filter & 0xff) << 8) | ((unsigned long long)cutoffBits << 32);
+    }
+
+    return key;
+}
+
+// Unload cached image, required by resources cache
+static void UnloadImageResource(void *resource)
+{
+    UnloadImage(*(Image *)resource);
+}
+
+// Unload cached texture, required by resources cache
+static void UnloadTextureResource(void *resource)
+{
+    UnloadTexture(*(Texture2D *)resource);
+}
+
+// Get oldest texture async request in required state, requests being decoded or already notified are skipped
+static TextureRequest *GetNextTextureRequest(int state)
+{
+    TextureRequest *next = NULL;
+
+    for (int i = 0; i < MAX_TEXTURE_ASYNC_REQUESTS; i++)
+    {
+        TextureRequest *request = &textureLoader.requests[i];
+
+        if ((request->state == state) && !request->decoding && !request->cancelled && !request->notified &&
+            ((next == NULL) || ((int)(request->sequence - next->sequence) < 0))) next = request;
+    }
+
+    return next;
+}
+
+// Decode texture async request image
+// NOTE: Mutex must be locked, it is released while loading image file
+static void DecodeTextureRequest(TextureRequest *request)
+{
+    request->decoding = true;
+    UnlockThreadMutex(&textureLoader.mutex);
+
+    Image image = LoadImage(request->fileName);
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    // NOTE: Request settings are not modified while decoding
+    MipmapsConfig mipmaps = request->mipmaps;
+
+    if ((image.data != NULL) && mipmaps.enabled && (image.mipmaps == 1) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        ImageMipmapsEx(&image, mipmaps.filter, mipmaps.srgb, mipmaps.alphaCutoff);
+    }
+#endif
+
+    LockThreadMutex(&textureLoader.mutex);
+    request->decoding = false;
+
+    if (request->cancelled)
+    {
+        // Request unloaded while decoding
+        UnloadImage(image);
+        RL_FREE(request->fileName);
+        memset(request, 0, sizeof(TextureRequest));
+    }
+    else if (image.data != NULL)
+    {
+        request->image = image;
+        request->texture.width = image.width;
+        request->texture.height = image.height;
+        request->texture.mipmaps = image.mipmaps;
+        request->texture.format = image.format;
+        request->state = TEXTURE_ASYNC_UPLOADING;
+    }
+    else request->state = TEXTURE_ASYNC_FAILED;
+}
+
+// Upload next texture async request data step to GPU, returns true when finished (uploaded or failed)
+// NOTE: Uncompressed single level textures are allocated empty and filled by rows bands,
+// compressed or mipmapped textures are uploaded at once
+static bool UploadTextureRequest(TextureRequest *request)
+{
+    Image *image = &request->image;
+
+    if (request->texture.id == 0)
+    {
+        bool bands = (image->mipmaps == 1) && (image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+                     (GetPixelDataSize(image->width, image->height, image->format) > TEXTURE_ASYNC_UPLOAD_BAND_SIZE);
+
+        request->texture.id = rlLoadTexture(bands? NULL : image->data, image->width, image->height, image->format, image->mipmaps);
+        if (!bands) request->uploadedRows = image->height;
+    }
+    else
+    {
+        int rowSize = GetPixelDataSize(image->width, 1, image->format);
+        int rows = TEXTURE_ASYNC_UPLOAD_BAND_SIZE/rowSize;
+
+        if (rows < 1) rows = 1;
+        if (rows > (image->height - request->uploadedRows)) rows = image->height - request->uploadedRows;
+
+        rlUpdateTexture(request->texture.id, 0, request->uploadedRows, image->width, rows, image->format, (unsigned char *)image->data + request->uploadedRows*rowSize);
+        request->uploadedRows += rows;
+    }
+
+    bool finished = ((request->texture.id == 0) || (request->uploadedRows >= image->height));
+
+    if (finished)
+    {
+        UnloadImage(*image);
+        request->image = (Image){ 0 };
+
+        if (request->texture.id == 0) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to upload texture", request->fileName);
+    }
+
+    return finished;
+}
+
+// Texture loader thread, decodes requests images first in, first out
+static void TextureLoaderThread(void *data)
+{
+    LockThreadMutex(&textureLoader.mutex);
+
+    while (!textureLoader.quit)
+    {
+        TextureRequest *request = GetNextTextureRequest(TEXTURE_ASYNC_LOADING);
+
+        if (request != NULL) DecodeTextureRequest(request);
+        else WaitThreadCondition(&textureLoader.requestReady, &textureLoader.mutex);
+    }
+
+    UnlockThreadMutex(&textureLoader.mutex);
+}
+
+// Get image export file format from file name extension
+// NOTE: Not reentrant (IsFileExtension() uses static buffers), call it on calling thread
+static int GetImageExportFormat(const char *fileName)
+{
+    int format = IMAGE_EXPORT_NONE;
+
+    if (IsFileExtension(fileName, ".png")) format = IMAGE_EXPORT_PNG;
+    else if (IsFileExtension(fileName, ".bmp")) format = IMAGE_EXPORT_BMP;
+    else if (IsFileExtension(fileName, ".tga")) format = IMAGE_EXPORT_TGA;
+    else if (IsFileExtension(fileName, ".jpg;.jpeg")) format = IMAGE_EXPORT_JPG;
+    else if (IsFileExtension(fileName, ".qoi")) format = IMAGE_EXPORT_QOI;
+    else if (IsFileExtension(fileName, ".dds")) format = IMAGE_EXPORT_DDS;
+    else if (IsFileExtension(fileName, ".ktx")) format = IMAGE_EXPORT_KTX;
+    else if (IsFileExtension(fileName, ".raw")) format = IMAGE_EXPORT_RAW;
+
+    return format;
+}
+
+// Export image data to file in provided file format
+// NOTE: Reentrant, used by exporter thread (file format resolved on calling thread)
+static bool ExportImageFormat(Image image, const char *fileName, int format)
+{
+    int result = 0;
+
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return result;
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+    int channels = 4;
+    bool allocatedData = false;
+    unsigned char *imgData = (unsigned char *)image.data;
+
+    // NOTE: GPU texture files and raw data store image data as is (compressed data and mipmaps included)
+    bool exportData = (format == IMAGE_EXPORT_KTX) || (format == IMAGE_EXPORT_RAW) || ((format == IMAGE_EXPORT_DDS) &&
+        (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (image.format <= PIXELFORMAT_COMPRESSED_DXT5_RGBA));
+
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+    else if (!exportData)
+    {
+        // NOTE: Getting Color array as RGBA unsigned char values
+        imgData = (unsigned char *)LoadImageColors(image);
+        allocatedData = true;
+    }
+
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (format == IMAGE_EXPORT_PNG)
+    {
+        int dataSize = 0;
+        unsigned char *fileData = EncodeImagePNG(imgData, image.width, image.height, channels, &dataSize);
+        result = SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
+    }
+#else
+    if (false) { }
+#endif
+#if defined(SUPPORT_FILEFORMAT_BMP)
+    else if (format == IMAGE_EXPORT_BMP) result = stbi_write_bmp(fileName, image.width, image.height, channels, imgData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_TGA)
+    else if (format == IMAGE_EXPORT_TGA) result = stbi_write_tga(fileName, image.width, image.height, channels, imgData);
+#endif
+#if defined(SUPPORT_FILEFORMAT_JPG)
+    else if (format == IMAGE_EXPORT_JPG) result = stbi_write_jpg(fileName, image.width, image.height, channels, imgData, 90);  // JPG quality: between 1 and 100
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    else if (format == IMAGE_EXPORT_QOI)
+    {
+        channels = 0;
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+        else TRACELOG(LOG_WARNING, "IMAGE: Image pixel format must be R8G8B8 or R8G8B8A8");
+
+        if ((channels == 3) || (channels == 4))
+        {
+            qoi_desc desc = { 0 };
+            desc.width = image.width;
+            desc.height = image.height;
+            desc.channels = channels;
+            desc.colorspace = QOI_SRGB;
+
+            result = qoi_write(fileName, imgData, &desc);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (format == IMAGE_EXPORT_DDS)
+    {
+        // NOTE: DXT compressed and 24/32 bit formats are saved as is (mipmaps included),
+        // other formats are saved as R8G8B8A8 (first mipmap level)
+        if ((image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || exportData) result = rl_save_dds(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+        else if (allocatedData) result = rl_save_dds(fileName, imgData, image.width, image.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        else TRACELOG(LOG_WARNING, "IMAGE: Grayscale pixel formats not supported for DDS export");
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    else if (format == IMAGE_EXPORT_KTX)
+    {
+        result = rl_save_ktx(fileName, image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+#endif
+    else if (format == IMAGE_EXPORT_RAW)
+    {
+        // Export raw pixel data (without header)
+        // NOTE: It's up to the user to track image parameters
+        result = SaveFileData(fileName, image.data, GetPixelDataSize(image.width, image.height, image.format));
+    }
+
+    if (allocatedData) RL_FREE(imgData);
+#endif      // SUPPORT_IMAGE_EXPORT
+
+    if (result != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", fileName);
+
+    return result;
+}
+
+// Image exporter thread, exports requests first in, first out (pending requests are exported before quitting)
+static void ImageExporterThread(void *data)
+{
+    LockThreadMutex(&imageExporter.mutex);
+
+    while (true)
+    {
+        if (imageExporter.count > 0)
+        {
+            ExportRequest request = imageExporter.requests[imageExporter.first];
+            UnlockThreadMutex(&imageExporter.mutex);
+
+            ExportImageFormat(request.image, request.fileName, request.format);
+            UnloadImage(request.image);
+            RL_FREE(request.fileName);
+
+            LockThreadMutex(&imageExporter.mutex);
+            imageExporter.first = (imageExporter.first + 1)%MAX_IMAGE_EXPORT_REQUESTS;
+            imageExporter.count--;
+            BroadcastThreadCondition(&imageExporter.requestDone);
+        }
+        else if (imageExporter.quit) break;
+        else WaitThreadCondition(&imageExporter.requestReady, &imageExporter.mutex);
+    }
+
+    UnlockThreadMutex(&imageExporter.mutex);
+}
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Load animated GIF stream, file data ownership is transferred (required while animation is loaded)
+// NOTE: First frame is decoded on calling thread, following frames are decoded ahead of time by decoder thread
+static ImageAnim LoadAnimGIF(unsigned char *fileData, int dataSize)
+{
+    ImageAnim anim = { 0 };
+    bool disposePrevious = false;
+    int frameCount = 0;
+    int *frameDelays = ScanFramesGIF(fileData, dataSize, &frameCount, &disposePrevious);
+
+    if (frameDelays == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to load animated GIF data");
+        RL_FREE(fileData);
+        return anim;
+    }
+
+    AnimDecoder *decoder = (AnimDecoder *)RL_CALLOC(1, sizeof(AnimDecoder));
+    decoder->fileData = fileData;
+    decoder->dataSize = dataSize;
+    decoder->gif = (stbi__gif *)RL_CALLOC(1, sizeof(stbi__gif));
+    decoder->frameCount = frameCount;
+    decoder->frameStarts = (int *)RL_MALLOC((frameCount + 1)*sizeof(int));
+    decoder->seekIndex = -1;
+
+    decoder->frameStarts[0] = 0;
+    for (int i = 0; i < frameCount; i++) decoder->frameStarts[i + 1] = decoder->frameStarts[i] + frameDelays[i];
+
+    InitThreadMutex(&decoder->mutex);
+    InitThreadCondition(&decoder->frameChange);
+
+    RewindAnimDecoder(decoder);
+
+    if (DecodeAnimFrame(decoder))
+    {
+        decoder->frameSize = decoder->gif->w*decoder->gif->h*4;
+
+        anim.image.data = RL_MALLOC(decoder->frameSize);
+        anim.image.width = decoder->gif->w;
+        anim.image.height = decoder->gif->h;
+        anim.image.mipmaps = 1;
+        anim.image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        memcpy(anim.image.data, decoder->gif->out, decoder->frameSize);
+
+        anim.frameCount = frameCount;
+        anim.frameDelays = frameDelays;
+        anim.duration = (float)decoder->frameStarts[frameCount]/1000.0f;
+        anim.ctxData = decoder;
+
+        if (disposePrevious)
+        {
+            decoder->history[0] = (unsigned char *)RL_MALLOC(decoder->frameSize);
+            decoder->history[1] = (unsigned char *)RL_MALLOC(decoder->frameSize);
+        }
+
+    #if defined(WORKER_THREADS_AVAILABLE)
+        if (frameCount > 1)
+        {
+            for (int i = 0; i < MAX_ANIM_DECODED_FRAMES; i++) decoder->frames[i].data = (unsigned char *)RL_MALLOC(decoder->frameSize);
+
+            decoder->started = StartThread(&decoder->thread, AnimDecoderThread, decoder);
+
+            if (!decoder->started) TRACELOG(LOG_WARNING, "IMAGE: Failed to start animation decoder thread, frames decoded on demand");
+        }
+    #endif
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to decode animated GIF first frame");
+        RL_FREE(frameDelays);
+        UnloadImageAnim((ImageAnim){ .ctxData = decoder });
+    }
+
+    return anim;
+}
+
+// Get GIF frames delay without decoding frames data (milliseconds)
+// NOTE: Only GIF blocks structure is parsed, frame delays of 10 ms or less are set to 100 ms (same as web browsers)
+static int *ScanFramesGIF(const unsigned char *data, int dataSize, int *frameCount, bool *disposePrevious)
+{
+    if ((dataSize < 13) || (memcmp(data, "GIF", 3) != 0)) return NULL;
+
+    int capacity = 16;
+    int *delays = (int *)RL_MALLOC(capacity*sizeof(int));
+    int count = 0;
+    int delay = 0;
+    int position = 13;
+
+    if (data[10] & 0x80) position += 3*(2 << (data[10] & 7));   // Global color table
+
+    while (position < dataSize)
+    {
+        int tag = data[position++];
+
+        if (tag == 0x2c)        // Image descriptor
+        {
+            if ((position + 9) > dataSize) break;
+
+            int flags = data[position + 8];
+            position += 9;
+            if (flags & 0x80) position += 3*(2 << (flags & 7));     // Local color table
+            position++;         // LZW minimum code size
+        }
+        else if (tag == 0x21)   // Extension
+        {
+            if (position >= dataSize) break;
+
+            int label = data[position++];
+
+            // NOTE: Delay is kept for next frames if not provided again (same as stb_image)
+            if ((label == 0xf9) && ((position + 5) <= dataSize) && (data[position] == 4))
+            {
+                delay = 10*(data[position + 2] | (data[position + 3] << 8));
+                if (((data[position + 1] >> 2) & 7) == 3) *disposePrevious = true;
+            }
+        }
+        else break;             // Trailer (or corrupted data)
+
+        // Skip data sub-blocks
+        while ((position < dataSize) && (data[position] != 0)) position += data[position] + 1;
+        position++;
+
+        if (position > dataSize) break;     // Truncated frame
+
+        if (tag == 0x2c)
+        {
+            if (count == capacity)
+            {
+                capacity *= 2;
+                delays = (int *)RL_REALLOC(delays, capacity*sizeof(int));
+            }
+
+            delays[count++] = (delay <= 10)? 100 : delay;
+        }
+    }
+
+    if (count == 0)
+    {
+        RL_FREE(delays);
+        return NULL;
+    }
+
+    *frameCount = count;
+    return delays;
+}
+
+// Restart GIF decoding from first frame
+static void RewindAnimDecoder(AnimDecoder *decoder)
+{
+    RL_FREE(decoder->gif->out);
+    RL_FREE(decoder->gif->background);
+    RL_FREE(decoder->gif->history);
+    memset(decoder->gif, 0, sizeof(stbi__gif));
+
+    stbi__start_mem(&decoder->context, decoder->fileData, decoder->dataSize);
+    decoder->nextIndex = 0;
+}
+
+// Decode next GIF frame into decoder canvas (gif->out), decoding is restarted after last frame
+// NOTE: Frames disposed to previous require canvas from two frames back, kept only if required
+static bool DecodeAnimFrame(AnimDecoder *decoder)
+{
+    if (decoder->nextIndex >= decoder->frameCount) RewindAnimDecoder(decoder);
+
+    unsigned char *twoBack = NULL;
+
+    if ((decoder->history[0] != NULL) && (decoder->nextIndex > 0))
+    {
+        memcpy(decoder->history[1], decoder->gif->out, decoder->frameSize);    // Previous frame canvas
+        if (decoder->nextIndex > 1) twoBack = decoder->history[0];
+    }
+
+    int comp = 0;
+    unsigned char *result = stbi__gif_load_next(&decoder->context, decoder->gif, &comp, 4, twoBack);
+
+    if (decoder->history[0] != NULL)
+    {
+        unsigned char *previous = decoder->history[0];
+        decoder->history[0] = decoder->history[1];
+        decoder->history[1] = previous;
+    }
+
+    // NOTE: End of stream marker (context address) is not expected, frames were counted on loading
+    if ((result == NULL) || (result == (unsigned char *)&decoder->context)) return false;
+
+    decoder->nextIndex++;
+
+    return true;
+}
+
+// Read decoded frame, frames decoded before required one are skipped
+// NOTE: Going back requires decoding from first frame
+static bool ReadAnimFrame(AnimDecoder *decoder, int index, unsigned char *output)
+{
+    bool success = false;
+
+    if (decoder->started)
+    {
+        LockThreadMutex(&decoder->mutex);
+
+        while (true)
+        {
+            while ((decoder->count > 0) && (decoder->frames[decoder->first].index != index))
+            {
+                decoder->first = (decoder->first + 1)%MAX_ANIM_DECODED_FRAMES;
+                decoder->count--;
+            }
+
+            if (decoder->count > 0)
+            {
+                memcpy(output, decoder->frames[decoder->first].data, decoder->frameSize);
+                decoder->first = (decoder->first + 1)%MAX_ANIM_DECODED_FRAMES;
+                decoder->count--;
+                success = true;
+                break;
+            }
+
+            if (decoder->error) break;
+
+            // Frame not decoded yet, wait for decoder thread
+            decoder->seekIndex = index;
+            BroadcastThreadCondition(&decoder->frameChange);
+            WaitThreadCondition(&decoder->frameChange, &decoder->mutex);
+        }
+
+        BroadcastThreadCondition(&decoder->frameChange);    // Queue slots available
+        UnlockThreadMutex(&decoder->mutex);
+    }
+    else if (!decoder->error)
+    {
+        if (index < (decoder->nextIndex - 1)) RewindAnimDecoder(decoder);
+
+        success = true;
+        while (success && ((decoder->nextIndex - 1) != index)) success = DecodeAnimFrame(decoder);
+
+        if (success) memcpy(output, decoder->gif->out, decoder->frameSize);
+        else decoder->error = true;
+    }
+
+    return success;
+}
+
+// Animation decoder thread, decodes frames in order (looped) while queue is not full
+// NOTE: If a frame is requested, frames decoded before are not queued (decoding restarts if requested frame was already decoded)
+static void AnimDecoderThread(void *data)
+{
+    AnimDecoder *decoder = (AnimDecoder *)data;
+
+    LockThreadMutex(&decoder->mutex);
+
+    while (!decoder->quit)
+    {
+        if ((decoder->seekIndex < 0) && (decoder->count == MAX_ANIM_DECODED_FRAMES))
+        {
+            WaitThreadCondition(&decoder->frameChange, &decoder->mutex);
+            continue;
+        }
+
+        if ((decoder->seekIndex >= 0) && (decoder->seekIndex < decoder->nextIndex)) RewindAnimDecoder(decoder);
+
+        int index = (decoder->nextIndex < decoder->frameCount)? decoder->nextIndex : 0;
+
+        UnlockThreadMutex(&decoder->mutex);
+        bool decoded = DecodeAnimFrame(decoder);
+        LockThreadMutex(&decoder->mutex);
+
+        if (!decoded)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to decode animated GIF frame %i", index);
+            decoder->error = true;
+            BroadcastThreadCondition(&decoder->frameChange);
+            break;
+        }
+
+        if (decoder->seekIndex >= 0)
+        {
+            if (decoder->seekIndex != index) continue;  // Frame skipped
+            decoder->seekIndex = -1;
+        }
+
+        // NOTE: Only decoder thread adds frames to queue, a slot is available
+        AnimFrame *frame = &decoder->frames[(decoder->first + decoder->count)%MAX_ANIM_DECODED_FRAMES];
+        memcpy(frame->data, decoder->gif->out, decoder->frameSize);
+        frame->index = index;
+        decoder->count++;
+
+        BroadcastThreadCondition(&decoder->frameChange);
+    }
+
+    UnlockThreadMutex(&decoder->mutex);
+}
+#endif
+
+// Resize 8 bit per channel pixels data (1 to 4 channels), output size must be newWidth*newHeight*channels
+// NOTE: Resize is split in several independent output regions, result does not depend on splits count
+static void ResizeImageData(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
+{
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels, STBIR_TYPE_UINT8);
+
+    int splits = ((newWidth*newHeight) >= IMAGE_JOB_MIN_PIXELS)? GetWorkerThreadCount() : 1;
+    splits = stbir_build_samplers_with_splits(&resize, splits);
+
+    if (splits > 0)
+    {
+        ParallelFor(splits, 1, ResizeImageRange, &resize);
+        stbir_free_samplers(&resize);
+    }
+    else stbir_resize_uint8_linear(input, width, height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)channels);
+}
+
+// Resize splits range, required by ResizeImageData()
+static void ResizeImageRange(void *data, int start, int end)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, start, end - start);
+}
+
+// Get compressed data size of one 4x4 pixels block for formats supported by block compression codec, 0 if not supported
+static int GetBlockDataSize(int format)
+{
+    int size = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: size = 8; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: size = 16; break;
+        default: break;
+    }
+
+    return size;
+}
+
+// Clamp integer value to byte range [0..255]
+static inline int ClampByte(int value)
+{
+    return (value < 0)? 0 : ((value > 255)? 255 : value);
+}
+
+// Get squared RGB distance between two colors
+static inline int GetColorDistance(Color color, const int *rgb)
+{
+    int dr = color.r - rgb[0];
+    int dg = color.g - rgb[1];
+    int db = color.b - rgb[2];
+
+    return dr*dr + dg*dg + db*db;
+}
+
+// Expand RGB565 color to RGB888 (bits replication)
+static inline void UnpackColor565(unsigned short color, int *rgb)
+{
+    int r = (color >> 11) & 0x1f;
+    int g = (color >> 5) & 0x3f;
+    int b = color & 0x1f;
+
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Get BC1 colors palette from endpoints, four colors mode or three colors mode (fourth color is black)
+static void GetPaletteBC1(unsigned short color0, unsigned short color1, bool fourColors, int palette[4][3])
+{
+    UnpackColor565(color0, palette[0]);
+    UnpackColor565(color1, palette[1]);
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (fourColors)
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+        else
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c])/2;
+            palette[3][c] = 0;
+        }
+    }
+}
+
+// Get BC1 endpoints error, every color is assigned to nearest palette color (index 3 not used in three colors mode)
+static int GetErrorBC1(const Color *colors, int count, unsigned short color0, unsigned short color1, bool fourColors, unsigned char *indices)
+{
+    int palette[4][3] = { 0 };
+    GetPaletteBC1(color0, color1, fourColors, palette);
+
+    int paletteCount = fourColors? 4 : 3;
+    int error = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int best = GetColorDistance(colors[i], palette[0]);
+        int index = 0;
+
+        for (int k = 1; k < paletteCount; k++)
+        {
+            int distance = GetColorDistance(colors[i], palette[k]);
+            if (distance < best) { best = distance; index = k; }
+        }
+
+        if (indices != NULL) indices[i] = (unsigned char)index;
+        error += best;
+    }
+
+    return error;
+}
+
+// Quantize RGB888 float color to RGB565
+static unsigned short PackColor565(const float *rgb)
+{
+    int r = (int)(rgb[0]*31.0f/255.0f + 0.5f);
+    int g = (int)(rgb[1]*63.0f/255.0f + 0.5f);
+    int b = (int)(rgb[2]*31.0f/255.0f + 0.5f);
+
+    r = (r < 0)? 0 : ((r > 31)? 31 : r);
+    g = (g < 0)? 0 : ((g > 63)? 63 : g);
+    b = (b < 0)? 0 : ((b > 31)? 31 : b);
+
+    return (unsigned short)((r << 11) | (g << 5) | b);
+}
+
+// Find BC1 endpoints for colors, returns endpoints error
+// NOTE: Endpoints are placed at colors extents along principal axis, then refined by least squares fitting
+// of current indices (COMPRESS_QUALITY_DEFAULT) and by single step endpoints search (COMPRESS_QUALITY_HIGH)
+static int FitEndpointsBC1(const Color *colors, int count, bool fourColors, int quality, unsigned short *color0, unsigned short *color1)
+{
+    float mean[3] = { 0 };
+    for (int i = 0; i < count; i++) { mean[0] += colors[i].r; mean[1] += colors[i].g; mean[2] += colors[i].b; }
+    for (int c = 0; c < 3; c++) mean[c] /= count;
+
+    // Covariance matrix: rr, rg, rb, gg, gb, bb
+    float cov[6] = { 0 };
+    for (int i = 0; i < count; i++)
+    {
+        float r = colors[i].r - mean[0];
+        float g = colors[i].g - mean[1];
+        float b = colors[i].b - mean[2];
+
+        cov[0] += r*r; cov[1] += r*g; cov[2] += r*b;
+        cov[3] += g*g; cov[4] += g*b; cov[5] += b*b;
+    }
+
+    unsigned short best0 = PackColor565(mean);
+    unsigned short best1 = best0;
+    int bestError = 0;
+
+    if ((cov[0] + cov[3] + cov[5]) < 1.0f)
+    {
+        // Single color block: endpoints are searched per channel to get the color interpolated exactly
+        // NOTE: Interpolated palette entry can match colors not representable in RGB565
+        bestError = GetErrorBC1(colors, count, best0, best1, fourColors, NULL);
+
+        if ((quality != COMPRESS_QUALITY_FAST) && (bestError > 0))
+        {
+            int value[3] = { colors[0].r, colors[0].g, colors[0].b };
+            int bits[3] = { 5, 6, 5 };
+            int endpoint0 = 0, endpoint1 = 0;
+
+            for (int c = 0; c < 3; c++)
+            {
+                int max = (1 << bits[c]) - 1;
+                int bestDistance = 256;
+                int best[2] = { 0 };
+
+                for (int e0 = 0; e0 <= max; e0++)
+                {
+                    int x0 = (e0 << (8 - bits[c])) | (e0 >> (2*bits[c] - 8));
+
+                    for (int e1 = 0; e1 <= max; e1++)
+                    {
+                        int x1 = (e1 << (8 - bits[c])) | (e1 >> (2*bits[c] - 8));
+                        int interpolated = fourColors? (2*x0 + x1)/3 : (x0 + x1)/2;
+                        int distance = abs(interpolated - value[c]);
+
+                        if (distance < bestDistance) { bestDistance = distance; best[0] = e0; best[1] = e1; }
+                    }
+                }
+
+                int shift = (c == 0)? 11 : ((c == 1)? 5 : 0);
+                endpoint0 |= best[0] << shift;
+                endpoint1 |= best[1] << shift;
+            }
+
+            int error = GetErrorBC1(colors, count, (unsigned short)endpoint0, (unsigned short)endpoint1, fourColors, NULL);
+            if (error < bestError) { bestError = error; best0 = (unsigned short)endpoint0; best1 = (unsigned short)endpoint1; }
+        }
+
+        *color0 = best0;
+        *color1 = best1;
+
+        return bestError;
+    }
+
+    // Principal axis by power iteration, starting from covariance matrix row with bigger variance
+    float axis[3] = { cov[0], cov[1], cov[2] };
+    if ((cov[3] >= cov[0]) && (cov[3] >= cov[5])) { axis[0] = cov[1]; axis[1] = cov[3]; axis[2] = cov[4]; }
+    else if ((cov[5] >= cov[0]) && (cov[5] >= cov[3])) { axis[0] = cov[2]; axis[1] = cov[4]; axis[2] = cov[5]; }
+
+    for (int k = 0; k < 8; k++)
+    {
+        float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+        float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+        float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+        float length = sqrtf(x*x + y*y + z*z);
+
+        if (length < 1e-6f) break;
+
+        axis[0] = x/length; axis[1] = y/length; axis[2] = z/length;
+    }
+
+    float length = sqrtf(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+    if (length < 1e-6f) { axis[0] = 1.0f; axis[1] = 1.0f; axis[2] = 1.0f; length = sqrtf(3.0f); }
+    for (int c = 0; c < 3; c++) axis[c] /= length;
+
+    // Endpoints at colors extents projected on principal axis
+    float minProjection = 0.0f, maxProjection = 0.0f;
+    for (int i = 0; i < count; i++)
+    {
+        float projection = (colors[i].r - mean[0])*axis[0] + (colors[i].g - mean[1])*axis[1] + (colors[i].b - mean[2])*axis[2];
+
+        if (projection < minProjection) minProjection = projection;
+        if (projection > maxProjection) maxProjection = projection;
+    }
+
+    float endpoint0[3] = { 0 }, endpoint1[3] = { 0 };
+    for (int c = 0; c < 3; c++)
+    {
+        endpoint0[c] = mean[c] + axis[c]*maxProjection;
+        endpoint1[c] = mean[c] + axis[c]*minProjection;
+    }
+
+    unsigned char indices[16] = { 0 };
+    best0 = PackColor565(endpoint0);
+    best1 = PackColor565(endpoint1);
+    bestError = GetErrorBC1(colors, count, best0, best1, fourColors, indices);
+
+    // Least squares endpoints refinement for current indices
+    // NOTE: Palette weights of color0 by index: four colors mode { 1, 0, 2/3, 1/3 }, three colors mode { 1, 0, 1/2 }
+    int iterations = (quality == COMPRESS_QUALITY_HIGH)? 6 : ((quality == COMPRESS_QUALITY_DEFAULT)? 2 : 0);
+
+    for (int k = 0; (k < iterations) && (bestError > 0); k++)
+    {
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        float ax[3] = { 0 }, bx[3] = { 0 };
+
+        for (int i = 0; i < count; i++)
+        {
+            float weight = 0.0f;
+
+            if (indices[i] == 0) weight = 1.0f;
+            else if (indices[i] == 2) weight = fourColors? 2.0f/3.0f : 0.5f;
+            else if (indices[i] == 3) weight = 1.0f/3.0f;
+
+            float rgb[3] = { colors[i].r, colors[i].g, colors[i].b };
+
+            aa += weight*weight;
+            ab += weight*(1.0f - weight);
+            bb += (1.0f - weight)*(1.0f - weight);
+
+            for (int c = 0; c < 3; c++)
+            {
+                ax[c] += weight*rgb[c];
+                bx[c] += (1.0f - weight)*rgb[c];
+            }
+        }
+
+        float determinant = aa*bb - ab*ab;
+        if (fabsf(determinant) < 1e-6f) break;
+
+        for (int c = 0; c < 3; c++)
+        {
+            endpoint0[c] = (ax[c]*bb - bx[c]*ab)/determinant;
+            endpoint1[c] = (bx[c]*aa - ax[c]*ab)/determinant;
+        }
+
+        unsigned short refined0 = PackColor565(endpoint0);
+        unsigned short refined1 = PackColor565(endpoint1);
+        unsigned char refinedIndices[16] = { 0 };
+        int error = GetErrorBC1(colors, count, refined0, refined1, fourColors, refinedIndices);
+
+        if (error >= bestError) break;
+
+        bestError = error;
+        best0 = refined0;
+        best1 = refined1;
+        memcpy(indices, refinedIndices, 16);
+    }
+
+    // Endpoints search: every endpoint channel is moved by one step while error decreases
+    if (quality == COMPRESS_QUALITY_HIGH)
+    {
+        static const unsigned short channelMasks[3] = { 0xf800, 0x07e0, 0x001f };
+        static const unsigned short channelSteps[3] = { 0x0800, 0x0020, 0x0001 };
+        bool improved = true;
+
+        for (int pass = 0; (pass < 8) && improved && (bestError > 0); pass++)
+        {
+            improved = false;
+
+            for (int e = 0; e < 2; e++)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    for (int step = -1; step <= 1; step += 2)
+                    {
+                        unsigned short endpoint = (e == 0)? best0 : best1;
+                        int channel = endpoint & channelMasks[c];
+
+                        if ((step < 0) && (channel == 0)) continue;
+                        if ((step > 0) && (channel == channelMasks[c])) continue;
+
+                        endpoint = (unsigned short)((endpoint & ~channelMasks[c]) | (channel + step*channelSteps[c]));
+
+                        int error = (e == 0)? GetErrorBC1(colors, count, endpoint, best1, fourColors, NULL) :
+                                              GetErrorBC1(colors, count, best0, endpoint, fourColors, NULL);
+
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            if (e == 0) best0 = endpoint;
+                            else best1 = endpoint;
+                            improved = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    *color0 = best0;
+    *color1 = best1;
+
+    return bestError;
+}
+
+// Encode BC1 color block (8 bytes)
+// NOTE: If alpha is allowed and block has transparent pixels (alpha < 128), three colors mode is used
+static void EncodeBlockBC1(const Color *block, unsigned char *output, bool alpha, int quality)
+{
+    Color colors[16] = { 0 };
+    int count = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (!alpha || (block[i].a >= 128)) colors[count++] = block[i];
+    }
+
+    bool fourColors = (count == 16);
+    unsigned short color0 = 0;
+    unsigned short color1 = 0;
+
+    if (count > 0) FitEndpointsBC1(colors, count, fourColors, quality, &color0, &color1);
+
+    // Endpoints order selects palette mode: color0 > color1 for four colors, color0 <= color1 for three colors
+    if ((fourColors && (color0 < color1)) || (!fourColors && (color0 > color1)))
+    {
+        unsigned short temp = color0;
+        color0 = color1;
+        color1 = temp;
+    }
+
+    unsigned int indices = 0;
+
+    if (color0 != color1)
+    {
+        int palette[4][3] = { 0 };
+        GetPaletteBC1(color0, color1, fourColors, palette);
+
+        for (int i = 0; i < 16; i++)
+        {
+            int index = 3;
+
+            if (!alpha || (block[i].a >= 128))
+            {
+                int best = GetColorDistance(block[i], palette[0]);
+                index = 0;
+
+                for (int k = 1; k < (fourColors? 4 : 3); k++)
+                {
+                    int distance = GetColorDistance(block[i], palette[k]);
+                    if (distance < best) { best = distance; index = k; }
+                }
+            }
+
+            indices |= (unsigned int)index << (2*i);
+        }
+    }
+    else if (!fourColors)
+    {
+        // Equal endpoints: opaque pixels use color0, transparent pixels use index 3
+        for (int i = 0; i < 16; i++) if (block[i].a < 128) indices |= 3u << (2*i);
+    }
+
+    output[0] = (unsigned char)(color0 & 0xff);
+    output[1] = (unsigned char)(color0 >> 8);
+    output[2] = (unsigned char)(color1 & 0xff);
+    output[3] = (unsigned char)(color1 >> 8);
+    for (int i = 0; i < 4; i++) output[4 + i] = (unsigned char)(indices >> (8*i));
+}
+
+// Encode BC2 alpha block (8 bytes), explicit 4 bit alpha per pixel
+static void EncodeBlockBC2Alpha(const Color *block, unsigned char *output)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        int alpha0 = (block[2*i].a + 8)/17;
+        int alpha1 = (block[2*i + 1].a + 8)/17;
+
+        output[i] = (unsigned char)(alpha0 | (alpha1 << 4));
+    }
+}
+
+// Get BC3 alpha palette from endpoints, eight values mode if alpha0 > alpha1, otherwise six values plus 0 and 255
+static void GetPaletteBC3Alpha(int alpha0, int alpha1, int *palette)
+{
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+
+    if (alpha0 > alpha1)
+    {
+        for (int k = 2; k < 8; k++) palette[k] = (alpha0*(8 - k) + alpha1*(k - 1))/7;
+    }
+    else
+    {
+        for (int k = 2; k < 6; k++) palette[k] = (alpha0*(6 - k) + alpha1*(k - 1))/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Get BC3 alpha endpoints error, every pixel is assigned to nearest palette value
+static int GetErrorBC3Alpha(const Color *block, int alpha0, int alpha1, unsigned char *indices)
+{
+    int palette[8] = { 0 };
+    GetPaletteBC3Alpha(alpha0, alpha1, palette);
+
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int best = 256*256;
+
+        for (int k = 0; k < 8; k++)
+        {
+            int distance = (block[i].a - palette[k])*(block[i].a - palette[k]);
+            if (distance < best) { best = distance; if (indices != NULL) indices[i] = (unsigned char)k; }
+        }
+
+        error += best;
+    }
+
+    return error;
+}
+
+// Encode BC3 alpha block (8 bytes)
+// NOTE: Eight values mode uses alpha extents, six values mode is tried for blocks including 0 or 255 alpha
+// and endpoints around alpha extents are searched with COMPRESS_QUALITY_HIGH
+static void EncodeBlockBC3Alpha(const Color *block, unsigned char *output, int quality)
+{
+    int min = 255, max = 0;         // Alpha extents
+    int inner[2] = { 255, 0 };      // Alpha extents excluding 0 and 255
+
+    for (int i = 0; i < 16; i++)
+    {
+        int alpha = block[i].a;
+
+        if (alpha < min) min = alpha;
+        if (alpha > max) max = alpha;
+        if ((alpha > 0) && (alpha < 255))
+        {
+            if (alpha < inner[0]) inner[0] = alpha;
+            if (alpha > inner[1]) inner[1] = alpha;
+        }
+    }
+
+    int alpha0 = max;
+    int alpha1 = min;
+    int bestError = GetErrorBC3Alpha(block, alpha0, alpha1, NULL);
+
+    if ((quality != COMPRESS_QUALITY_FAST) && (bestError > 0))
+    {
+        if ((min == 0) || (max == 255))
+        {
+            if (inner[0] > inner[1]) inner[0] = inner[1] = 0;
+
+            int error = GetErrorBC3Alpha(block, inner[0], inner[1], NULL);
+            if (error < bestError) { bestError = error; alpha0 = inner[0]; alpha1 = inner[1]; }
+        }
+
+        if (quality == COMPRESS_QUALITY_HIGH)
+        {
+            for (int a0 = max; (a0 >= max - 4) && (bestError > 0); a0--)
+            {
+                for (int a1 = min; (a1 <= min + 4) && (a1 < a0); a1++)
+                {
+                    int error = GetErrorBC3Alpha(block, a0, a1, NULL);
+                    if (error < bestError) { bestError = error; alpha0 = a0; alpha1 = a1; }
+                }
+            }
+        }
+    }
+
+    unsigned char indices[16] = { 0 };
+    GetErrorBC3Alpha(block, alpha0, alpha1, indices);
+
+    unsigned long long bits = 0;
+    for (int i = 0; i < 16; i++) bits |= (unsigned long long)indices[i] << (3*i);
+
+    output[0] = (unsigned char)alpha0;
+    output[1] = (unsigned char)alpha1;
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)(bits >> (8*i));
+}
+
+// Get ETC subblock error for base color, best modifier table and pixels indices are returned
+// NOTE: Tables evaluation stops when error reaches bound, bound is returned if no table is better
+static int GetErrorETCSubblock(const Color *block, const int *pixels, const int *base, int bound, int *table, unsigned char *indices)
+{
+    // Pixels difference to base color: channels differences sum and squared sum
+    int sums[8] = { 0 };
+    int squares[8] = { 0 };
+
+    for (int i = 0; i < 8; i++)
+    {
+        int dr = block[pixels[i]].r - base[0];
+        int dg = block[pixels[i]].g - base[1];
+        int db = block[pixels[i]].b - base[2];
+
+        sums[i] = dr + dg + db;
+        squares[i] = dr*dr + dg*dg + db*db;
+    }
+
+    int minBase = (base[0] < base[1])? ((base[0] < base[2])? base[0] : base[2]) : ((base[1] < base[2])? base[1] : base[2]);
+    int maxBase = (base[0] > base[1])? ((base[0] > base[2])? base[0] : base[2]) : ((base[1] > base[2])? base[1] : base[2]);
+    int bestError = bound;
+
+    for (int t = 0; t < 8; t++)
+    {
+        unsigned char tableIndices[8] = { 0 };
+        int low = etcModifiers[t][0];
+        int high = etcModifiers[t][1];
+        int error = 0;
+
+        if (((minBase - high) >= 0) && ((maxBase + high) <= 255))
+        {
+            // No clamping: pixel error for modifier m is squares - 2*m*sums + 3*m*m,
+            // nearest modifier is selected by differences sum sign and magnitude
+            for (int i = 0; (i < 8) && (error < bestError); i++)
+            {
+                int sum = (sums[i] < 0)? -sums[i] : sums[i];
+                int index = (2*sum <= 3*(low + high))? 0 : 1;
+                int modifier = (index == 0)? low : high;
+
+                tableIndices[i] = (unsigned char)((sums[i] < 0)? index + 2 : index);
+                error += squares[i] - 2*modifier*sum + 3*modifier*modifier;
+            }
+        }
+        else
+        {
+            for (int i = 0; (i < 8) && (error < bestError); i++)
+            {
+                Color color = block[pixels[i]];
+                int best = INT_MAX;
+
+                for (int m = 0; m < 4; m++)
+                {
+                    int rgb[3] = { ClampByte(base[0] + etcModifiers[t][m]), ClampByte(base[1] + etcModifiers[t][m]), ClampByte(base[2] + etcModifiers[t][m]) };
+                    int distance = GetColorDistance(color, rgb);
+
+                    if (distance < best) { best = distance; tableIndices[i] = (unsigned char)m; }
+                }
+
+                error += best;
+            }
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            *table = t;
+            memcpy(indices, tableIndices, 8);
+        }
+    }
+
+    return bestError;
+}
+
+// Find ETC subblock base color quantized to 4 or 5 bits, candidates around subblock average color are evaluated
+// NOTE: In differential mode, second subblock base color is constrained to [-4..3] range from reference color,
+// bound is returned if no candidate error is lower than bound
+static int FitBaseETCSubblock(const Color *block, const int *pixels, int bits, const int *reference, int quality, int bound, int *quantized, int *table, unsigned char *indices)
+{
+    int max = (1 << bits) - 1;
+    int average[3] = { 0 };
+
+    for (int i = 0; i < 8; i++)
+    {
+        average[0] += block[pixels[i]].r;
+        average[1] += block[pixels[i]].g;
+        average[2] += block[pixels[i]].b;
+    }
+
+    // Candidates range per channel: rounded (fast), floor to ceil (default), rounded - 1 to rounded + 1 (high)
+    int low[3] = { 0 }, high[3] = { 0 };
+
+    for (int c = 0; c < 3; c++)
+    {
+        int scaled = average[c]*max;        // Average color scaled by 8*255
+        int rounded = (scaled + 4*255)/(8*255);
+
+        if (quality == COMPRESS_QUALITY_FAST) low[c] = high[c] = rounded;
+        else if (quality == COMPRESS_QUALITY_DEFAULT)
+        {
+            low[c] = scaled/(8*255);
+            high[c] = (scaled + 8*255 - 1)/(8*255);
+        }
+        else
+        {
+            low[c] = rounded - 1;
+            high[c] = rounded + 1;
+        }
+
+        if (reference != NULL)
+        {
+            if (low[c] < reference[c] - 4) low[c] = reference[c] - 4;
+            if (high[c] > reference[c] + 3) high[c] = reference[c] + 3;
+            if (low[c] > high[c]) low[c] = high[c] = (rounded < reference[c] - 4)? reference[c] - 4 : reference[c] + 3;
+        }
+
+        if (low[c] < 0) low[c] = 0;
+        if (high[c] > max) high[c] = max;
+    }
+
+    int bestError = bound;
+    unsigned char candidateIndices[8] = { 0 };
+
+    for (int r = low[0]; r <= high[0]; r++)
+    {
+        for (int g = low[1]; g <= high[1]; g++)
+        {
+            for (int b = low[2]; b <= high[2]; b++)
+            {
+                int base[3] = { r, g, b };
+                for (int c = 0; c < 3; c++) base[c] = (bits == 4)? (base[c] << 4) | base[c] : (base[c] << 3) | (base[c] >> 2);
+
+                int candidateTable = 0;
+                int error = GetErrorETCSubblock(block, pixels, base, bestError, &candidateTable, candidateIndices);
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    quantized[0] = r; quantized[1] = g; quantized[2] = b;
+                    *table = candidateTable;
+                    memcpy(indices, candidateIndices, 8);
+                }
+            }
+        }
+    }
+
+    return bestError;
+}
+
+// Get ETC2 planar mode channel error for quantized origin, horizontal and vertical colors
+static int GetErrorETCPlanar(const Color *block, int channel, int bits, int origin, int horizontal, int vertical)
+{
+    // Expand to 8 bit by bits replication
+    origin = (origin << (8 - bits)) | (origin >> (2*bits - 8));
+    horizontal = (horizontal << (8 - bits)) | (horizontal >> (2*bits - 8));
+    vertical = (vertical << (8 - bits)) | (vertical >> (2*bits - 8));
+
+    int error = 0;
+
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++)
+        {
+            const unsigned char *color = (const unsigned char *)&block[y*4 + x];
+            int value = ClampByte((x*(horizontal - origin) + y*(vertical - origin) + 4*origin + 2) >> 2);
+
+            error += (value - color[channel])*(value - color[channel]);
+        }
+    }
+
+    return error;
+}
+
+// Encode ETC2 planar mode block, returns block error
+// NOTE: Origin, horizontal and vertical colors are fitted by least squares, then quantized to RGB676
+static int EncodeETCPlanar(const Color *block, int quality, unsigned long long *bits)
+{
+    static const int channelBits[3] = { 6, 7, 6 };
+    int colors[3][3] = { 0 };       // Quantized colors by channel: origin, horizontal, vertical
+    int error = 0;
+
+    for (int c = 0; c < 3; c++)
+    {
+        // Least squares plane fit: value(x, y) = a + b*x + d*y
+        float mean = 0.0f, sumX = 0.0f, sumY = 0.0f;
+
+        for (int i = 0; i < 16; i++)
+        {
+            float value = ((const unsigned char *)&block[i])[c];
+
+            mean += value;
+            sumX += ((i%4) - 1.5f)*value;
+            sumY += ((i/4) - 1.5f)*value;
+        }
+
+        mean /= 16.0f;
+
+        float b = sumX/20.0f;
+        float d = sumY/20.0f;
+        float a = mean - 1.5f*b - 1.5f*d;
+        float plane[3] = { a, a + 4.0f*b, a + 4.0f*d };
+        int max = (1 << channelBits[c]) - 1;
+
+        for (int k = 0; k < 3; k++)
+        {
+            int value = (int)(plane[k]*max/255.0f + 0.5f);
+            colors[c][k] = (value < 0)? 0 : ((value > max)? max : value);
+        }
+
+        int bestError = GetErrorETCPlanar(block, c, channelBits[c], colors[c][0], colors[c][1], colors[c][2]);
+
+        if ((quality == COMPRESS_QUALITY_HIGH) && (bestError > 0))
+        {
+            int center[3] = { colors[c][0], colors[c][1], colors[c][2] };
+
+            for (int o = center[0] - 1; o <= center[0] + 1; o++)
+            {
+                for (int h = center[1] - 1; h <= center[1] + 1; h++)
+                {
+                    for (int v = center[2] - 1; v <= center[2] + 1; v++)
+                    {
+                        if ((o < 0) || (o > max) || (h < 0) || (h > max) || (v < 0) || (v > max)) continue;
+
+                        int candidateError = GetErrorETCPlanar(block, c, channelBits[c], o, h, v);
+                        if (candidateError < bestError)
+                        {
+                            bestError = candidateError;
+                            colors[c][0] = o; colors[c][1] = h; colors[c][2] = v;
+                        }
+                    }
+                }
+            }
+        }
+
+        error += bestError;
+    }
+
+    // Planar mode bits layout, base colors bits are interleaved with differential mode overflow bits
+    int ro = colors[0][0], rh = colors[0][1], rv = colors[0][2];
+    int go = colors[1][0], gh = colors[1][1], gv = colors[1][2];
+    int bo = colors[2][0], bh = colors[2][1], bv = colors[2][2];
+    unsigned long long value = 0;
+
+    value |= (unsigned long long)ro << 57;
+    value |= (unsigned long long)(go >> 6) << 56;
+    value |= (unsigned long long)(go & 0x3f) << 49;
+    value |= (unsigned long long)(bo >> 5) << 48;
+    value |= (unsigned long long)((bo >> 3) & 0x3) << 43;
+    value |= (unsigned long long)(bo & 0x7) << 39;
+    value |= (unsigned long long)(rh >> 1) << 34;
+    value |= (unsigned long long)(rh & 0x1) << 32;
+    value |= (unsigned long long)gh << 25;
+    value |= (unsigned long long)bh << 19;
+    value |= (unsigned long long)rv << 13;
+    value |= (unsigned long long)gv << 6;
+    value |= (unsigned long long)bv;
+    value |= 1ull << 33;            // Differential mode bit
+
+    // Free bits are set so red and green differential values do not overflow and blue value overflows (planar mode)
+    int red = (int)((value >> 59) & 0x1f) + (int)(((value >> 56) & 0x7) ^ 0x4) - 4;
+    if (red < 0) value |= 1ull << 63;
+
+    int green = (int)((value >> 51) & 0x1f) + (int)(((value >> 48) & 0x7) ^ 0x4) - 4;
+    if (green < 0) value |= 1ull << 55;
+
+    int blueLow = (int)((value >> 43) & 0x3);
+    int blueDelta = (int)((value >> 40) & 0x3);
+    if ((blueLow + blueDelta) >= 4) value |= 0x7ull << 45;
+    else value |= 1ull << 42;
+
+    *bits = value;
+
+    return error;
+}
+
+// Get ETC2 T or H mode block error for paint colors, pixels indices are returned
+static int GetErrorETCPaint(const Color *block, int paint[4][3], unsigned char *indices)
+{
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int best = GetColorDistance(block[i], paint[0]);
+        indices[i] = 0;
+
+        for (int k = 1; k < 4; k++)
+        {
+            int distance = GetColorDistance(block[i], paint[k]);
+            if (distance < best) { best = distance; indices[i] = (unsigned char)k; }
+        }
+
+        error += best;
+    }
+
+    return error;
+}
+
+// Encode ETC2 T or H mode block, returns block error (INT_MAX if block can not be split in two colors groups)
+// NOTE: Pixels are split in two groups by 2-means clustering, groups average colors are quantized to RGB444,
+// T mode paints one group with its base color, H mode paints both groups with base colors plus/minus distance
+static int EncodeETCTH(const Color *block, unsigned long long *bits)
+{
+    // Initial groups centers: pixel farthest from average color and pixel farthest from it
+    int average[3] = { 0 };
+    for (int i = 0; i < 16; i++) { average[0] += block[i].r; average[1] += block[i].g; average[2] += block[i].b; }
+    for (int c = 0; c < 3; c++) average[c] = (average[c] + 8)/16;
+
+    int first = 0, second = 0, farthest = -1;
+    for (int i = 0; i < 16; i++)
+    {
+        int distance = GetColorDistance(block[i], average);
+        if (distance > farthest) { farthest = distance; first = i; }
+    }
+
+    int centers[2][3] = { { block[first].r, block[first].g, block[first].b }, { 0 } };
+    farthest = -1;
+    for (int i = 0; i < 16; i++)
+    {
+        int distance = GetColorDistance(block[i], centers[0]);
+        if (distance > farthest) { farthest = distance; second = i; }
+    }
+
+    if (farthest <= 0) return INT_MAX;
+
+    centers[1][0] = block[second].r;
+    centers[1][1] = block[second].g;
+    centers[1][2] = block[second].b;
+
+    for (int k = 0; k < 4; k++)
+    {
+        int sums[2][3] = { 0 };
+        int counts[2] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            int group = (GetColorDistance(block[i], centers[1]) < GetColorDistance(block[i], centers[0]))? 1 : 0;
+
+            sums[group][0] += block[i].r;
+            sums[group][1] += block[i].g;
+            sums[group][2] += block[i].b;
+            counts[group]++;
+        }
+
+        if ((counts[0] == 0) || (counts[1] == 0)) return INT_MAX;
+
+        for (int g = 0; g < 2; g++)
+        {
+            for (int c = 0; c < 3; c++) centers[g][c] = (sums[g][c] + counts[g]/2)/counts[g];
+        }
+    }
+
+    int quantized[2][3] = { 0 };
+    for (int g = 0; g < 2; g++)
+    {
+        for (int c = 0; c < 3; c++) quantized[g][c] = (centers[g][c]*15 + 127)/255;
+    }
+
+    int bestError = INT_MAX;
+    int bestMode = 0;               // 0: T mode, 1: H mode
+    int bestColors[2][3] = { 0 };
+    int bestDistance = 0;
+    unsigned char bestIndices[16] = { 0 };
+    unsigned char indices[16] = { 0 };
+    int paint[4][3] = { 0 };
+
+    for (int d = 0; d < 8; d++)
+    {
+        // T mode: any group can be painted with single color
+        for (int single = 0; single < 2; single++)
+        {
+            const int *color0 = quantized[single];
+            const int *color1 = quantized[1 - single];
+
+            for (int c = 0; c < 3; c++)
+            {
+                paint[0][c] = color0[c]*17;
+                paint[1][c] = ClampByte(color1[c]*17 + etcDistances[d]);
+                paint[2][c] = color1[c]*17;
+                paint[3][c] = ClampByte(color1[c]*17 - etcDistances[d]);
+            }
+
+            int error = GetErrorETCPaint(block, paint, indices);
+            if (error < bestError)
+            {
+                bestError = error;
+                bestMode = 0;
+                bestDistance = d;
+                memcpy(bestColors[0], color0, sizeof(int)*3);
+                memcpy(bestColors[1], color1, sizeof(int)*3);
+                memcpy(bestIndices, indices, 16);
+            }
+        }
+
+        // H mode: distance index LSB is given by base colors order (first color >= second color)
+        int value0 = (quantized[0][0] << 8) | (quantized[0][1] << 4) | quantized[0][2];
+        int value1 = (quantized[1][0] << 8) | (quantized[1][1] << 4) | quantized[1][2];
+
+        if ((value0 == value1) && ((d & 0x1) == 0)) continue;
+
+        int order = ((value0 >= value1) == ((d & 0x1) == 1))? 0 : 1;
+        const int *color0 = quantized[order];
+        const int *color1 = quantized[1 - order];
+
+        for (int c = 0; c < 3; c++)
+        {
+            paint[0][c] = ClampByte(color0[c]*17 + etcDistances[d]);
+            paint[1][c] = ClampByte(color0[c]*17 - etcDistances[d]);
+            paint[2][c] = ClampByte(color1[c]*17 + etcDistances[d]);
+            paint[3][c] = ClampByte(color1[c]*17 - etcDistances[d]);
+        }
+
+        int error = GetErrorETCPaint(block, paint, indices);
+        if (error < bestError)
+        {
+            bestError = error;
+            bestMode = 1;
+            bestDistance = d;
+            memcpy(bestColors[0], color0, sizeof(int)*3);
+            memcpy(bestColors[1], color1, sizeof(int)*3);
+            memcpy(bestIndices, indices, 16);
+        }
+    }
+
+    int r0 = bestColors[0][0], g0 = bestColors[0][1], b0 = bestColors[0][2];
+    int r1 = bestColors[1][0], g1 = bestColors[1][1], b1 = bestColors[1][2];
+    unsigned long long value = 1ull << 33;     // Differential mode bit
+
+    if (bestMode == 0)
+    {
+        value |= (unsigned long long)(r0 >> 2) << 59;
+        value |= (unsigned long long)(r0 & 0x3) << 56;
+        value |= (unsigned long long)g0 << 52;
+        value |= (unsigned long long)b0 << 48;
+        value |= (unsigned long long)r1 << 44;
+        value |= (unsigned long long)g1 << 40;
+        value |= (unsigned long long)b1 << 36;
+        value |= (unsigned long long)(bestDistance >> 1) << 34;
+        value |= (unsigned long long)(bestDistance & 0x1) << 32;
+
+        // Free bits are set so red differential value overflows (T mode)
+        if (((r0 >> 2) + (r0 & 0x3)) >= 4) value |= 0x7ull << 61;
+        else value |= 1ull << 58;
+    }
+    else
+    {
+        value |= (unsigned long long)r0 << 59;
+        value |= (unsigned long long)(g0 >> 1) << 56;
+        value |= (unsigned long long)(g0 & 0x1) << 52;
+        value |= (unsigned long long)(b0 >> 3) << 51;
+        value |= (unsigned long long)(b0 & 0x7) << 47;
+        value |= (unsigned long long)r1 << 43;
+        value |= (unsigned long long)g1 << 39;
+        value |= (unsigned long long)b1 << 35;
+        value |= (unsigned long long)(bestDistance >> 2) << 34;
+        value |= (unsigned long long)((bestDistance >> 1) & 0x1) << 32;
+
+        // Free bits are set so red differential value does not overflow and green value overflows (H mode)
+        if ((r0 + (int)((g0 >> 1) ^ 0x4) - 4) < 0) value |= 1ull << 63;
+
+        int greenLow = ((g0 & 0x1) << 1) | (b0 >> 3);
+        int greenDelta = (b0 >> 1) & 0x3;
+        if ((greenLow + greenDelta) >= 4) value |= 0x7ull << 53;
+        else value |= 1ull << 50;
+    }
+
+    // Pixels indices bits are stored by columns
+    for (int i = 0; i < 16; i++)
+    {
+        int j = (i%4)*4 + i/4;
+
+        value |= (unsigned long long)(bestIndices[i] >> 1) << (16 + j);
+        value |= (unsigned long long)(bestIndices[i] & 0x1) << j;
+    }
+
+    *bits = value;
+
+    return bestError;
+}
+
+// Encode ETC1/ETC2 color block (8 bytes, big endian)
+// NOTE: Individual and differential modes are evaluated for both subblocks layouts,
+// ETC2 planar, T and H modes are evaluated with COMPRESS_QUALITY_DEFAULT and COMPRESS_QUALITY_HIGH
+static void EncodeBlockETC(const Color *block, unsigned char *output, bool etc2, int quality)
+{
+    unsigned long long bestBits = 0;
+    int bestError = INT_MAX;
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        // Subblocks pixels: 2x4 (flip = 0) or 4x2 (flip = 1)
+        int pixels[2][8] = { 0 };
+        int counts[2] = { 0 };
+
+        for (int y = 0; y < 4; y++)
+        {
+            for (int x = 0; x < 4; x++)
+            {
+                int subblock = flip? (y >= 2) : (x >= 2);
+                pixels[subblock][counts[subblock]++] = y*4 + x;
+            }
+        }
+
+        // Check if subblocks average colors fit differential mode range
+        bool differentialRange = true;
+
+        for (int c = 0; c < 3; c++)
+        {
+            int sums[2] = { 0 };
+
+            for (int i = 0; i < 8; i++)
+            {
+                sums[0] += ((const unsigned char *)&block[pixels[0][i]])[c];
+                sums[1] += ((const unsigned char *)&block[pixels[1][i]])[c];
+            }
+
+            int difference = (sums[1]*31 + 4*255)/(8*255) - (sums[0]*31 + 4*255)/(8*255);
+            if ((difference < -4) || (difference > 3)) differentialRange = false;
+        }
+
+        for (int differential = 1; differential >= 0; differential--)
+        {
+            // NOTE: Individual mode is only evaluated if required, or always with COMPRESS_QUALITY_HIGH
+            if (!differential && differentialRange && (quality != COMPRESS_QUALITY_HIGH)) continue;
+
+            int bits = differential? 5 : 4;
+            int quantized[2][3] = { 0 };
+            int tables[2] = { 0 };
+            unsigned char indices[2][8] = { 0 };
+
+            int error = FitBaseETCSubblock(block, pixels[0], bits, NULL, quality, bestError, quantized[0], &tables[0], indices[0]);
+            if (error >= bestError) continue;
+
+            error += FitBaseETCSubblock(block, pixels[1], bits, differential? quantized[0] : NULL, quality, bestError - error, quantized[1], &tables[1], indices[1]);
+            if (error >= bestError) continue;
+
+            unsigned long long value = 0;
+
+            for (int c = 0; c < 3; c++)
+            {
+                if (differential)
+                {
+                    value |= (unsigned long long)quantized[0][c] << (59 - 8*c);
+                    value |= (unsigned long long)((quantized[1][c] - quantized[0][c]) & 0x7) << (56 - 8*c);
+                }
+                else
+                {
+                    value |= (unsigned long long)quantized[0][c] << (60 - 8*c);
+                    value |= (unsigned long long)quantized[1][c] << (56 - 8*c);
+                }
+            }
+
+            value |= (unsigned long long)tables[0] << 37;
+            value |= (unsigned long long)tables[1] << 34;
+            value |= (unsigned long long)differential << 33;
+            value |= (unsigned long long)flip << 32;
+
+            // Pixels indices bits are stored by columns: index MSB at bit (16 + x*4 + y), LSB at bit (x*4 + y)
+            for (int s = 0; s < 2; s++)
+            {
+                for (int i = 0; i < 8; i++)
+                {
+                    int x = pixels[s][i]%4;
+                    int y = pixels[s][i]/4;
+
+                    value |= (unsigned long long)(indices[s][i] >> 1) << (16 + x*4 + y);
+                    value |= (unsigned long long)(indices[s][i] & 0x1) << (x*4 + y);
+                }
+            }
+
+            bestError = error;
+            bestBits = value;
+        }
+    }
+
+    if (etc2 && (quality != COMPRESS_QUALITY_FAST) && (bestError > 0))
+    {
+        unsigned long long value = 0;
+        int error = EncodeETCPlanar(block, quality, &value);
+
+        if (error < bestError) { bestError = error; bestBits = value; }
+
+        if (bestError > 0)
+        {
+            error = EncodeETCTH(block, &value);
+            if (error < bestError) bestBits = value;
+        }
+    }
+
+    for (int i = 0; i < 8; i++) output[i] = (unsigned char)(bestBits >> (56 - 8*i));
+}
+
+// Get EAC alpha block error, every pixel is assigned to nearest modifier
+static int GetErrorEAC(const Color *block, int base, int multiplier, int table, unsigned char *indices)
+{
+    int values[8] = { 0 };
+    for (int k = 0; k < 8; k++) values[k] = ClampByte(base + eacModifiers[table][k]*multiplier);
+
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int best = 256*256;
+
+        for (int k = 0; k < 8; k++)
+        {
+            int distance = (block[i].a - values[k])*(block[i].a - values[k]);
+            if (distance < best) { best = distance; if (indices != NULL) indices[i] = (unsigned char)k; }
+        }
+
+        error += best;
+    }
+
+    return error;
+}
+
+// Encode ETC2 EAC alpha block (8 bytes, big endian)
+// NOTE: Base value and multiplier are fitted to alpha extents for every modifiers table,
+// neighbour base values and multipliers are searched with COMPRESS_QUALITY_DEFAULT and COMPRESS_QUALITY_HIGH
+static void EncodeBlockEAC(const Color *block, unsigned char *output, int quality)
+{
+    int min = 255, max = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i].a < min) min = block[i].a;
+        if (block[i].a > max) max = block[i].a;
+    }
+
+    // Single value blocks use table 13, including a zero modifier
+    int bestBase = min, bestMultiplier = 1, bestTable = 13;
+    int bestError = (min == max)? 0 : INT_MAX;
+
+    for (int t = 0; (t < 16) && (bestError > 0); t++)
+    {
+        int low = eacModifiers[t][3];       // Most negative modifier
+        int high = eacModifiers[t][7];      // Most positive modifier
+        int multiplier = ((max - min) + (high - low)/2)/(high - low);
+        if (multiplier < 1) multiplier = 1;
+        if (multiplier > 15) multiplier = 15;
+
+        int base = ClampByte((2*(min + max) - multiplier*(high + low) + 2)/4);
+        int range = (quality == COMPRESS_QUALITY_HIGH)? 2 : ((quality == COMPRESS_QUALITY_DEFAULT)? 1 : 0);
+
+        for (int m = multiplier - ((quality == COMPRESS_QUALITY_HIGH)? 1 : 0); m <= multiplier + ((quality == COMPRESS_QUALITY_HIGH)? 1 : 0); m++)
+        {
+            if ((m < 1) || (m > 15)) continue;
+
+            for (int b = base - range; b <= base + range; b++)
+            {
+                if ((b < 0) || (b > 255)) continue;
+
+                int error = GetErrorEAC(block, b, m, t, NULL);
+                if (error < bestError) { bestError = error; bestBase = b; bestMultiplier = m; bestTable = t; }
+            }
+        }
+    }
+
+    unsigned char indices[16] = { 0 };
+    GetErrorEAC(block, bestBase, bestMultiplier, bestTable, indices);
+
+    // Pixels indices are stored by columns, first pixel at most significant bits
+    unsigned long long bits = 0;
+    for (int x = 0; x < 4; x++)
+    {
+        for (int y = 0; y < 4; y++) bits |= (unsigned long long)indices[y*4 + x] << (45 - 3*(x*4 + y));
+    }
+
+    output[0] = (unsigned char)bestBase;
+    output[1] = (unsigned char)((bestMultiplier << 4) | bestTable);
+    for (int i = 0; i < 6; i++) output[2 + i] = (unsigned char)(bits >> (40 - 8*i));
+}
+
+// Decode BC1 color block, three colors mode is only available for DXT1 (alpha is set to 0 for DXT1 RGBA)
+static void DecodeBlockBC1(const unsigned char *input, Color *block, int format)
+{
+    unsigned short color0 = (unsigned short)(input[0] | (input[1] << 8));
+    unsigned short color1 = (unsigned short)(input[2] | (input[3] << 8));
+    unsigned int indices = input[4] | (input[5] << 8) | (input[6] << 16) | ((unsigned int)input[7] << 24);
+    bool fourColors = (color0 > color1) || ((format != PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != PIXELFORMAT_COMPRESSED_DXT1_RGBA));
+
+    int palette[4][3] = { 0 };
+    GetPaletteBC1(color0, color1, fourColors, palette);
+
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (indices >> (2*i)) & 0x3;
+
+        block[i].r = (unsigned char)palette[index][0];
+        block[i].g = (unsigned char)palette[index][1];
+        block[i].b = (unsigned char)palette[index][2];
+        block[i].a = (!fourColors && (index == 3) && (format == PIXELFORMAT_COMPRESSED_DXT1_RGBA))? 0 : 255;
+    }
+}
+
+// Decode ETC1/ETC2 color block (ETC2 adds T, H and planar modes)
+static void DecodeBlockETC(const unsigned char *input, Color *block, bool etc2)
+{
+    unsigned long long bits = 0;
+    for (int i = 0; i < 8; i++) bits = (bits << 8) | input[i];
+
+    int base[2][3] = { 0 };
+    bool differential = (bits >> 33) & 0x1;
+    bool flip = (bits >> 32) & 0x1;
+
+    if (!differential)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            base[0][c] = (int)((bits >> (60 - 8*c)) & 0xf)*17;
+            base[1][c] = (int)((bits >> (56 - 8*c)) & 0xf)*17;
+        }
+    }
+    else
+    {
+        int quantized[2][3] = { 0 };
+
+        for (int c = 0; c < 3; c++)
+        {
+            quantized[0][c] = (int)((bits >> (59 - 8*c)) & 0x1f);
+            quantized[1][c] = quantized[0][c] + (int)(((bits >> (56 - 8*c)) & 0x7) ^ 0x4) - 4;
+        }
+
+        if (etc2 && ((quantized[1][0] < 0) || (quantized[1][0] > 31)))
+        {
+            // T mode: first paint color is first base color, others are second base color modified by distance
+            int color0[3] = { (int)((((bits >> 59) & 0x3) << 2) | ((bits >> 56) & 0x3)), (int)((bits >> 52) & 0xf), (int)((bits >> 48) & 0xf) };
+            int color1[3] = { (int)((bits >> 44) & 0xf), (int)((bits >> 40) & 0xf), (int)((bits >> 36) & 0xf) };
+            int distance = etcDistances[(((bits >> 34) & 0x3) << 1) | ((bits >> 32) & 0x1)];
+            int paint[4][3] = { 0 };
+
+            for (int c = 0; c < 3; c++)
+            {
+                paint[0][c] = color0[c]*17;
+                paint[1][c] = ClampByte(color1[c]*17 + distance);
+                paint[2][c] = color1[c]*17;
+                paint[3][c] = ClampByte(color1[c]*17 - distance);
+            }
+
+            for (int j = 0; j < 16; j++)
+            {
+                int index = (int)((((bits >> (16 + j)) & 0x1) << 1) | ((bits >> j) & 0x1));
+                Color *pixel = &block[(j%4)*4 + j/4];
+
+                pixel->r = (unsigned char)paint[index][0];
+                pixel->g = (unsigned char)paint[index][1];
+                pixel->b = (unsigned char)paint[index][2];
+                pixel->a = 255;
+            }
+
+            return;
+        }
+        else if (etc2 && ((quantized[1][1] < 0) || (quantized[1][1] > 31)))
+        {
+            // H mode: paint colors are both base colors modified by distance
+            int color0[3] = { (int)((bits >> 59) & 0xf), (int)((((bits >> 56) & 0x7) << 1) | ((bits >> 52) & 0x1)), (int)((((bits >> 51) & 0x1) << 3) | ((bits >> 47) & 0x7)) };
+            int color1[3] = { (int)((bits >> 43) & 0xf), (int)((bits >> 39) & 0xf), (int)((bits >> 35) & 0xf) };
+            int value0 = (color0[0] << 8) | (color0[1] << 4) | color0[2];
+            int value1 = (color1[0] << 8) | (color1[1] << 4) | color1[2];
+            int distance = etcDistances[(((bits >> 34) & 0x1) << 2) | (((bits >> 32) & 0x1) << 1) | ((value0 >= value1)? 1 : 0)];
+            int paint[4][3] = { 0 };
+
+            for (int c = 0; c < 3; c++)
+            {
+                paint[0][c] = ClampByte(color0[c]*17 + distance);
+                paint[1][c] = ClampByte(color0[c]*17 - distance);
+                paint[2][c] = ClampByte(color1[c]*17 + distance);
+                paint[3][c] = ClampByte(color1[c]*17 - distance);
+            }
+
+            for (int j = 0; j < 16; j++)
+            {
+                int index = (int)((((bits >> (16 + j)) & 0x1) << 1) | ((bits >> j) & 0x1));
+                Color *pixel = &block[(j%4)*4 + j/4];
+
+                pixel->r = (unsigned char)paint[index][0];
+                pixel->g = (unsigned char)paint[index][1];
+                pixel->b = (unsigned char)paint[index][2];
+                pixel->a = 255;
+            }
+
+            return;
+        }
+        else if (etc2 && ((quantized[1][2] < 0) || (quantized[1][2] > 31)))
+        {
+            // Planar mode: colors interpolated from origin, horizontal and vertical colors (RGB676)
+            int colors[3][3] = {
+                { (int)((bits >> 57) & 0x3f), (int)((((bits >> 34) & 0x1f) << 1) | ((bits >> 32) & 0x1)), (int)((bits >> 13) & 0x3f) },
+                { (int)((((bits >> 56) & 0x1) << 6) | ((bits >> 49) & 0x3f)), (int)((bits >> 25) & 0x7f), (int)((bits >> 6) & 0x7f) },
+                { (int)((((bits >> 48) & 0x1) << 5) | (((bits >> 43) & 0x3) << 3) | ((bits >> 39) & 0x7)), (int)((bits >> 19) & 0x3f), (int)(bits & 0x3f) }
+            };
+
+            for (int k = 0; k < 3; k++)
+            {
+                colors[0][k] = (colors[0][k] << 2) | (colors[0][k] >> 4);
+                colors[1][k] = (colors[1][k] << 1) | (colors[1][k] >> 6);
+                colors[2][k] = (colors[2][k] << 2) | (colors[2][k] >> 4);
+            }
+
+            for (int y = 0; y < 4; y++)
+            {
+                for (int x = 0; x < 4; x++)
+                {
+                    unsigned char *pixel = (unsigned char *)&block[y*4 + x];
+
+                    for (int c = 0; c < 3; c++) pixel[c] = (unsigned char)ClampByte((x*(colors[c][1] - colors[c][0]) + y*(colors[c][2] - colors[c][0]) + 4*colors[c][0] + 2) >> 2);
+                    pixel[3] = 255;
+                }
+            }
+
+            return;
+        }
+
+        for (int s = 0; s < 2; s++)
+        {
+            for (int c = 0; c < 3; c++) base[s][c] = ((quantized[s][c] & 0x1f) << 3) | ((quantized[s][c] & 0x1f) >> 2);
+        }
+    }
+
+    int tables[2] = { (int)((bits >> 37) & 0x7), (int)((bits >> 34) & 0x7) };
+
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++)
+        {
+            int j = x*4 + y;
+            int subblock = flip? (y >= 2) : (x >= 2);
+            int index = (int)((((bits >> (16 + j)) & 0x1) << 1) | ((bits >> j) & 0x1));
+            int modifier = etcModifiers[tables[subblock]][index];
+            Color *pixel = &block[y*4 + x];
+
+            pixel->r = (unsigned char)ClampByte(base[subblock][0] + modifier);
+            pixel->g = (unsigned char)ClampByte(base[subblock][1] + modifier);
+            pixel->b = (unsigned char)ClampByte(base[subblock][2] + modifier);
+            pixel->a = 255;
+        }
+    }
+}
+
+// Decode block alpha values: BC2 explicit alpha, BC3 interpolated alpha or EAC alpha
+static void DecodeBlockAlpha(const unsigned char *input, Color *block, int format)
+{
+    if (format == PIXELFORMAT_COMPRESSED_DXT3_RGBA)
+    {
+        for (int i = 0; i < 16; i++) block[i].a = (unsigned char)(((input[i/2] >> (4*(i%2))) & 0xf)*17);
+    }
+    else if (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)
+    {
+        int palette[8] = { 0 };
+        GetPaletteBC3Alpha(input[0], input[1], palette);
+
+        unsigned long long bits = 0;
+        for (int i = 0; i < 6; i++) bits |= (unsigned long long)input[2 + i] << (8*i);
+
+        for (int i = 0; i < 16; i++) block[i].a = (unsigned char)palette[(bits >> (3*i)) & 0x7];
+    }
+    else if (format == PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)
+    {
+        int multiplier = input[1] >> 4;
+        int table = input[1] & 0xf;
+
+        unsigned long long bits = 0;
+        for (int i = 0; i < 6; i++) bits = (bits << 8) | input[2 + i];
+
+        for (int j = 0; j < 16; j++)
+        {
+            int index = (int)((bits >> (45 - 3*j)) & 0x7);
+            block[(j%4)*4 + j/4].a = (unsigned char)ClampByte(input[0] + eacModifiers[table][index]*multiplier);
+        }
+    }
+}
+
+// Compress rows of 4x4 pixels blocks
+static void CompressBlocksRange(void *data, int start, int end)
+{
+    BlockJob *job = (BlockJob *)data;
+    int blocksX = (job->width + 3)/4;
+    int blockSize = GetBlockDataSize(job->format);
+    Color block[16] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            unsigned char *output = job->blocks + (by*blocksX + bx)*blockSize;
+
+            // Pixels outside image are replicated from image border
+            for (int y = 0; y < 4; y++)
+            {
+                int py = (by*4 + y < job->height)? by*4 + y : job->height - 1;
+
+                for (int x = 0; x < 4; x++)
+                {
+                    int px = (bx*4 + x < job->width)? bx*4 + x : job->width - 1;
+                    block[y*4 + x] = job->pixels[py*job->width + px];
+                }
+            }
+
+            switch (job->format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB: EncodeBlockBC1(block, output, false, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: EncodeBlockBC1(block, output, true, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                {
+                    EncodeBlockBC2Alpha(block, output);
+                    EncodeBlockBC1(block, output + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    EncodeBlockBC3Alpha(block, output, job->quality);
+                    EncodeBlockBC1(block, output + 8, false, job->quality);
+                } break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB: EncodeBlockETC(block, output, false, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: EncodeBlockETC(block, output, true, job->quality); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    EncodeBlockEAC(block, output, job->quality);
+                    EncodeBlockETC(block, output + 8, true, job->quality);
+                } break;
+                default: break;
+            }
+        }
+    }
+}
+
+// Decompress rows of 4x4 pixels blocks
+static void DecompressBlocksRange(void *data, int start, int end)
+{
+    BlockJob *job = (BlockJob *)data;
+    int blocksX = (job->width + 3)/4;
+    int blockSize = GetBlockDataSize(job->format);
+    Color block[16] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            const unsigned char *input = job->blocks + (by*blocksX + bx)*blockSize;
+
+            switch (job->format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: DecodeBlockBC1(input, block, job->format); break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                {
+                    DecodeBlockBC1(input + 8, block, job->format);
+                    DecodeBlockAlpha(input, block, job->format);
+                } break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB: DecodeBlockETC(input, block, false); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: DecodeBlockETC(input, block, true); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                {
+                    DecodeBlockETC(input + 8, block, true);
+                    DecodeBlockAlpha(input, block, job->format);
+                } break;
+                default: break;
+            }
+
+            // Pixels outside image are discarded
+            for (int y = 0; (y < 4) && (by*4 + y < job->height); y++)
+            {
+                for (int x = 0; (x < 4) && (bx*4 + x < job->width); x++) job->pixels[(by*4 + y)*job->width + bx*4 + x] = block[y*4 + x];
+            }
+        }
+    }
+}
+
+// Get unique colors in first appearance order, colors are stored up to maxColors
+// NOTE: Returns unique colors count, or maxColors + 1 if there are more colors,
+// transparent pixels (alpha = 0) are considered BLANK if transparent is enabled, ignored otherwise
+static int GetUniqueColors(const Color *pixels, int count, Color *colors, int maxColors, bool transparent)
+{
+    int colorCount = 0;
+    bool blankFound = false;
+
+    // Colors hash set (open addressing), at least half of the entries are always empty
+    // NOTE: Colors with alpha > 0 are never 0 once packed, 0 is used as empty entry
+    int bits = 4;
+    while (((1 << bits) < 2*(maxColors + 1)) && ((1 << bits) < 2*count)) bits++;
+
+    unsigned int mask = (1u << bits) - 1;
+    unsigned int *table = (unsigned int *)RL_CALLOC(mask + 1, sizeof(unsigned int));
+
+    for (int i = 0; (i < count) && (colorCount <= maxColors); i++)
+    {
+        Color color = pixels[i];
+
+        if (color.a == 0)
+        {
+            if (transparent && !blankFound)
+            {
+                blankFound = true;
+                if (colorCount < maxColors) colors[colorCount] = BLANK;
+                colorCount++;
+            }
+
+            continue;
+        }
+
+        unsigned int key = (unsigned int)color.r | ((unsigned int)color.g << 8) | ((unsigned int)color.b << 16) | ((unsigned int)color.a << 24);
+        unsigned int index = (key*2654435761u) >> (32 - bits);
+
+        while ((table[index] != 0) && (table[index] != key)) index = (index + 1) & mask;
+
+        if (table[index] == 0)
+        {
+            table[index] = key;
+            if (colorCount < maxColors) colors[colorCount] = color;
+            colorCount++;
+        }
+    }
+
+    RL_FREE(table);
+
+    return colorCount;
+}
+
+// Get colors histogram box [start, end) channel with largest variance, returns its pixels weighted variance
+// NOTE: Boxes with a single bin can not be split, variance is 0
+static float GetColorBoxVariance(const ColorBin *bins, int start, int end, int *channel)
+{
+    float count = 0.0f;
+    float mean[4] = { 0 };
+    float variance[4] = { 0 };
+    float result = 0.0f;
+
+    *channel = 0;
+    if ((end - start) < 2) return result;
+
+    for (int i = start; i < end; i++)
+    {
+        count += (float)bins[i].count;
+        for (int c = 0; c < 4; c++) mean[c] += (float)bins[i].sum[c];
+    }
+
+    for (int c = 0; c < 4; c++) mean[c] /= count;
+
+    for (int i = start; i < end; i++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            float difference = (float)bins[i].sum[c]/(float)bins[i].count - mean[c];
+            variance[c] += difference*difference*(float)bins[i].count;
+        }
+    }
+
+    for (int c = 0; c < 4; c++)
+    {
+        if (variance[c] > result)
+        {
+            result = variance[c];
+            *channel = c;
+        }
+    }
+
+    return result;
+}
+
+// Compare colors histogram bins keys, required by qsort()
+static int CompareColorBins(const void *a, const void *b)
+{
+    return ((const ColorBin *)a)->key - ((const ColorBin *)b)->key;
+}
+
+// Get palette from colors histogram (median cut), returns palette colors count
+// NOTE: Box with largest variance is split at pixels median of its largest variance channel,
+// palette colors are boxes pixels mean
+static int GetPaletteMedianCut(ColorBin *bins, int binCount, Color *palette, int paletteSize)
+{
+    int *starts = (int *)RL_MALLOC((paletteSize + 1)*sizeof(int));   // Boxes bins ranges: [starts[i], starts[i + 1])
+    float *variances = (float *)RL_MALLOC(paletteSize*sizeof(float));
+    int *channels = (int *)RL_MALLOC(paletteSize*sizeof(int));
+    int boxCount = 1;
+
+    starts[0] = 0;
+    starts[1] = binCount;
+    variances[0] = GetColorBoxVariance(bins, 0, binCount, &channels[0]);
+
+    while (boxCount < paletteSize)
+    {
+        int split = -1;
+
+        for (int b = 0; b < boxCount; b++)
+        {
+            if ((variances[b] > 0.0f) && ((split < 0) || (variances[b] > variances[split]))) split = b;
+        }
+
+        if (split < 0) break;       // No box can be split
+
+        // Sort box bins by channel and split at pixels median
+        int start = starts[split];
+        int end = starts[split + 1];
+        unsigned int total = 0;
+
+        for (int i = start; i < end; i++)
+        {
+            bins[i].key = (int)(bins[i].sum[channels[split]]/bins[i].count);
+            total += bins[i].count;
+        }
+
+        qsort(bins + start, end - start, sizeof(ColorBin), CompareColorBins);
+
+        int median = start + 1;
+        unsigned int accumulated = bins[start].count;
+
+        while ((median < (end - 1)) && (accumulated < total/2)) accumulated += bins[median++].count;
+
+        // New box inserted after split box
+        for (int b = boxCount; b > split; b--) starts[b + 1] = starts[b];
+        for (int b = boxCount; b > (split + 1); b--)
+        {
+            variances[b] = variances[b - 1];
+            channels[b] = channels[b - 1];
+        }
+
+        starts[split + 1] = median;
+        boxCount++;
+
+        variances[split] = GetColorBoxVariance(bins, starts[split], starts[split + 1], &channels[split]);
+        variances[split + 1] = GetColorBoxVariance(bins, starts[split + 1], starts[split + 2], &channels[split + 1]);
+    }
+
+    for (int b = 0; b < boxCount; b++)
+    {
+        unsigned long long count = 0;
+        unsigned long long sum[4] = { 0 };
+
+        for (int i = starts[b]; i < starts[b + 1]; i++)
+        {
+            count += bins[i].count;
+            for (int c = 0; c < 4; c++) sum[c] += bins[i].sum[c];
+        }
+
+        palette[b].r = (unsigned char)((sum[0] + count/2)/count);
+        palette[b].g = (unsigned char)((sum[1] + count/2)/count);
+        palette[b].b = (unsigned char)((sum[2] + count/2)/count);
+        palette[b].a = (unsigned char)((sum[3] + count/2)/count);
+    }
+
+    RL_FREE(starts);
+    RL_FREE(variances);
+    RL_FREE(channels);
+
+    return boxCount;
+}
+
+// Load palette nearest color search cells, cells candidates are the palette colors that can be nearest
+// to any cell value: colors with min distance to cell lower than the smallest max distance to cell
+static PaletteSearch LoadPaletteSearch(const Color *palette, int count)
+{
+    PaletteSearch search = { 0 };
+    search.palette = palette;
+    search.count = count;
+    search.cellStarts = (int *)RL_MALLOC((PALETTE_SEARCH_CELLS + 1)*sizeof(int));
+
+    int capacity = PALETTE_SEARCH_CELLS*8;
+    int candidateCount = 0;
+    search.candidates = (unsigned char *)RL_MALLOC(capacity);
+
+    int minDistances[256] = { 0 };
+
+    for (int cell = 0; cell < PALETTE_SEARCH_CELLS; cell++)
+    {
+        // Cell bounds: r, g, b, a
+        int low[4] = { (cell >> 10)*16, ((cell >> 6) & 15)*16, ((cell >> 2) & 15)*16, (cell & 3)*64 };
+        int high[4] = { low[0] + 15, low[1] + 15, low[2] + 15, low[3] + 63 };
+        int threshold = INT_MAX;
+
+        for (int i = 0; i < count; i++)
+        {
+            unsigned char values[4] = { palette[i].r, palette[i].g, palette[i].b, palette[i].a };
+            int minDistance = 0;
+            int maxDistance = 0;
+
+            for (int c = 0; c < 4; c++)
+            {
+                int nearest = (values[c] < low[c])? (low[c] - values[c]) : ((values[c] > high[c])? (values[c] - high[c]) : 0);
+                int farthest = ((values[c] - low[c]) > (high[c] - values[c]))? (values[c] - low[c]) : (high[c] - values[c]);
+
+                minDistance += nearest*nearest;
+                maxDistance += farthest*farthest;
+            }
+
+            minDistances[i] = minDistance;
+            if (maxDistance < threshold) threshold = maxDistance;
+        }
+
+        search.cellStarts[cell] = candidateCount;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (minDistances[i] <= threshold)
+            {
+                if (candidateCount == capacity)
+                {
+                    capacity *= 2;
+                    search.candidates = (unsigned char *)RL_REALLOC(search.candidates, capacity);
+                }
+
+                search.candidates[candidateCount++] = (unsigned char)i;
+            }
+        }
+    }
+
+    search.cellStarts[PALETTE_SEARCH_CELLS] = candidateCount;
+
+    return search;
+}
+
+// Unload palette nearest color search cells
+static void UnloadPaletteSearch(PaletteSearch search)
+{
+    RL_FREE(search.cellStarts);
+    RL_FREE(search.candidates);
+}
+
+// Get palette color index nearest to provided values (RGBA squared distance), lowest index on ties
+static int GetPaletteNearest(const PaletteSearch *search, int r, int g, int b, int a)
+{
+    int cell = ((r >> 4) << 10) | ((g >> 4) << 6) | ((b >> 4) << 2) | (a >> 6);
+    int nearest = 0;
+    int minDistance = INT_MAX;
+
+    for (int i = search->cellStarts[cell]; i < search->cellStarts[cell + 1]; i++)
+    {
+        Color color = search->palette[search->candidates[i]];
+        int distance = (color.r - r)*(color.r - r) + (color.g - g)*(color.g - g) + (color.b - b)*(color.b - b) + (color.a - a)*(color.a - a);
+
+        if (distance < minDistance)
+        {
+            minDistance = distance;
+            nearest = search->candidates[i];
+        }
+    }
+
+    return nearest;
+}
+
+// Map pixels range to nearest palette colors indices, required by LoadImagePaletteIndices()
+// NOTE: Nearest colors are cached by color hash, cache entries are initialized with BLANK
+static void LoadPaletteIndicesRange(void *data, int start, int end)
+{
+    PaletteJob *job = (PaletteJob *)data;
+    unsigned int keys[1 << PALETTE_CACHE_BITS] = { 0 };
+    unsigned char cached[1 << PALETTE_CACHE_BITS] = { 0 };
+    memset(cached, GetPaletteNearest(job->search, 0, 0, 0, 0), sizeof(cached));
+
+    for (int i = start; i < end; i++)
+    {
+        Color color = job->pixels[i];
+        unsigned int key = (unsigned int)color.r | ((unsigned int)color.g << 8) | ((unsigned int)color.b << 16) | ((unsigned int)color.a << 24);
+        unsigned int index = (key*2654435761u) >> (32 - PALETTE_CACHE_BITS);
+
+        if (keys[index] != key)
+        {
+            keys[index] = key;
+            cached[index] = (unsigned char)GetPaletteNearest(job->search, color.r, color.g, color.b, color.a);
+        }
+
+        job->indices[i] = cached[index];
+    }
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Get value 32 bit hash, used as counter-based random generator: hash(counter ^ key)
+// NOTE: Integer hash with low bias (xor-shift-multiply)
+static unsigned int GetNoiseHash(unsigned int value)
+{
+    value ^= value >> 16;
+    value *= 0x7feb352du;
+    value ^= value >> 15;
+    value *= 0x846ca68bu;
+    value ^= value >> 16;
+
+    return value;
+}
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+// Multiply 32 bit integers (low 32 bits of result), SSE2 only provides unsigned 32x32->64 bit multiply
+static inline __m128i MultiplyInt32x4(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+#endif
+
+// Generate white noise pixels range, required by GenImageWhiteNoise()
+static void GenImageWhiteNoiseRange(void *data, int start, int end)
+{
+    NoiseJob *job = (NoiseJob *)data;
+    int i = start;
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+    // NOTE: WHITE and BLACK colors stored as 32 bit values (little endian)
+    const __m128i black = _mm_set1_epi32((int)0xff000000);
+    const __m128i threshold = _mm_set1_epi32((int)job->threshold);
+    const __m128i key = _mm_set1_epi32((int)job->key);
+    const __m128i step = _mm_set1_epi32(4);
+    __m128i counter = _mm_setr_epi32(start, start + 1, start + 2, start + 3);
+
+    for (; (i + 4) <= end; i += 4)
+    {
+        __m128i value = _mm_xor_si128(counter, key);
+
+        value = _mm_xor_si128(value, _mm_srli_epi32(value, 16));
+        value = MultiplyInt32x4(value, _mm_set1_epi32(0x7feb352d));
+        value = _mm_xor_si128(value, _mm_srli_epi32(value, 15));
+        value = MultiplyInt32x4(value, _mm_set1_epi32((int)0x846ca68b));
+        value = _mm_xor_si128(value, _mm_srli_epi32(value, 16));
+
+        __m128i white = _mm_cmplt_epi32(_mm_srli_epi32(value, 8), threshold);
+        _mm_storeu_si128((__m128i *)(job->pixels + i), _mm_or_si128(black, white));
+
+        counter = _mm_add_epi32(counter, step);
+    }
+#endif
+
+    for (; i < end; i++) job->pixels[i] = ((GetNoiseHash((unsigned int)i ^ job->key) >> 8) < job->threshold)? WHITE : BLACK;
+}
+
+// Get Perlin noise lattice cell corners terms for a row (stb_perlin lattice): corner noise is factor*x + constant,
+// x is pixel position in cell (x - 1 for corners on cell right side), constant is gradient dot product with y and z terms
+// NOTE: Gradients have two non-zero components (+-1), so this is rounded the same way as stb_perlin gradients
+static void GetPerlinNoiseCell(int cell, const int *rows, const int *layers, float y, float z, int seed, float *factors, float *constants)
+{
+    int r0 = stb__perlin_randtab[(cell & 255) + seed];
+    int r1 = stb__perlin_randtab[((cell + 1) & 255) + seed];
+    int hashes[4] = {
+        stb__perlin_randtab[r0 + rows[0]], stb__perlin_randtab[r0 + rows[1]],
+        stb__perlin_randtab[r1 + rows[0]], stb__perlin_randtab[r1 + rows[1]]
+    };
+
+    // Corners order: x offset (c >> 2), y offset ((c >> 1) & 1), z offset (c & 1)
+    for (int c = 0; c < 8; c++)
+    {
+        const float *gradient = perlinGradients[stb__perlin_randtab_grad_idx[hashes[c >> 1] + layers[c & 1]]];
+        float cornerY = ((c >> 1) & 1)? (y - 1) : y;
+        float cornerZ = (c & 1)? (z - 1) : z;
+
+        factors[c*4] = gradient[0];
+        constants[c*4] = gradient[1]*cornerY + gradient[2]*cornerZ;
+    }
+}
+
+// Generate Perlin noise rows, required by GenImagePerlinNoise()
+// NOTE: Noise is fbm (fractal brownian motion) of stb_perlin noise, same as stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6):
+//   lacunarity = 2.0   -- spacing between successive octaves
+//   gain       = 0.5   -- relative weighting applied to each successive octave
+//   octaves    = 6     -- number of octaves of noise to sum
+// Pixels are processed in groups of 4, cells corners terms are only computed when pixel cell changes
+static void GenImagePerlinNoiseRows(void *data, int start, int end)
+{
+    NoiseJob *job = (NoiseJob *)data;
+    int width = job->width;
+    int paddedWidth = (width + 3) & ~3;
+    float *positions = (float *)RL_MALLOC(paddedWidth*sizeof(float));
+    float *sums = (float *)RL_MALLOC(paddedWidth*sizeof(float));
+
+    for (int x = 0; x < paddedWidth; x++) positions[x] = (float)(x + job->offsetX)*(job->scale/(float)width);
+
+    // Corners terms for 4 pixels
+    float factors[8*4] = { 0 };
+    float constants[8*4] = { 0 };
+
+    #define PERLIN_EASE(t) ((((t)*6 - 15)*(t) + 10)*(t)*(t)*(t))
+
+    for (int y = start; y < end; y++)
+    {
+        float ny = (float)(y + job->offsetY)*(job->scale/(float)job->height);
+        float frequency = 1.0f;
+        float amplitude = 1.0f;
+
+        memset(sums, 0, paddedWidth*sizeof(float));
+
+        for (int octave = 0; octave < 6; octave++)
+        {
+            float fy = ny*frequency;
+            float fz = 1.0f*frequency;
+            int py = (fy < (int)fy)? ((int)fy - 1) : (int)fy;
+            int pz = (fz < (int)fz)? ((int)fz - 1) : (int)fz;
+            int rows[2] = { py & 255, (py + 1) & 255 };
+            int layers[2] = { pz & 255, (pz + 1) & 255 };
+
+            fy -= py;
+            fz -= pz;
+
+            float v = PERLIN_EASE(fy);
+            float w = PERLIN_EASE(fz);
+            int cells[4] = { INT_MIN, INT_MIN, INT_MIN, INT_MIN };
+
+            for (int x = 0; x < paddedWidth; x += 4)
+            {
+                float fx[4] = { 0 };
+                float u[4] = { 0 };
+
+                for (int l = 0; l < 4; l++)
+                {
+                    float position = positions[x + l]*frequency;
+                    int px = (position < (int)position)? ((int)position - 1) : (int)position;
+
+                    if (px != cells[l])
+                    {
+                        cells[l] = px;
+
+                        if ((l > 0) && (px == cells[l - 1]))
+                        {
+                            for (int c = 0; c < 8; c++)
+                            {
+                                factors[c*4 + l] = factors[c*4 + l - 1];
+                                constants[c*4 + l] = constants[c*4 + l - 1];
+                            }
+                        }
+                        else GetPerlinNoiseCell(px, rows, layers, fy, fz, octave, factors + l, constants + l);
+                    }
+
+                    fx[l] = position - px;
+                    u[l] = PERLIN_EASE(fx[l]);
+                }
+
+            #if defined(RL_TEXTURES_SIMD_SSE2)
+                __m128 x0 = _mm_loadu_ps(fx);
+                __m128 x1 = _mm_sub_ps(x0, _mm_set1_ps(1.0f));
+                __m128 n[8];
+
+                for (int c = 0; c < 8; c++) n[c] = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(factors + c*4), (c < 4)? x0 : x1), _mm_loadu_ps(constants + c*4));
+
+                // Trilinear interpolation of corners noise: lerp(a, b, t) = a + (b - a)*t
+                __m128 wt = _mm_set1_ps(w);
+                __m128 vt = _mm_set1_ps(v);
+                __m128 ut = _mm_loadu_ps(u);
+
+                for (int c = 0; c < 4; c++) n[c] = _mm_add_ps(n[2*c], _mm_mul_ps(_mm_sub_ps(n[2*c + 1], n[2*c]), wt));
+                for (int c = 0; c < 2; c++) n[c] = _mm_add_ps(n[2*c], _mm_mul_ps(_mm_sub_ps(n[2*c + 1], n[2*c]), vt));
+                n[0] = _mm_add_ps(n[0], _mm_mul_ps(_mm_sub_ps(n[1], n[0]), ut));
+
+                _mm_storeu_ps(sums + x, _mm_add_ps(_mm_loadu_ps(sums + x), _mm_mul_ps(n[0], _mm_set1_ps(amplitude))));
+            #else
+                for (int l = 0; l < 4; l++)
+                {
+                    float n[8] = { 0 };
+
+                    for (int c = 0; c < 8; c++) n[c] = factors[c*4 + l]*((c < 4)? fx[l] : (fx[l] - 1)) + constants[c*4 + l];
+
+                    // Trilinear interpolation of corners noise: lerp(a, b, t) = a + (b - a)*t
+                    for (int c = 0; c < 4; c++) n[c] = n[2*c] + (n[2*c + 1] - n[2*c])*w;
+                    for (int c = 0; c < 2; c++) n[c] = n[2*c] + (n[2*c + 1] - n[2*c])*v;
+                    n[0] = n[0] + (n[1] - n[0])*u[l];
+
+                    sums[x + l] += n[0]*amplitude;
+                }
+            #endif
+            }
+
+            frequency *= 2.0f;
+            amplitude *= 0.5f;
+        }
+
+        for (int x = 0; x < width; x++)
+        {
+            float p = sums[x];
+
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
+
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
+
+            unsigned char intensity = (unsigned char)(np*255.0f);
+            job->pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+
+    #undef PERLIN_EASE
+
+    RL_FREE(positions);
+    RL_FREE(sums);
+}
+
+// Generate cellular rows, required by GenImageCellular()
+// NOTE: Row pixels are processed by tiles spans, sharing the seeds of the 3x3 adjacent tiles,
+// squared distances to seeds are exact integers, pixel distance is square root of minimum squared distance
+static void GenImageCellularRows(void *data, int start, int end)
+{
+    NoiseJob *job = (NoiseJob *)data;
+    int width = job->width;
+    int tileSize = job->tileSize;
+
+    for (int y = start; y < end; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0, tileX = 0; x < width; tileX++)
+        {
+            int spanEnd = ((tileX + 1)*tileSize < width)? (tileX + 1)*tileSize : width;
+
+            // Adjacent tiles seeds
+            int seedsX[9] = { 0 };
+            int seedsY[9] = { 0 };
+            int seedCount = 0;
+
+            for (int i = -1; i < 2; i++)
+            {
+                if (((tileX + i) < 0) || ((tileX + i) >= job->seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if (((tileY + j) < 0) || ((tileY + j) >= job->seedsPerCol)) continue;
+
+                    Vector2 seed = job->seeds[(tileY + j)*job->seedsPerRow + tileX + i];
+                    seedsX[seedCount] = (int)seed.x;
+                    seedsY[seedCount] = (int)seed.y;
+                    seedCount++;
+                }
+            }
+
+            for (; x < spanEnd; x++)
+            {
+                int minSquared = INT_MAX;
+
+                for (int k = 0; k < seedCount; k++)
+                {
+                    int dx = x - seedsX[k];
+                    int dy = y - seedsY[k];
+                    if ((dx*dx + dy*dy) < minSquared) minSquared = dx*dx + dy*dy;
+                }
+
+                float minDistance = 65536.0f;
+                if (seedCount > 0) minDistance = (float)fmin(minDistance, sqrt((double)minSquared));
+
+                // I made this up, but it seems to give good results at all tile sizes
+                int intensity = (int)(minDistance*256.0f/tileSize);
+                if (intensity > 255) intensity = 255;
+
+                job->pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
+            }
+        }
+    }
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Premultiply alpha of pixels range, required by ImageAlphaPremultiply()
+static void ImageAlphaPremultiplyRange(void *data, int start, int end)
+{
+    Color *pixels = (Color *)((ImageJob *)data)->output;
+    float alpha = 0.0f;
+
+    for (int i = start; i < end; i++)
+    {
+        if (pixels[i].a == 0)
+        {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+        }
+        else if (pixels[i].a < 255)
+        {
+            alpha = (float)pixels[i].a/255.0f;
+            pixels[i].r = (unsigned char)((float)pixels[i].r*alpha);
+            pixels[i].g = (unsigned char)((float)pixels[i].g*alpha);
+            pixels[i].b = (unsigned char)((float)pixels[i].b*alpha);
+        }
+    }
+}
+
+// Check if convolution kernel is separable (rank 1): kernel[row*kernelWidth + column] = kernelColumn[row]*kernelRow[column]
+static bool IsKernelSeparable(const float *kernel, int kernelWidth, float *kernelRow, float *kernelColumn)
+{
+    // Pivot is the largest kernel value, it defines the row and column factors
+    int pivot = 0;
+    float maxValue = 0.0f;
+
+    for (int i = 0; i < kernelWidth*kernelWidth; i++)
+    {
+        if (fabsf(kernel[i]) > maxValue) { maxValue = fabsf(kernel[i]); pivot = i; }
+    }
+
+    if (maxValue == 0.0f) return false;
+
+    int pivotRow = pivot/kernelWidth;
+    int pivotColumn = pivot%kernelWidth;
+
+    for (int i = 0; i < kernelWidth; i++)
+    {
+        kernelRow[i] = kernel[pivotRow*kernelWidth + i];
+        kernelColumn[i] = kernel[i*kernelWidth + pivotColumn]/kernel[pivot];
+    }
+
+    for (int y = 0; y < kernelWidth; y++)
+    {
+        for (int x = 0; x < kernelWidth; x++)
+        {
+            if (fabsf(kernelColumn[y]*kernelRow[x] - kernel[y*kernelWidth + x]) > (maxValue*KERNEL_SEPARABLE_EPSILON)) return false;
+        }
+    }
+
+    return true;
+}
+
+// Get convolution result color from accumulated normalized values
+// NOTE: Color channels are clamped to [0..1], alpha is not
+static Color GetConvolutionColor(float r, float g, float b, float a)
+{
+    if (r < 0.0f) r = 0.0f;
+    if (g < 0.0f) g = 0.0f;
+    if (b < 0.0f) b = 0.0f;
+
+    if (r > 1.0f) r = 1.0f;
+    if (g > 1.0f) g = 1.0f;
+    if (b > 1.0f) b = 1.0f;
+
+    return (Color){ (unsigned char)(r*255.0f), (unsigned char)(g*255.0f), (unsigned char)(b*255.0f), (unsigned char)(a*255.0f) };
+}
+
+// Accumulate kernel weighted samples: input[index + k*stride]*kernel[k] for every kernel tap
+// NOTE: Samples out of input data [0..count) are considered zero
+static inline Vector4 ConvolveSamples(const Vector4 *input, int count, int index, int stride, const float *kernel, int taps)
+{
+    Vector4 result = { 0 };
+    int first = 0;
+    int last = taps;
+
+    // Limit kernel taps to input data
+    if (index < 0) first = (-index + stride - 1)/stride;
+    if ((index + (last - 1)*stride) >= count) last = (count - index + stride - 1)/stride;
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+    __m128 accumulator = _mm_setzero_ps();
+
+    for (int k = first; k < last; k++) accumulator = _mm_add_ps(accumulator, _mm_mul_ps(_mm_loadu_ps(&input[index + k*stride].x), _mm_set1_ps(kernel[k])));
+
+    _mm_storeu_ps(&result.x, accumulator);
+#else
+    for (int k = first; k < last; k++)
+    {
+        const Vector4 *sample = &input[index + k*stride];
+
+        result.x += sample->x*kernel[k];
+        result.y += sample->y*kernel[k];
+        result.z += sample->z*kernel[k];
+        result.w += sample->w*kernel[k];
+    }
+#endif
+
+    return result;
+}
+
+// Convolve rows range with kernel, required by ImageKernelConvolution()
+// NOTE: Samples are accumulated in the same order for every pixel, result is independent of ranges split
+static void ImageKernelConvolutionRange(void *data, int start, int end)
+{
+    ConvolutionJob *job = (ConvolutionJob *)data;
+    const Vector4 *pixels = job->normalized;
+    const float *kernel = job->kernel;
+    int width = job->width;
+    int pixelCount = job->width*job->height;
+    int kernelWidth = job->kernelWidth;
+    int startRange = job->startRange;
+    int endRange = job->endRange;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            __m128 accumulator = _mm_setzero_ps();
+        #else
+            Vector4 accumulator = { 0 };
+        #endif
+
+            for (int yk = startRange; yk < endRange; yk++)
+            {
+                const float *kernelRow = kernel + kernelWidth*(yk + kernelWidth/2) + kernelWidth/2;
+
+                for (int xk = startRange; xk < endRange; xk++)
+                {
+                    unsigned int index = width*(y + yk) + (x + xk);
+
+                    if (index >= (unsigned int)pixelCount) continue;
+
+                #if defined(RL_TEXTURES_SIMD_SSE2)
+                    accumulator = _mm_add_ps(accumulator, _mm_mul_ps(_mm_loadu_ps(&pixels[index].x), _mm_set1_ps(kernelRow[xk])));
+                #else
+                    accumulator.x += pixels[index].x*kernelRow[xk];
+                    accumulator.y += pixels[index].y*kernelRow[xk];
+                    accumulator.z += pixels[index].z*kernelRow[xk];
+                    accumulator.w += pixels[index].w*kernelRow[xk];
+                #endif
+                }
+            }
+
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            float result[4] = { 0 };
+            _mm_storeu_ps(result, accumulator);
+            job->output[width*y + x] = GetConvolutionColor(result[0], result[1], result[2], result[3]);
+        #else
+            job->output[width*y + x] = GetConvolutionColor(accumulator.x, accumulator.y, accumulator.z, accumulator.w);
+        #endif
+        }
+    }
+}
+
+// Convolve padded rows range with separable kernel row (horizontal pass), required by ImageKernelConvolution()
+static void ImageConvolutionRowsRange(void *data, int start, int end)
+{
+    ConvolutionJob *job = (ConvolutionJob *)data;
+    int width = job->width;
+    int pixelCount = job->width*job->height;
+
+    // Padded row 0 matches image row startRange
+    for (int i = start*width; i < end*width; i++)
+    {
+        job->rows[i] = ConvolveSamples(job->normalized, pixelCount, i + job->startRange*width + job->startRange, 1, job->kernelRow, job->kernelWidth);
+    }
+}
+
+// Convolve rows range with separable kernel column (vertical pass), required by ImageKernelConvolution()
+static void ImageConvolutionColumnsRange(void *data, int start, int end)
+{
+    ConvolutionJob *job = (ConvolutionJob *)data;
+    int width = job->width;
+    int paddedCount = (job->height + job->kernelWidth - 1)*width;
+
+    for (int i = start*width; i < end*width; i++)
+    {
+        Vector4 result = ConvolveSamples(job->rows, paddedCount, i, width, job->kernelColumn, job->kernelWidth);
+
+        job->output[i] = GetConvolutionColor(result.x, result.y, result.z, result.w);
+    }
+}
+
+// Sum box window for padded rows range (horizontal pass), required by ImageKernelConvolution()
+// NOTE: Window sums are updated incrementally along every range, integer sums are exact
+static void ImageBoxSumRowsRange(void *data, int start, int end)
+{
+    ConvolutionJob *job = (ConvolutionJob *)data;
+    const unsigned char *pixels = (const unsigned char *)job->pixels;
+    int width = job->width;
+    int pixelCount = job->width*job->height;
+    int sum[4] = { 0 };
+
+    // Padded row 0 matches image row startRange, window first sample for every output
+    int first = start*width + job->startRange*width + job->startRange;
+
+    for (int k = 0; k < (job->kernelWidth - 1); k++)
+    {
+        if (((first + k) >= 0) && ((first + k) < pixelCount)) for (int c = 0; c < 4; c++) sum[c] += pixels[(first + k)*4 + c];
+    }
+
+    for (int i = start*width; i < end*width; i++, first++)
+    {
+        int next = first + job->kernelWidth - 1;
+
+        if ((next >= 0) && (next < pixelCount)) for (int c = 0; c < 4; c++) sum[c] += pixels[next*4 + c];
+        for (int c = 0; c < 4; c++) job->sums[i*4 + c] = sum[c];
+        if ((first >= 0) && (first < pixelCount)) for (int c = 0; c < 4; c++) sum[c] -= pixels[first*4 + c];
+    }
+}
+
+// Sum box window for rows range (vertical pass), required by ImageKernelConvolution()
+// NOTE: Column sums are updated incrementally along every range, adding next padded row and removing previous one
+static void ImageBoxSumColumnsRange(void *data, int start, int end)
+{
+    ConvolutionJob *job = (ConvolutionJob *)data;
+    int width = job->width;
+    int kernelWidth = job->kernelWidth;
+    float factor = job->kernel[0]/255.0f;
+    int *sum = (int *)RL_CALLOC(width*4, sizeof(int));
+
+    for (int k = 0; k < (kernelWidth - 1); k++)
+    {
+        const int *row = job->sums + (start + k)*width*4;
+        for (int i = 0; i < width*4; i++) sum[i] += row[i];
+    }
+
+    for (int y = start; y < end; y++)
+    {
+        const int *next = job->sums + (y + kernelWidth - 1)*width*4;
+        const int *previous = job->sums + y*width*4;
+
+        for (int i = 0; i < width*4; i++) sum[i] += next[i];
+
+        for (int x = 0; x < width; x++)
+        {
+            job->output[y*width + x] = GetConvolutionColor((float)sum[x*4]*factor, (float)sum[x*4 + 1]*factor, (float)sum[x*4 + 2]*factor, (float)sum[x*4 + 3]*factor);
+        }
+
+        for (int i = 0; i < width*4; i++) sum[i] -= previous[i];
+    }
+
+    RL_FREE(sum);
+}
+
+// Get mipmap filter taps for every destination pixel of one axis, source indices are clamped to size
+// NOTE: Box filter averages 2 pixels, or 3 area weighted pixels for odd sizes, Kaiser filter taps are normalized
+static void GetMipmapTaps(int size, int newSize, int filter, int taps, int *indices, float *weights)
+{
+    float ratio = (float)size/newSize;
+
+    for (int i = 0; i < newSize; i++)
+    {
+        int *index = indices + i*taps;
+        float *weight = weights + i*taps;
+
+        for (int t = 0; t < taps; t++) { index[t] = 0; weight[t] = 0.0f; }
+
+        if (filter == MIPMAP_FILTER_KAISER)
+        {
+            float center = ((float)i + 0.5f)*ratio - 0.5f;
+            int first = (int)floorf(center - MIPMAP_KAISER_RADIUS*ratio) + 1;
+            float total = 0.0f;
+
+            for (int t = 0; t < taps; t++)
+            {
+                float distance = ((float)(first + t) - center)/ratio;
+
+                index[t] = first + t;
+                if (index[t] < 0) index[t] = 0;
+                if (index[t] > (size - 1)) index[t] = size - 1;
+
+                if (fabsf(distance) < MIPMAP_KAISER_RADIUS)
+                {
+                    // Windowed sinc: sinc(x)*I0(alpha*sqrt(1 - (x/radius)^2))/I0(alpha)
+                    float window = distance/MIPMAP_KAISER_RADIUS;
+                    float sinc = (distance == 0.0f)? 1.0f : sinf(PI*distance)/(PI*distance);
+                    float argument = MIPMAP_KAISER_ALPHA*sqrtf(1.0f - window*window)*0.5f;
+                    float bessel = 1.0f;
+                    float term = 1.0f;
+
+                    // Modified Bessel function of the first kind (I0) series, I0(alpha) is normalized out
+                    for (int k = 1; k < 16; k++)
+                    {
+                        term *= argument/k;
+                        bessel += term*term;
+                    }
+
+                    weight[t] = sinc*bessel;
+                    total += weight[t];
+                }
+            }
+
+            for (int t = 0; t < taps; t++) weight[t] /= total;
+        }
+        else if (size == newSize)
+        {
+            index[0] = i;
+            weight[0] = 1.0f;
+        }
+        else if ((size%2) == 0)
+        {
+            index[0] = 2*i;
+            index[1] = 2*i + 1;
+            weight[0] = 0.5f;
+            weight[1] = 0.5f;
+        }
+        else
+        {
+            // Odd size: size = 2*newSize + 1, every destination pixel covers 3 source pixels partially
+            index[0] = 2*i;
+            index[1] = 2*i + 1;
+            index[2] = 2*i + 2;
+            weight[0] = (float)(newSize - i)/size;
+            weight[1] = (float)newSize/size;
+            weight[2] = (float)(i + 1)/size;
+        }
+    }
+}
+
+// Generate mipmap level rows range from previous level, required by ImageMipmapsEx()
+static void ImageMipmapRowsRange(void *data, int start, int end)
+{
+    MipmapJob *job = (MipmapJob *)data;
+    int channels = job->channels;
+    int rowSize = job->width*channels;
+    int taps = job->taps;
+
+    if (job->box)
+    {
+        // Even size box filter: rounded average of 2x2 pixels
+        for (int y = start; y < end; y++)
+        {
+            const unsigned char *top = job->input + 2*y*rowSize;
+            const unsigned char *bottom = top + rowSize;
+            unsigned char *output = job->output + y*job->newWidth*channels;
+            int x = 0;
+
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            if (channels == 4)
+            {
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i round = _mm_set1_epi16(2);
+
+                // 4 source pixels per row are averaged into 2 destination pixels
+                for (; (x + 2) <= job->newWidth; x += 2)
+                {
+                    __m128i rowTop = _mm_loadu_si128((const __m128i *)(top + x*8));
+                    __m128i rowBottom = _mm_loadu_si128((const __m128i *)(bottom + x*8));
+                    __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(rowTop, zero), _mm_unpacklo_epi8(rowBottom, zero));
+                    __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(rowTop, zero), _mm_unpackhi_epi8(rowBottom, zero));
+                    __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(low, high), _mm_unpackhi_epi64(low, high));
+
+                    sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+                    _mm_storel_epi64((__m128i *)(output + x*4), _mm_packus_epi16(sum, zero));
+                }
+            }
+        #endif
+            for (; x < job->newWidth; x++)
+            {
+                for (int c = 0; c < channels; c++)
+                {
+                    int left = 2*x*channels + c;
+                    output[x*channels + c] = (unsigned char)((top[left] + top[left + channels] + bottom[left] + bottom[left + channels] + 2) >> 2);
+                }
+            }
+        }
+
+        return;
+    }
+
+    // Rows are accumulated as linear values, then columns taps are applied
+    float *accumulator = (float *)RL_MALLOC(rowSize*sizeof(float));
+    const float **decode = job->decode;
+    const unsigned char **encode = job->encode;
+
+    for (int y = start; y < end; y++)
+    {
+        memset(accumulator, 0, rowSize*sizeof(float));
+
+        for (int t = 0; t < taps; t++)
+        {
+            float weight = job->rowWeights[y*taps + t];
+            if (weight == 0.0f) continue;
+
+            const unsigned char *row = job->input + job->rows[y*taps + t]*rowSize;
+
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            if (channels == 4)
+            {
+                __m128 factor = _mm_set1_ps(weight);
+
+                for (int i = 0; i < rowSize; i += 4)
+                {
+                    __m128 value = _mm_set_ps(decode[3][row[i + 3]], decode[2][row[i + 2]], decode[1][row[i + 1]], decode[0][row[i]]);
+                    _mm_storeu_ps(accumulator + i, _mm_add_ps(_mm_loadu_ps(accumulator + i), _mm_mul_ps(value, factor)));
+                }
+
+                continue;
+            }
+        #endif
+            for (int i = 0; i < rowSize; i += channels)
+            {
+                for (int c = 0; c < channels; c++) accumulator[i + c] += decode[c][row[i + c]]*weight;
+            }
+        }
+
+        unsigned char *output = job->output + y*job->newWidth*channels;
+
+        for (int x = 0; x < job->newWidth; x++)
+        {
+            float value[4] = { 0 };
+
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            if (channels == 4)
+            {
+                __m128 sum = _mm_setzero_ps();
+                for (int t = 0; t < taps; t++) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(accumulator + job->columns[x*taps + t]*4), _mm_set1_ps(job->columnWeights[x*taps + t])));
+                _mm_storeu_ps(value, sum);
+            }
+            else
+        #endif
+            {
+                for (int t = 0; t < taps; t++)
+                {
+                    const float *sample = accumulator + job->columns[x*taps + t]*channels;
+                    float weight = job->columnWeights[x*taps + t];
+
+                    for (int c = 0; c < channels; c++) value[c] += sample[c]*weight;
+                }
+            }
+
+            for (int c = 0; c < channels; c++)
+            {
+                int index = (int)(value[c]*(MIPMAP_ENCODE_TABLE_SIZE - 1) + 0.5f);
+
+                if (index < 0) index = 0;
+                if (index > (MIPMAP_ENCODE_TABLE_SIZE - 1)) index = MIPMAP_ENCODE_TABLE_SIZE - 1;
+
+                output[x*channels + c] = encode[c][index];
+            }
+        }
+    }
+
+    RL_FREE(accumulator);
+}
+
+// Scale mipmap level alpha to match alpha test coverage (ratio of pixels with alpha > cutoff)
+// NOTE: Alpha is the last channel, scale is found by bisection over level alpha histogram
+static void ScaleAlphaCoverage(unsigned char *pixels, int count, int channels, int cutoff, float coverage)
+{
+    int histogram[256] = { 0 };
+    for (int i = 0; i < count; i++) histogram[pixels[i*channels + channels - 1]]++;
+
+    // Scales range: coverage(low) < coverage <= coverage(high)
+    float scales[2] = { 0.0f, 255.0f };
+    float covered[2] = { 0.0f, 1.0f };
+
+    for (int i = 0; i < 20; i++)
+    {
+        float scale = (scales[0] + scales[1])*0.5f;
+        int passed = 0;
+
+        // NOTE: Scaled alpha is rounded as stored
+        for (int a = 1; a < 256; a++)
+        {
+            if ((int)((float)a*scale + 0.5f) > cutoff) passed += histogram[a];
+        }
+
+        int side = (((float)passed/count) < coverage)? 0 : 1;
+        scales[side] = scale;
+        covered[side] = (float)passed/count;
+    }
+
+    float scale = ((coverage - covered[0]) < (covered[1] - coverage))? scales[0] : scales[1];
+    unsigned char alpha[256] = { 0 };
+
+    for (int a = 0; a < 256; a++)
+    {
+        float value = (float)a*scale + 0.5f;
+        alpha[a] = (value > 255.0f)? 255 : (unsigned char)value;
+    }
+
+    for (int i = 0; i < count; i++) pixels[i*channels + channels - 1] = alpha[pixels[i*channels + channels - 1]];
+}
+
+// Dither image rows, required by ImageDither()
+// NOTE: Rows are processed as a wavefront, every row following the previous one 3 pixels behind,
+// error diffusion only adds non-negative saturated values, so result does not depend on threads count
+static void ImageDitherRows(void *data, int start, int end)
+{
+    DitherJob *job = (DitherJob *)data;
+    Color *pixels = job->pixels;
+    int width = job->width;
+    int height = job->height;
+    int rBpp = job->rBpp;
+    int gBpp = job->gBpp;
+    int bBpp = job->bBpp;
+    int aBpp = job->aBpp;
+
+    Color oldPixel = WHITE;
+    Color newPixel = WHITE;
+
+    int rError, gError, bError;
+    unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
+
+    // Rows are requested in order, any previous row is already assigned to a running thread
+    for (int y = AtomicAdd(&job->nextRow, 1); y < height; y = AtomicAdd(&job->nextRow, 1))
+    {
+        int ready = 0;      // Previous row processed pixels
+
+        for (int x = 0; x < width; x++)
+        {
+            // Wait for previous row to be processed up to 2 pixels ahead,
+            // required to get all its error contributions and avoid writing same pixels
+            if (y > 0)
+            {
+                int required = ((x + 3) < width)? (x + 3) : width;
+                while (ready < required)
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+                    ready = AtomicLoad(&job->progress[y - 1]);
+                    if (ready < required) YieldThread();
+                }
+            }
+
+            oldPixel = pixels[y*width + x];
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+            // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
+            newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+            newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+            newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+            newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
 
-                    k += 4;
-                } break;
-                default: break;
+            // NOTE: Error must be computed between new and old pixel but using same number of bits!
+            // We want to know how much color precision we have lost...
+            rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+            gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+            bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+
+            pixels[y*width + x] = newPixel;
+
+            // NOTE: Some cases are out of the array and should be ignored
+            if (x < (width - 1))
+            {
+                pixels[y*width + x+1].r = MIN((int)pixels[y*width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                pixels[y*width + x+1].g = MIN((int)pixels[y*width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                pixels[y*width + x+1].b = MIN((int)pixels[y*width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+            }
+
+            if ((x > 0) && (y < (height - 1)))
+            {
+                pixels[(y+1)*width + x-1].r = MIN((int)pixels[(y+1)*width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                pixels[(y+1)*width + x-1].g = MIN((int)pixels[(y+1)*width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                pixels[(y+1)*width + x-1].b = MIN((int)pixels[(y+1)*width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+            }
+
+            if (y < (height - 1))
+            {
+                pixels[(y+1)*width + x].r = MIN((int)pixels[(y+1)*width + x].r + (int)((float)rError*5.0f/16), 0xff);
+                pixels[(y+1)*width + x].g = MIN((int)pixels[(y+1)*width + x].g + (int)((float)gError*5.0f/16), 0xff);
+                pixels[(y+1)*width + x].b = MIN((int)pixels[(y+1)*width + x].b + (int)((float)bError*5.0f/16), 0xff);
+            }
+
+            if ((x < (width - 1)) && (y < (height - 1)))
+            {
+                pixels[(y+1)*width + x+1].r = MIN((int)pixels[(y+1)*width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                pixels[(y+1)*width + x+1].g = MIN((int)pixels[(y+1)*width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                pixels[(y+1)*width + x+1].b = MIN((int)pixels[(y+1)*width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
             }
+
+            rPixel = (unsigned short)newPixel.r;
+            gPixel = (unsigned short)newPixel.g;
+            bPixel = (unsigned short)newPixel.b;
+            aPixel = (unsigned short)newPixel.a;
+
+            job->output[y*width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+
+            if (((x + 1)%DITHER_PROGRESS_STEP) == 0) AtomicStore(&job->progress[y], x + 1);
         }
+
+        AtomicStore(&job->progress[y], width);
     }
+}
 
-    return pixels;
+// Tint pixels range, required by ImageColorTint()
+static void ImageColorTintRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Color *pixels = (Color *)job->output;
+
+    float cR = (float)job->color.r/255;
+    float cG = (float)job->color.g/255;
+    float cB = (float)job->color.b/255;
+    float cA = (float)job->color.a/255;
+
+    for (int i = start; i < end; i++)
+    {
+        unsigned char r = (unsigned char)(((float)pixels[i].r/255*cR)*255.0f);
+        unsigned char g = (unsigned char)(((float)pixels[i].g/255*cG)*255.0f);
+        unsigned char b = (unsigned char)(((float)pixels[i].b/255*cB)*255.0f);
+        unsigned char a = (unsigned char)(((float)pixels[i].a/255*cA)*255.0f);
+
+        pixels[i].r = r;
+        pixels[i].g = g;
+        pixels[i].b = b;
+        pixels[i].a = a;
+    }
+}
+
+// Invert pixels range, required by ImageColorInvert()
+static void ImageColorInvertRange(void *data, int start, int end)
+{
+    Color *pixels = (Color *)((ImageJob *)data)->output;
+
+    for (int i = start; i < end; i++)
+    {
+        pixels[i].r = 255 - pixels[i].r;
+        pixels[i].g = 255 - pixels[i].g;
+        pixels[i].b = 255 - pixels[i].b;
+    }
+}
+
+// Adjust contrast of pixels range, required by ImageColorContrast()
+static void ImageColorContrastRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Color *pixels = (Color *)job->output;
+    float contrast = job->factor;
+
+    for (int i = start; i < end; i++)
+    {
+        float pR = (float)pixels[i].r/255.0f;
+        pR -= 0.5f;
+        pR *= contrast;
+        pR += 0.5f;
+        pR *= 255;
+        if (pR < 0) pR = 0;
+        if (pR > 255) pR = 255;
+
+        float pG = (float)pixels[i].g/255.0f;
+        pG -= 0.5f;
+        pG *= contrast;
+        pG += 0.5f;
+        pG *= 255;
+        if (pG < 0) pG = 0;
+        if (pG > 255) pG = 255;
+
+        float pB = (float)pixels[i].b/255.0f;
+        pB -= 0.5f;
+        pB *= contrast;
+        pB += 0.5f;
+        pB *= 255;
+        if (pB < 0) pB = 0;
+        if (pB > 255) pB = 255;
+
+        pixels[i].r = (unsigned char)pR;
+        pixels[i].g = (unsigned char)pG;
+        pixels[i].b = (unsigned char)pB;
+    }
+}
+
+// Adjust brightness of pixels range, required by ImageColorBrightness()
+static void ImageColorBrightnessRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Color *pixels = (Color *)job->output;
+    int brightness = job->value;
+
+    for (int i = start; i < end; i++)
+    {
+        int cR = pixels[i].r + brightness;
+        int cG = pixels[i].g + brightness;
+        int cB = pixels[i].b + brightness;
+
+        if (cR < 0) cR = 1;
+        if (cR > 255) cR = 255;
+
+        if (cG < 0) cG = 1;
+        if (cG > 255) cG = 255;
+
+        if (cB < 0) cB = 1;
+        if (cB > 255) cB = 255;
+
+        pixels[i].r = (unsigned char)cR;
+        pixels[i].g = (unsigned char)cG;
+        pixels[i].b = (unsigned char)cB;
+    }
+}
+
+// Replace color of pixels range, required by ImageColorReplace()
+static void ImageColorReplaceRange(void *data, int start, int end)
+{
+    ImageJob *job = (ImageJob *)data;
+    Color *pixels = (Color *)job->output;
+    Color color = job->color;
+    Color replace = job->replace;
+
+    for (int i = start; i < end; i++)
+    {
+        if ((pixels[i].r == color.r) &&
+            (pixels[i].g == color.g) &&
+            (pixels[i].b == color.b) &&
+            (pixels[i].a == color.a))
+        {
+            pixels[i].r = replace.r;
+            pixels[i].g = replace.g;
+            pixels[i].b = replace.b;
+            pixels[i].a = replace.a;
+        }
+    }
+}
+
+// Rotate image 90 degrees, image format must be uncompressed
+// NOTE: Square images are rotated in-place (transposed and flipped), otherwise rotated image
+// is written by tiles from source tiles (cache blocking)
+static void ImageRotate90(Image *image, bool clockwise)
+{
+    int tileSize = IMAGE_TRANSFORM_TILE_SIZE;
+
+    TransformJob job = { 0 };
+    job.input = (const unsigned char *)image->data;
+    job.width = image->width;
+    job.height = image->height;
+    job.newWidth = image->height;
+    job.newHeight = image->width;
+    job.bytesPerPixel = GetPixelDataSize(1, 1, image->format);
+    job.clockwise = clockwise;
+
+    int tileRows = (image->height + tileSize - 1)/tileSize;
+    int tileGrain = IMAGE_JOB_MIN_PIXELS/(tileSize*image->width) + 1;
+
+    if (image->width == image->height)
+    {
+        // Clockwise rotation is transposition and horizontal flip,
+        // counter-clockwise rotation is transposition and vertical flip
+        job.output = (unsigned char *)image->data;
+
+        ParallelFor(tileRows, tileGrain, ImageTransposeTilesRange, &job);
+
+        if (clockwise) ParallelFor(image->height, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageFlipHorizontalRange, &job);
+        else ParallelFor(image->height/2, IMAGE_JOB_MIN_PIXELS/image->width + 1, ImageFlipVerticalRange, &job);
+    }
+    else
+    {
+        job.output = (unsigned char *)RL_MALLOC(image->width*image->height*job.bytesPerPixel);
+
+        ParallelFor(tileRows, tileGrain, ImageRotateTilesRange, &job);
+
+        RL_FREE(image->data);
+        image->data = job.output;
+        image->width = job.newWidth;
+        image->height = job.newHeight;
+    }
+}
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+// Reverse 16 bytes order
+static inline __m128i ReverseEpi8(__m128i value)
+{
+    value = _mm_shuffle_epi32(value, _MM_SHUFFLE(0, 1, 2, 3));
+    value = _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+
+    return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+}
+#endif
+
+// Swap pixels going forward from first with pixels going backward from last, used to reverse pixels order
+// NOTE: Swapped pixels ranges must not overlap
+static void SwapPixelsReversed(unsigned char *first, unsigned char *last, int count, int bytesPerPixel)
+{
+    int i = 0;
+
+    switch (bytesPerPixel)
+    {
+        case 1:
+        {
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            for (; (i + 16) <= count; i += 16)
+            {
+                __m128i a = _mm_loadu_si128((const __m128i *)(first + i));
+                __m128i b = _mm_loadu_si128((const __m128i *)(last - i - 15));
+                _mm_storeu_si128((__m128i *)(first + i), ReverseEpi8(b));
+                _mm_storeu_si128((__m128i *)(last - i - 15), ReverseEpi8(a));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned char pixel = first[i];
+                first[i] = last[-i];
+                last[-i] = pixel;
+            }
+        } break;
+        case 4:
+        {
+        #if defined(RL_TEXTURES_SIMD_SSE2)
+            for (; (i + 4) <= count; i += 4)
+            {
+                __m128i a = _mm_loadu_si128((const __m128i *)(first + i*4));
+                __m128i b = _mm_loadu_si128((const __m128i *)(last - (i + 3)*4));
+                _mm_storeu_si128((__m128i *)(first + i*4), _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 1, 2, 3)));
+                _mm_storeu_si128((__m128i *)(last - (i + 3)*4), _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 1, 2, 3)));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                unsigned int pixel = 0;
+                memcpy(&pixel, first + i*4, 4);
+                memcpy(first + i*4, last - i*4, 4);
+                memcpy(last - i*4, &pixel, 4);
+            }
+        } break;
+        default:
+        {
+            unsigned char pixel[16] = { 0 };
+
+            for (; i < count; i++)
+            {
+                memcpy(pixel, first + i*bytesPerPixel, bytesPerPixel);
+                memcpy(first + i*bytesPerPixel, last - i*bytesPerPixel, bytesPerPixel);
+                memcpy(last - i*bytesPerPixel, pixel, bytesPerPixel);
+            }
+        } break;
+    }
+}
+
+// Copy pixels block transposed: source pixel at row i, column j is written to destination row j, column i
+// NOTE: Destination stride can be negative (destination rows going up), reverse writes destination
+// columns from right to left (dst points to destination pixel of source first pixel)
+static void TransposePixelsBlock(const unsigned char *src, int srcStride, unsigned char *dst, int dstStride, bool reverse, int width, int height, int bytesPerPixel)
+{
+    int y = 0;
+
+#if defined(RL_TEXTURES_SIMD_SSE2)
+    // NOTE: Reversed destination columns are written loading source rows in reverse order
+    if (bytesPerPixel == 4)
+    {
+        // 4x4 pixels micro-kernel, every source row is loaded as a vector
+        for (; (y + 4) <= height; y += 4)
+        {
+            const unsigned char *row = src + (reverse? (y + 3) : y)*srcStride;
+            int rowStep = reverse? -srcStride : srcStride;
+            unsigned char *output = dst + (reverse? -(y + 3) : y)*4;
+            int x = 0;
+
+            for (; (x + 4) <= width; x += 4)
+            {
+                __m128i r0 = _mm_loadu_si128((const __m128i *)(row + x*4));
+                __m128i r1 = _mm_loadu_si128((const __m128i *)(row + rowStep + x*4));
+                __m128i r2 = _mm_loadu_si128((const __m128i *)(row + 2*rowStep + x*4));
+                __m128i r3 = _mm_loadu_si128((const __m128i *)(row + 3*rowStep + x*4));
+
+                __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+                __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+                __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+                __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+                _mm_storeu_si128((__m128i *)(output + x*dstStride), _mm_unpacklo_epi64(t0, t1));
+                _mm_storeu_si128((__m128i *)(output + (x + 1)*dstStride), _mm_unpackhi_epi64(t0, t1));
+                _mm_storeu_si128((__m128i *)(output + (x + 2)*dstStride), _mm_unpacklo_epi64(t2, t3));
+                _mm_storeu_si128((__m128i *)(output + (x + 3)*dstStride), _mm_unpackhi_epi64(t2, t3));
+            }
+
+            for (; x < width; x++)
+            {
+                for (int k = 0; k < 4; k++) memcpy(output + x*dstStride + k*4, row + k*rowStep + x*4, 4);
+            }
+        }
+    }
+    else if (bytesPerPixel == 1)
+    {
+        // 8x8 pixels micro-kernel, every source row is loaded as 8 bytes
+        for (; (y + 8) <= height; y += 8)
+        {
+            const unsigned char *row = src + (reverse? (y + 7) : y)*srcStride;
+            int rowStep = reverse? -srcStride : srcStride;
+            unsigned char *output = dst + (reverse? -(y + 7) : y);
+            int x = 0;
+
+            for (; (x + 8) <= width; x += 8)
+            {
+                __m128i b0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(row + x)), _mm_loadl_epi64((const __m128i *)(row + rowStep + x)));
+                __m128i b1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(row + 2*rowStep + x)), _mm_loadl_epi64((const __m128i *)(row + 3*rowStep + x)));
+                __m128i b2 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(row + 4*rowStep + x)), _mm_loadl_epi64((const __m128i *)(row + 5*rowStep + x)));
+                __m128i b3 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(row + 6*rowStep + x)), _mm_loadl_epi64((const __m128i *)(row + 7*rowStep + x)));
+
+                __m128i c0 = _mm_unpacklo_epi16(b0, b1);
+                __m128i c1 = _mm_unpackhi_epi16(b0, b1);
+                __m128i c2 = _mm_unpacklo_epi16(b2, b3);
+                __m128i c3 = _mm_unpackhi_epi16(b2, b3);
+
+                __m128i d0 = _mm_unpacklo_epi32(c0, c2);
+                __m128i d1 = _mm_unpackhi_epi32(c0, c2);
+                __m128i d2 = _mm_unpacklo_epi32(c1, c3);
+                __m128i d3 = _mm_unpackhi_epi32(c1, c3);
+
+                _mm_storel_epi64((__m128i *)(output + x*dstStride), d0);
+                _mm_storel_epi64((__m128i *)(output + (x + 1)*dstStride), _mm_unpackhi_epi64(d0, d0));
+                _mm_storel_epi64((__m128i *)(output + (x + 2)*dstStride), d1);
+                _mm_storel_epi64((__m128i *)(output + (x + 3)*dstStride), _mm_unpackhi_epi64(d1, d1));
+                _mm_storel_epi64((__m128i *)(output + (x + 4)*dstStride), d2);
+                _mm_storel_epi64((__m128i *)(output + (x + 5)*dstStride), _mm_unpackhi_epi64(d2, d2));
+                _mm_storel_epi64((__m128i *)(output + (x + 6)*dstStride), d3);
+                _mm_storel_epi64((__m128i *)(output + (x + 7)*dstStride), _mm_unpackhi_epi64(d3, d3));
+            }
+
+            for (; x < width; x++)
+            {
+                for (int k = 0; k < 8; k++) output[x*dstStride + k] = row[k*rowStep + x];
+            }
+        }
+    }
+#endif
+
+    // Remaining rows, pixel by pixel
+    for (; y < height; y++)
+    {
+        const unsigned char *row = src + y*srcStride;
+        unsigned char *output = dst + (reverse? -y : y)*bytesPerPixel;
+
+        switch (bytesPerPixel)
+        {
+            case 1: for (int x = 0; x < width; x++) output[x*dstStride] = row[x]; break;
+            case 2: for (int x = 0; x < width; x++) memcpy(output + x*dstStride, row + x*2, 2); break;
+            case 4: for (int x = 0; x < width; x++) memcpy(output + x*dstStride, row + x*4, 4); break;
+            default: for (int x = 0; x < width; x++) memcpy(output + x*dstStride, row + x*bytesPerPixel, bytesPerPixel); break;
+        }
+    }
+}
+
+// Swap rows pairs range (top half rows), required by ImageFlipVertical()
+static void ImageFlipVerticalRange(void *data, int start, int end)
+{
+    TransformJob *job = (TransformJob *)data;
+    int rowSize = job->width*job->bytesPerPixel;
+    unsigned char buffer[1024] = { 0 };
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *top = job->output + y*rowSize;
+        unsigned char *bottom = job->output + (job->height - 1 - y)*rowSize;
+
+        for (int offset = 0; offset < rowSize; offset += (int)sizeof(buffer))
+        {
+            int size = MIN(rowSize - offset, (int)sizeof(buffer));
+
+            memcpy(buffer, top + offset, size);
+            memcpy(top + offset, bottom + offset, size);
+            memcpy(bottom + offset, buffer, size);
+        }
+    }
+}
+
+// Reverse pixels of rows range, required by ImageFlipHorizontal()
+static void ImageFlipHorizontalRange(void *data, int start, int end)
+{
+    TransformJob *job = (TransformJob *)data;
+    int rowSize = job->width*job->bytesPerPixel;
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *row = job->output + y*rowSize;
+        SwapPixelsReversed(row, row + (job->width - 1)*job->bytesPerPixel, job->width/2, job->bytesPerPixel);
+    }
+}
+
+// Swap pixels range (first half pixels) with mirrored pixels, required by ImageRotate() 180 degrees
+static void ImageReverseRange(void *data, int start, int end)
+{
+    TransformJob *job = (TransformJob *)data;
+    int last = job->width*job->height - 1;
+
+    SwapPixelsReversed(job->output + start*job->bytesPerPixel, job->output + (last - start)*job->bytesPerPixel, end - start, job->bytesPerPixel);
+}
+
+// Rotate source tiles rows range 90 degrees into destination, required by ImageRotate90()
+static void ImageRotateTilesRange(void *data, int start, int end)
+{
+    TransformJob *job = (TransformJob *)data;
+    int bytesPerPixel = job->bytesPerPixel;
+    int srcStride = job->width*bytesPerPixel;
+    int dstStride = job->newWidth*bytesPerPixel;
+    int tileSize = IMAGE_TRANSFORM_TILE_SIZE;
+
+    for (int tileY = start; tileY < end; tileY++)
+    {
+        int y = tileY*tileSize;
+        int tileHeight = MIN(tileSize, job->height - y);
+
+        for (int x = 0; x < job->width; x += tileSize)
+        {
+            int tileWidth = MIN(tileSize, job->width - x);
+            const unsigned char *src = job->input + y*srcStride + x*bytesPerPixel;
+
+            // Clockwise: source (x, y) goes to destination (height - 1 - y, x), source rows to destination columns right to left
+            // Counter-clockwise: source (x, y) goes to destination (y, width - 1 - x), source columns to destination rows bottom to top
+            if (job->clockwise) TransposePixelsBlock(src, srcStride, job->output + x*dstStride + (job->height - 1 - y)*bytesPerPixel, dstStride, true, tileWidth, tileHeight, bytesPerPixel);
+            else TransposePixelsBlock(src, srcStride, job->output + (job->width - 1 - x)*dstStride + y*bytesPerPixel, -dstStride, false, tileWidth, tileHeight, bytesPerPixel);
+        }
+    }
+}
+
+// Transpose square image tiles rows range in-place, required by ImageRotate90()
+// NOTE: Every tiles row swaps its tiles with tiles column below diagonal, tiles pairs are not shared between ranges
+static void ImageTransposeTilesRange(void *data, int start, int end)
+{
+    TransformJob *job = (TransformJob *)data;
+    int bytesPerPixel = job->bytesPerPixel;
+    int stride = job->width*bytesPerPixel;
+    int tileSize = IMAGE_TRANSFORM_TILE_SIZE;
+    unsigned char tile[IMAGE_TRANSFORM_TILE_SIZE*IMAGE_TRANSFORM_TILE_SIZE*16];
+
+    for (int tileY = start; tileY < end; tileY++)
+    {
+        int y = tileY*tileSize;
+        int tileHeight = MIN(tileSize, job->height - y);
+
+        for (int x = y; x < job->width; x += tileSize)
+        {
+            int tileWidth = MIN(tileSize, job->width - x);
+            unsigned char *upper = job->output + y*stride + x*bytesPerPixel;    // Tile above diagonal
+            unsigned char *lower = job->output + x*stride + y*bytesPerPixel;    // Mirrored tile below diagonal
+
+            for (int i = 0; i < tileHeight; i++) memcpy(tile + i*tileWidth*bytesPerPixel, upper + i*stride, tileWidth*bytesPerPixel);
+
+            if (x != y) TransposePixelsBlock(lower, stride, upper, stride, false, tileHeight, tileWidth, bytesPerPixel);
+            TransposePixelsBlock(tile, tileWidth*bytesPerPixel, lower, stride, false, tileWidth, tileHeight, bytesPerPixel);
+        }
+    }
+}
+
+// Rotate destination rows range by arbitrary angle, bilinear sampling, required by ImageRotate()
+// NOTE: Every byte is interpolated independently with 8 bit fractional weights, horizontally first,
+// destination is processed by tiles, so source pixels read by a tile stay in cache
+static void ImageRotateRowsRange(void *data, int start, int end)
+{
+    TransformJob *job = (TransformJob *)data;
+    const unsigned char *input = job->input;
+    int width = job->width;
+    int height = job->height;
+    int newWidth = job->newWidth;
+    int bytesPerPixel = job->bytesPerPixel;
+    int stride = width*bytesPerPixel;
+    float sinRadius = job->sinRadius;
+    float cosRadius = job->cosRadius;
+    int tileSize = IMAGE_TRANSFORM_TILE_SIZE;
+
+    for (int tileY = start; tileY < end; tileY += tileSize)
+    {
+        for (int tileX = 0; tileX < newWidth; tileX += tileSize)
+        {
+            for (int y = tileY; y < MIN(tileY + tileSize, end); y++)
+            {
+                unsigned char *output = job->output + y*newWidth*bytesPerPixel;
+
+                // Source position of destination row first pixel, moved by (cos, -sin) every destination pixel
+                float rowX = (-newWidth/2.0f)*cosRadius + (y - job->newHeight/2.0f)*sinRadius + width/2.0f;
+                float rowY = (y - job->newHeight/2.0f)*cosRadius + (newWidth/2.0f)*sinRadius + height/2.0f;
+
+                for (int x = tileX; x < MIN(tileX + tileSize, newWidth); x++)
+                {
+                    float oldX = rowX + x*cosRadius;
+                    float oldY = rowY - x*sinRadius;
+
+                    // Destination pixels outside source remain blank
+                    if ((oldX < 0.0f) || (oldX >= width) || (oldY < 0.0f) || (oldY >= height)) continue;
+
+                    int x1 = (int)oldX;
+                    int y1 = (int)oldY;
+                    int px = (int)((oldX - x1)*256.0f);
+                    int py = (int)((oldY - y1)*256.0f);
+
+                    const unsigned char *p1 = input + y1*stride + x1*bytesPerPixel;
+                    const unsigned char *p2 = (x1 < (width - 1))? p1 + bytesPerPixel : p1;
+                    const unsigned char *p3 = (y1 < (height - 1))? p1 + stride : p1;
+                    const unsigned char *p4 = (y1 < (height - 1))? p2 + stride : p2;
+
+                #if defined(RL_TEXTURES_SIMD_SSE2)
+                    if (bytesPerPixel == 4)
+                    {
+                        int c1, c2, c3, c4;
+                        memcpy(&c1, p1, 4);
+                        memcpy(&c2, p2, 4);
+                        memcpy(&c3, p3, 4);
+                        memcpy(&c4, p4, 4);
+
+                        // Left pixels in low lanes, right pixels in high lanes (16 bit)
+                        __m128i zero = _mm_setzero_si128();
+                        __m128i weightsX = _mm_set_epi16(px, px, px, px, 256 - px, 256 - px, 256 - px, 256 - px);
+                        __m128i weightsY = _mm_set_epi16(py, py, py, py, 256 - py, 256 - py, 256 - py, 256 - py);
+                        __m128i top = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(c1), _mm_cvtsi32_si128(c2)), zero), weightsX);
+                        __m128i bottom = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(c3), _mm_cvtsi32_si128(c4)), zero), weightsX);
+
+                        top = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(top, _mm_srli_si128(top, 8)), _mm_set1_epi16(128)), 8);
+                        bottom = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(bottom, _mm_srli_si128(bottom, 8)), _mm_set1_epi16(128)), 8);
+
+                        __m128i value = _mm_mullo_epi16(_mm_unpacklo_epi64(top, bottom), weightsY);
+                        value = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(value, _mm_srli_si128(value, 8)), _mm_set1_epi16(128)), 8);
+
+                        int color = _mm_cvtsi128_si32(_mm_packus_epi16(value, zero));
+                        memcpy(output + x*4, &color, 4);
+                        continue;
+                    }
+                #endif
+                    for (int i = 0; i < bytesPerPixel; i++)
+                    {
+                        int top = (p1[i]*(256 - px) + p2[i]*px + 128) >> 8;
+                        int bottom = (p3[i]*(256 - px) + p4[i]*px + 128) >> 8;
+
+                        output[x*bytesPerPixel + i] = (unsigned char)((top*(256 - py) + bottom*py + 128) >> 8);
+                    }
+                }
+            }
+        }
+    }
 }
+#endif      // SUPPORT_IMAGE_MANIPULATION
 
 #endif      // SUPPORT_MODULE_RTEXTURES
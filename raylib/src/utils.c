@@ -7,6 +7,13 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_WORKER_THREADS
+*           Use a worker threads pool to split data-parallel processing with ParallelFor(),
+*           if not defined (or threads not available on platform) all jobs run serially
+*
+*       #define RESOURCE_CACHE_RAM_BUDGET / RESOURCE_CACHE_VRAM_BUDGET
+*           Default memory budget for resources cache, unreferenced resources are evicted over budget
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -48,6 +55,18 @@
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+        #include <process.h>            // Required for: _beginthreadex()
+        #if defined(_MSC_VER)
+            #include <intrin.h>         // Required for: _InterlockedCompareExchange(), _InterlockedExchange(), _InterlockedExchangeAdd()
+        #endif
+    #else
+        #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+        #include <sched.h>              // Required for: sched_yield()
+        #include <unistd.h>             // Required for: sysconf()
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -55,6 +74,31 @@
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS           16         // Max number of threads processing a job (including calling thread)
+#endif
+#ifndef RESOURCE_CACHE_RAM_BUDGET
+    #define RESOURCE_CACHE_RAM_BUDGET    (64*1024*1024)     // Default resources cache RAM budget (bytes)
+#endif
+#ifndef RESOURCE_CACHE_VRAM_BUDGET
+    #define RESOURCE_CACHE_VRAM_BUDGET   (256*1024*1024)    // Default resources cache VRAM budget (bytes)
+#endif
+
+#if defined(WORKER_THREADS_AVAILABLE) && defined(_WIN32)
+// NOTE: Declaring required Win32 symbols to avoid including windows.h
+// SRWLOCK and CONDITION_VARIABLE are pointer-sized opaque objects
+__declspec(dllimport) void __stdcall InitializeSRWLock(void **lock);
+__declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+__declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+__declspec(dllimport) void __stdcall InitializeConditionVariable(void **condition);
+__declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **condition, void **lock, unsigned long milliseconds, unsigned long flags);
+__declspec(dllimport) void __stdcall WakeConditionVariable(void **condition);
+__declspec(dllimport) void __stdcall WakeAllConditionVariable(void **condition);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+__declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+__declspec(dllimport) int __stdcall SwitchToThread(void);
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +111,64 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+// Worker threads pool, processing one ParallelFor() job at a time
+// NOTE: Calling thread also processes job chunks, so pool only starts (threadCount - 1) workers
+typedef struct WorkerPool {
+    ThreadMutex mutex;                  // Pool state access mutex
+    ThreadCondition jobReady;           // Signaled when a new job is available (or pool closing)
+    ThreadCondition jobDone;            // Signaled when last worker leaves current job
+    ThreadHandle threads[MAX_WORKER_THREADS];
+    int workerCount;                    // Number of worker threads started
+    volatile int ready;                 // Pool initialized and workers started
+    volatile int initializing;          // Pool initialization in progress (only one thread initializes it)
+    bool busy;                          // A job is being processed
+    bool quit;                          // Workers must exit
+    unsigned int generation;            // Job counter, workers use it to detect new jobs
+
+    ParallelForFunc func;               // Current job: range processing function
+    void *data;                         // Current job: user data
+    int count;                          // Current job: range size
+    int chunkSize;                      // Current job: elements per chunk
+    int next;                           // Current job: next chunk start
+    int active;                         // Current job: workers processing chunks
+} WorkerPool;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+static WorkerPool workerPool = { 0 };
+#endif
+static int workerThreadCount = 0;                   // Requested threads count (0 = automatic)
+
+// Resources cache entry, resource data is a copy of the loaded resource struct
+typedef struct ResourceCacheEntry {
+    int type;                           // Resource type (ResourceType)
+    unsigned int hash;                  // Canonical path hash
+    char *path;                         // Canonical file path
+    unsigned long long variant;         // Resource loading settings, same file loaded with different settings is cached separately
+    long modTime;                       // File modification time when loaded
+    unsigned long long key;             // Resource identifier, used to release references (data pointer or GPU id)
+    void *resource;                     // Resource data (Image, Texture2D, Font...)
+    int references;                     // Current references count
+    unsigned int lastUsed;              // Last access tick, least recently used entries are evicted first
+    bool stale;                         // File modified while referenced, entry unloaded once released
+    unsigned int ramSize;               // RAM used by resource (bytes)
+    unsigned int vramSize;              // VRAM used by resource (bytes)
+    ResourceUnloadFunc unload;          // Resource unloader
+} ResourceCacheEntry;
+
+// Resources cache, shared by modules loading resources from files
+// NOTE: Not thread-safe, resources are expected to be loaded and released from main thread
+typedef struct ResourceCache {
+    ResourceCacheEntry *entries;        // Cached resources
+    int count;                          // Cached resources count
+    int capacity;                       // Entries array capacity
+    unsigned int tick;                  // Access counter
+    unsigned int ramBudget;             // RAM budget (bytes)
+    unsigned int vramBudget;            // VRAM budget (bytes)
+    ResourceCacheStats stats;           // Usage statistics
+} ResourceCache;
+
+static ResourceCache resourceCache = { .ramBudget = RESOURCE_CACHE_RAM_BUDGET, .vramBudget = RESOURCE_CACHE_VRAM_BUDGET };
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -95,6 +197,15 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(WORKER_THREADS_AVAILABLE)
+static void WorkerThreadLoop(void *data);           // Worker thread: wait for jobs and process chunks
+#endif
+
+static void GetCanonicalPath(const char *fileName, char *path); // Get canonical file path (absolute, '.' and '..' resolved)
+static unsigned int GetPathHash(const char *path);  // Get file path hash (FNV-1a)
+static void UnloadResourceEntry(int index);         // Unload cached resource and remove its entry
+static void TrimResourceCache(void);                // Evict unreferenced resources (least recently used first) while over budget
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -439,6 +550,601 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Threading
+//----------------------------------------------------------------------------------
+
+#if defined(WORKER_THREADS_AVAILABLE)
+// Thread start data, required to adapt entry point signature to platform
+typedef struct ThreadStart {
+    ThreadFunc func;
+    void *data;
+} ThreadStart;
+
+#if defined(_WIN32)
+static unsigned __stdcall ThreadStartProc(void *arg)
+#else
+static void *ThreadStartProc(void *arg)
+#endif
+{
+    ThreadStart start = *(ThreadStart *)arg;
+    RL_FREE(arg);
+
+    start.func(start.data);
+
+    return 0;
+}
+#endif
+
+// Initialize mutex
+bool InitThreadMutex(ThreadMutex *mutex)
+{
+    bool result = false;
+    mutex->handle = NULL;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    mutex->handle = RL_CALLOC(1, sizeof(void *));
+    if (mutex->handle != NULL)
+    {
+        InitializeSRWLock((void **)mutex->handle);
+        result = true;
+    }
+    #else
+    mutex->handle = RL_CALLOC(1, sizeof(pthread_mutex_t));
+    if (mutex->handle != NULL)
+    {
+        if (pthread_mutex_init((pthread_mutex_t *)mutex->handle, NULL) == 0) result = true;
+        else
+        {
+            RL_FREE(mutex->handle);
+            mutex->handle = NULL;
+        }
+    }
+    #endif
+#else
+    result = true;
+#endif
+
+    return result;
+}
+
+// Close mutex
+void CloseThreadMutex(ThreadMutex *mutex)
+{
+    if (mutex->handle == NULL) return;
+
+#if defined(WORKER_THREADS_AVAILABLE) && !defined(_WIN32)
+    pthread_mutex_destroy((pthread_mutex_t *)mutex->handle);
+#endif
+    RL_FREE(mutex->handle);
+    mutex->handle = NULL;
+}
+
+// Lock mutex (blocking)
+void LockThreadMutex(ThreadMutex *mutex)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    AcquireSRWLockExclusive((void **)mutex->handle);
+    #else
+    pthread_mutex_lock((pthread_mutex_t *)mutex->handle);
+    #endif
+#endif
+}
+
+// Unlock mutex
+void UnlockThreadMutex(ThreadMutex *mutex)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    ReleaseSRWLockExclusive((void **)mutex->handle);
+    #else
+    pthread_mutex_unlock((pthread_mutex_t *)mutex->handle);
+    #endif
+#endif
+}
+
+// Initialize condition variable
+bool InitThreadCondition(ThreadCondition *condition)
+{
+    bool result = false;
+    condition->handle = NULL;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    condition->handle = RL_CALLOC(1, sizeof(void *));
+    if (condition->handle != NULL)
+    {
+        InitializeConditionVariable((void **)condition->handle);
+        result = true;
+    }
+    #else
+    condition->handle = RL_CALLOC(1, sizeof(pthread_cond_t));
+    if (condition->handle != NULL)
+    {
+        if (pthread_cond_init((pthread_cond_t *)condition->handle, NULL) == 0) result = true;
+        else
+        {
+            RL_FREE(condition->handle);
+            condition->handle = NULL;
+        }
+    }
+    #endif
+#else
+    result = true;
+#endif
+
+    return result;
+}
+
+// Close condition variable
+void CloseThreadCondition(ThreadCondition *condition)
+{
+    if (condition->handle == NULL) return;
+
+#if defined(WORKER_THREADS_AVAILABLE) && !defined(_WIN32)
+    pthread_cond_destroy((pthread_cond_t *)condition->handle);
+#endif
+    RL_FREE(condition->handle);
+    condition->handle = NULL;
+}
+
+// Wait on condition variable
+// NOTE: Mutex must be locked by calling thread, spurious wake-ups are possible
+void WaitThreadCondition(ThreadCondition *condition, ThreadMutex *mutex)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    SleepConditionVariableSRW((void **)condition->handle, (void **)mutex->handle, 0xffffffff, 0);   // INFINITE
+    #else
+    pthread_cond_wait((pthread_cond_t *)condition->handle, (pthread_mutex_t *)mutex->handle);
+    #endif
+#endif
+}
+
+// Wake one thread waiting on condition
+void SignalThreadCondition(ThreadCondition *condition)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    WakeConditionVariable((void **)condition->handle);
+    #else
+    pthread_cond_signal((pthread_cond_t *)condition->handle);
+    #endif
+#endif
+}
+
+// Wake all threads waiting on condition
+void BroadcastThreadCondition(ThreadCondition *condition)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    WakeAllConditionVariable((void **)condition->handle);
+    #else
+    pthread_cond_broadcast((pthread_cond_t *)condition->handle);
+    #endif
+#endif
+}
+
+// Start a new thread running func(data)
+// NOTE: Returns false if threads are not available, caller is expected to run func() itself
+bool StartThread(ThreadHandle *thread, ThreadFunc func, void *data)
+{
+    bool result = false;
+    thread->handle = NULL;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    ThreadStart *start = (ThreadStart *)RL_MALLOC(sizeof(ThreadStart));
+    if (start == NULL) return false;
+    start->func = func;
+    start->data = data;
+
+    #if defined(_WIN32)
+    thread->handle = (void *)_beginthreadex(NULL, 0, ThreadStartProc, start, 0, NULL);
+    if (thread->handle != NULL) result = true;
+    #else
+    thread->handle = RL_MALLOC(sizeof(pthread_t));
+    if (thread->handle != NULL)
+    {
+        if (pthread_create((pthread_t *)thread->handle, NULL, ThreadStartProc, start) == 0) result = true;
+        else
+        {
+            RL_FREE(thread->handle);
+            thread->handle = NULL;
+        }
+    }
+    #endif
+
+    if (!result)
+    {
+        RL_FREE(start);
+        TRACELOG(LOG_WARNING, "THREAD: Failed to start thread");
+    }
+#endif
+
+    return result;
+}
+
+// Wait for thread to finish and release it
+void JoinThread(ThreadHandle *thread)
+{
+    if (thread->handle == NULL) return;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    WaitForSingleObject(thread->handle, 0xffffffff);    // INFINITE
+    CloseHandle(thread->handle);
+    #else
+    pthread_join(*(pthread_t *)thread->handle, NULL);
+    RL_FREE(thread->handle);
+    #endif
+#endif
+
+    thread->handle = NULL;
+}
+
+// Yield calling thread execution to other threads
+void YieldThread(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    SwitchToThread();
+    #else
+    sched_yield();
+    #endif
+#endif
+}
+
+// Get number of logical processors available
+int GetProcessorCount(void)
+{
+    int count = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    #if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xffff);       // ALL_PROCESSOR_GROUPS
+    #elif defined(_SC_NPROCESSORS_ONLN)
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+#endif
+
+    if (count < 1) count = 1;
+
+    return count;
+}
+
+// Atomic load (sequentially consistent)
+int AtomicLoad(volatile int *value)
+{
+#if defined(WORKER_THREADS_AVAILABLE) && defined(_MSC_VER)
+    return (int)_InterlockedCompareExchange((volatile long *)value, 0, 0);
+#elif defined(WORKER_THREADS_AVAILABLE)
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+#else
+    return *value;
+#endif
+}
+
+// Atomic store (sequentially consistent)
+void AtomicStore(volatile int *value, int newValue)
+{
+#if defined(WORKER_THREADS_AVAILABLE) && defined(_MSC_VER)
+    _InterlockedExchange((volatile long *)value, (long)newValue);
+#elif defined(WORKER_THREADS_AVAILABLE)
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+#else
+    *value = newValue;
+#endif
+}
+
+// Atomic add, returns previous value
+int AtomicAdd(volatile int *value, int increment)
+{
+#if defined(WORKER_THREADS_AVAILABLE) && defined(_MSC_VER)
+    return (int)_InterlockedExchangeAdd((volatile long *)value, (long)increment);
+#elif defined(WORKER_THREADS_AVAILABLE)
+    return __atomic_fetch_add(value, increment, __ATOMIC_SEQ_CST);
+#else
+    int previous = *value;
+    *value += increment;
+    return previous;
+#endif
+}
+
+// Set number of threads used for internal data-parallel processing
+// NOTE: 0 = automatic (number of logical processors), 1 = serial processing,
+// it should not be called while a ParallelFor() job is being processed
+void SetWorkerThreadCount(int count)
+{
+    if (count < 0) count = 0;
+    if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+
+    if (count != workerThreadCount)
+    {
+        CloseWorkerThreads();   // Pool is restarted with new size on next job
+        workerThreadCount = count;
+    }
+}
+
+// Get number of threads used for internal data-parallel processing
+int GetWorkerThreadCount(void)
+{
+    int count = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    count = (workerThreadCount > 0)? workerThreadCount : GetProcessorCount();
+    if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+#endif
+
+    return count;
+}
+
+// Run func(data, start, end) over range [0, count), split in chunks of at least grain elements
+// NOTE: Chunks are processed in undefined order by calling thread and worker threads,
+// func() must only write data owned by its range to keep results independent of threads count
+void ParallelFor(int count, int grain, ParallelForFunc func, void *data)
+{
+    if (count <= 0) return;
+    if (grain < 1) grain = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    int threadCount = GetWorkerThreadCount();
+
+    if ((threadCount > 1) && (count > grain))
+    {
+        // Lazy pool initialization on first job
+        // NOTE: Only one thread initializes the pool, any other thread meanwhile processes its job serially
+        if (!AtomicLoad(&workerPool.ready))
+        {
+            if (AtomicAdd(&workerPool.initializing, 1) == 0)
+            {
+                if (InitThreadMutex(&workerPool.mutex) && InitThreadCondition(&workerPool.jobReady) && InitThreadCondition(&workerPool.jobDone))
+                {
+                    workerPool.quit = false;
+                    workerPool.busy = false;
+                    workerPool.workerCount = 0;
+
+                    for (int i = 0; i < (threadCount - 1); i++)
+                    {
+                        if (!StartThread(&workerPool.threads[i], WorkerThreadLoop, NULL)) break;
+                        workerPool.workerCount++;
+                    }
+
+                    AtomicStore(&workerPool.ready, 1);
+                    TRACELOG(LOG_INFO, "THREAD: Worker threads pool started (%i workers)", workerPool.workerCount);
+                }
+                else
+                {
+                    CloseThreadCondition(&workerPool.jobDone);
+                    CloseThreadCondition(&workerPool.jobReady);
+                    CloseThreadMutex(&workerPool.mutex);
+                }
+            }
+
+            AtomicAdd(&workerPool.initializing, -1);
+        }
+
+        if (AtomicLoad(&workerPool.ready) && (workerPool.workerCount > 0))
+        {
+            LockThreadMutex(&workerPool.mutex);
+
+            if (!workerPool.busy)
+            {
+                // Split range in several chunks per thread for load balancing
+                int chunkSize = (count + (workerPool.workerCount + 1)*4 - 1)/((workerPool.workerCount + 1)*4);
+                if (chunkSize < grain) chunkSize = grain;
+
+                workerPool.busy = true;
+                workerPool.func = func;
+                workerPool.data = data;
+                workerPool.count = count;
+                workerPool.chunkSize = chunkSize;
+                workerPool.next = 0;
+                workerPool.generation++;
+                BroadcastThreadCondition(&workerPool.jobReady);
+
+                // Calling thread also processes chunks
+                while (workerPool.next < workerPool.count)
+                {
+                    int start = workerPool.next;
+                    int end = ((count - start) > chunkSize)? (start + chunkSize) : count;
+                    workerPool.next = end;
+
+                    UnlockThreadMutex(&workerPool.mutex);
+                    func(data, start, end);
+                    LockThreadMutex(&workerPool.mutex);
+                }
+
+                while (workerPool.active > 0) WaitThreadCondition(&workerPool.jobDone, &workerPool.mutex);
+
+                workerPool.func = NULL;
+                workerPool.data = NULL;
+                workerPool.busy = false;
+                UnlockThreadMutex(&workerPool.mutex);
+
+                return;
+            }
+
+            // Pool busy (nested or concurrent job), fallback to serial processing
+            UnlockThreadMutex(&workerPool.mutex);
+        }
+    }
+#endif
+
+    func(data, 0, count);
+}
+
+// Stop and release worker threads (if started)
+void CloseWorkerThreads(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    if (!AtomicLoad(&workerPool.ready)) return;
+    AtomicStore(&workerPool.ready, 0);
+
+    LockThreadMutex(&workerPool.mutex);
+    workerPool.quit = true;
+    BroadcastThreadCondition(&workerPool.jobReady);
+    UnlockThreadMutex(&workerPool.mutex);
+
+    for (int i = 0; i < workerPool.workerCount; i++) JoinThread(&workerPool.threads[i]);
+
+    CloseThreadCondition(&workerPool.jobDone);
+    CloseThreadCondition(&workerPool.jobReady);
+    CloseThreadMutex(&workerPool.mutex);
+
+    workerPool.workerCount = 0;
+
+    TRACELOG(LOG_INFO, "THREAD: Worker threads pool closed");
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Resources cache
+//----------------------------------------------------------------------------------
+// Set resources cache memory budget (bytes), unreferenced resources are evicted while over budget
+void SetResourceCacheBudget(unsigned int ramSize, unsigned int vramSize)
+{
+    resourceCache.ramBudget = ramSize;
+    resourceCache.vramBudget = vramSize;
+
+    TrimResourceCache();
+}
+
+// Get resources cache usage statistics
+ResourceCacheStats GetResourceCacheStats(void)
+{
+    ResourceCacheStats stats = resourceCache.stats;
+
+    stats.entries = resourceCache.count;
+    stats.references = 0;
+    for (int i = 0; i < resourceCache.count; i++) stats.references += resourceCache.entries[i].references;
+
+    return stats;
+}
+
+// Get cached resource adding a reference, NULL if not cached
+// NOTE: If file has been modified since cached, resource is unloaded (or kept until released if referenced)
+// and NULL is returned, so caller reloads it from file
+void *GetCachedResource(int type, const char *fileName, unsigned long long variant)
+{
+    char path[MAX_FILEPATH_LENGTH + 2] = { 0 };
+    GetCanonicalPath(fileName, path);
+
+    unsigned int hash = GetPathHash(path);
+
+    for (int i = 0; i < resourceCache.count; i++)
+    {
+        ResourceCacheEntry *entry = &resourceCache.entries[i];
+
+        if ((entry->type == type) && (entry->hash == hash) && (entry->variant == variant) && !entry->stale && (strcmp(entry->path, path) == 0))
+        {
+            if (entry->modTime == GetFileModTime(fileName))
+            {
+                entry->references++;
+                entry->lastUsed = ++resourceCache.tick;
+                resourceCache.stats.hits++;
+
+                TRACELOGD("CACHE: [%s] Resource found in cache (%i references)", fileName, entry->references);
+
+                return entry->resource;
+            }
+
+            TRACELOG(LOG_INFO, "CACHE: [%s] File modified, resource reloaded", fileName);
+
+            resourceCache.stats.reloads++;
+            if (entry->references == 0) UnloadResourceEntry(i);
+            else entry->stale = true;
+            break;
+        }
+    }
+
+    resourceCache.stats.misses++;
+
+    return NULL;
+}
+
+// Add loaded resource to cache with one reference, returns false if resource could not be added
+// NOTE: Resource struct is copied, key is used to identify the resource when released
+bool AddCachedResource(int type, const char *fileName, unsigned long long variant, const void *resource, int size, unsigned long long key,
+                       unsigned int ramSize, unsigned int vramSize, ResourceUnloadFunc unload)
+{
+    if (resourceCache.count == resourceCache.capacity)
+    {
+        int capacity = (resourceCache.capacity == 0)? 16 : resourceCache.capacity*2;
+        ResourceCacheEntry *entries = (ResourceCacheEntry *)RL_REALLOC(resourceCache.entries, capacity*sizeof(ResourceCacheEntry));
+
+        if (entries == NULL)
+        {
+            TRACELOG(LOG_WARNING, "CACHE: [%s] Failed to add resource to cache", fileName);
+            return false;
+        }
+
+        resourceCache.entries = entries;
+        resourceCache.capacity = capacity;
+    }
+
+    char path[MAX_FILEPATH_LENGTH + 2] = { 0 };
+    GetCanonicalPath(fileName, path);
+
+    ResourceCacheEntry *entry = &resourceCache.entries[resourceCache.count];
+    memset(entry, 0, sizeof(ResourceCacheEntry));
+
+    entry->type = type;
+    entry->hash = GetPathHash(path);
+    entry->path = (char *)RL_MALLOC(strlen(path) + 1);
+    strcpy(entry->path, path);
+    entry->variant = variant;
+    entry->modTime = GetFileModTime(fileName);
+    entry->key = key;
+    entry->resource = RL_MALLOC(size);
+    memcpy(entry->resource, resource, size);
+    entry->references = 1;
+    entry->lastUsed = ++resourceCache.tick;
+    entry->ramSize = ramSize;
+    entry->vramSize = vramSize;
+    entry->unload = unload;
+
+    resourceCache.count++;
+    resourceCache.stats.ramSize += ramSize;
+    resourceCache.stats.vramSize += vramSize;
+
+    TrimResourceCache();
+
+    return true;
+}
+
+// Release cached resource reference, returns false if resource is not cached
+bool ReleaseCachedResource(int type, unsigned long long key)
+{
+    for (int i = 0; i < resourceCache.count; i++)
+    {
+        ResourceCacheEntry *entry = &resourceCache.entries[i];
+
+        if ((entry->type == type) && (entry->key == key) && (entry->references > 0))
+        {
+            entry->references--;
+
+            if ((entry->references == 0) && entry->stale) UnloadResourceEntry(i);
+            else TrimResourceCache();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Unload all cached resources, referenced or not
+void CloseResourceCache(void)
+{
+    while (resourceCache.count > 0) UnloadResourceEntry(resourceCache.count - 1);
+
+    RL_FREE(resourceCache.entries);
+    resourceCache.entries = NULL;
+    resourceCache.capacity = 0;
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -485,6 +1191,147 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Get canonical file path: absolute, '/' separators, '.' and '..' segments resolved
+// NOTE: Symbolic links are not resolved, path buffer must be at least MAX_FILEPATH_LENGTH + 2 bytes
+static void GetCanonicalPath(const char *fileName, char *path)
+{
+    char fullPath[MAX_FILEPATH_LENGTH] = { 0 };
+    bool absolute = (fileName[0] == '/') || (fileName[0] == '\\') || ((fileName[0] != '\0') && (fileName[1] == ':'));
+
+    if (absolute) snprintf(fullPath, MAX_FILEPATH_LENGTH, "%s", fileName);
+    else snprintf(fullPath, MAX_FILEPATH_LENGTH, "%s/%s", GetWorkingDirectory(), fileName);
+
+    int prefix = 0;     // Drive letter prefix (if any) is kept as is
+    if ((fullPath[0] != '\0') && (fullPath[1] == ':'))
+    {
+        path[0] = fullPath[0];
+        path[1] = ':';
+        prefix = 2;
+    }
+
+    int length = prefix;
+
+    for (int i = prefix; fullPath[i] != '\0';)
+    {
+        while ((fullPath[i] == '/') || (fullPath[i] == '\\')) i++;
+
+        int start = i;
+        while ((fullPath[i] != '\0') && (fullPath[i] != '/') && (fullPath[i] != '\\')) i++;
+
+        int segment = i - start;
+
+        if ((segment == 0) || ((segment == 1) && (fullPath[start] == '.'))) continue;
+        else if ((segment == 2) && (fullPath[start] == '.') && (fullPath[start + 1] == '.'))
+        {
+            // Remove previous segment
+            while ((length > prefix) && (path[length - 1] != '/')) length--;
+            if (length > prefix) length--;
+        }
+        else
+        {
+            path[length++] = '/';
+            memcpy(path + length, fullPath + start, segment);
+            length += segment;
+        }
+    }
+
+    if (length == prefix) path[length++] = '/';
+    path[length] = '\0';
+}
+
+// Get file path hash (FNV-1a)
+static unsigned int GetPathHash(const char *path)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; path[i] != '\0'; i++) hash = (hash ^ (unsigned char)path[i])*16777619u;
+
+    return hash;
+}
+
+// Unload cached resource and remove its entry, last entry is moved to its place
+static void UnloadResourceEntry(int index)
+{
+    ResourceCacheEntry *entry = &resourceCache.entries[index];
+
+    TRACELOGD("CACHE: [%s] Resource unloaded from cache", entry->path);
+
+    if (entry->unload != NULL) entry->unload(entry->resource);
+
+    resourceCache.stats.ramSize -= entry->ramSize;
+    resourceCache.stats.vramSize -= entry->vramSize;
+
+    RL_FREE(entry->resource);
+    RL_FREE(entry->path);
+
+    resourceCache.count--;
+    if (index < resourceCache.count) resourceCache.entries[index] = resourceCache.entries[resourceCache.count];
+}
+
+// Evict unreferenced resources while cache is over budget, least recently used first
+// NOTE: Only resources using the memory over budget (RAM or VRAM) are evicted
+static void TrimResourceCache(void)
+{
+    while ((resourceCache.stats.ramSize > resourceCache.ramBudget) || (resourceCache.stats.vramSize > resourceCache.vramBudget))
+    {
+        bool ramOver = (resourceCache.stats.ramSize > resourceCache.ramBudget);
+        bool vramOver = (resourceCache.stats.vramSize > resourceCache.vramBudget);
+        int oldest = -1;
+
+        for (int i = 0; i < resourceCache.count; i++)
+        {
+            ResourceCacheEntry *entry = &resourceCache.entries[i];
+
+            if ((entry->references == 0) && ((ramOver && (entry->ramSize > 0)) || (vramOver && (entry->vramSize > 0))) &&
+                ((oldest < 0) || (entry->lastUsed < resourceCache.entries[oldest].lastUsed))) oldest = i;
+        }
+
+        if (oldest < 0) break;      // Remaining resources are referenced
+
+        UnloadResourceEntry(oldest);
+        resourceCache.stats.evictions++;
+    }
+}
+
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker thread: wait for jobs and process chunks until pool is closed
+static void WorkerThreadLoop(void *data)
+{
+    unsigned int generation = 0;
+
+    LockThreadMutex(&workerPool.mutex);
+    generation = workerPool.generation;
+
+    while (true)
+    {
+        while (!workerPool.quit && (workerPool.generation == generation)) WaitThreadCondition(&workerPool.jobReady, &workerPool.mutex);
+
+        if (workerPool.quit) break;
+
+        generation = workerPool.generation;
+        workerPool.active++;
+
+        while (workerPool.busy && (workerPool.next < workerPool.count))
+        {
+            ParallelForFunc func = workerPool.func;
+            void *jobData = workerPool.data;
+            int start = workerPool.next;
+            int end = ((workerPool.count - start) > workerPool.chunkSize)? (start + workerPool.chunkSize) : workerPool.count;
+            workerPool.next = end;
+
+            UnlockThreadMutex(&workerPool.mutex);
+            func(jobData, start, end);
+            LockThreadMutex(&workerPool.mutex);
+        }
+
+        workerPool.active--;
+        if (workerPool.active == 0) BroadcastThreadCondition(&workerPool.jobDone);
+    }
+
+    UnlockThreadMutex(&workerPool.mutex);
+}
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
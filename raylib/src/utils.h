@@ -52,10 +52,31 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// Worker threads are only available if platform supports them,
+// otherwise all threading functions fallback to serial processing
+#if defined(SUPPORT_WORKER_THREADS) && (!defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__))
+    #define WORKER_THREADS_AVAILABLE
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Threading primitives, platform objects are allocated internally
+// NOTE: Only intended for internal raylib modules usage
+typedef struct ThreadHandle { void *handle; } ThreadHandle;
+typedef struct ThreadMutex { void *handle; } ThreadMutex;
+typedef struct ThreadCondition { void *handle; } ThreadCondition;
+
+typedef void (*ThreadFunc)(void *data);                         // Thread entry point
+typedef void (*ParallelForFunc)(void *data, int start, int end); // Job range processor, range: [start, end)
+typedef void (*ResourceUnloadFunc)(void *resource);             // Cached resource unloader
+
+// Cached resources types
+typedef enum {
+    RESOURCE_IMAGE = 0,
+    RESOURCE_TEXTURE,
+    RESOURCE_FONT
+} ResourceType;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +95,41 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+// Threading functions
+// NOTE: If worker threads are not available, mutex/condition functions are no-op and StartThread() fails
+bool InitThreadMutex(ThreadMutex *mutex);                              // Initialize mutex
+void CloseThreadMutex(ThreadMutex *mutex);                             // Close mutex
+void LockThreadMutex(ThreadMutex *mutex);                              // Lock mutex (blocking)
+void UnlockThreadMutex(ThreadMutex *mutex);                            // Unlock mutex
+bool InitThreadCondition(ThreadCondition *condition);                  // Initialize condition variable
+void CloseThreadCondition(ThreadCondition *condition);                 // Close condition variable
+void WaitThreadCondition(ThreadCondition *condition, ThreadMutex *mutex); // Wait on condition variable (mutex must be locked)
+void SignalThreadCondition(ThreadCondition *condition);                // Wake one thread waiting on condition
+void BroadcastThreadCondition(ThreadCondition *condition);             // Wake all threads waiting on condition
+bool StartThread(ThreadHandle *thread, ThreadFunc func, void *data);   // Start a new thread running func(data)
+void JoinThread(ThreadHandle *thread);                                 // Wait for thread to finish and release it
+void YieldThread(void);                                                // Yield calling thread execution to other threads
+int GetProcessorCount(void);                                           // Get number of logical processors available
+
+int AtomicLoad(volatile int *value);                                   // Atomic load (sequentially consistent)
+void AtomicStore(volatile int *value, int newValue);                   // Atomic store (sequentially consistent)
+int AtomicAdd(volatile int *value, int increment);                     // Atomic add, returns previous value
+
+// Run func(data, start, end) over range [0, count) split in chunks of at least grain elements,
+// chunks are distributed between calling thread and worker threads, returns when all chunks are done
+// NOTE: Nested or concurrent calls (pool already busy) are processed serially on calling thread
+void ParallelFor(int count, int grain, ParallelForFunc func, void *data);
+void CloseWorkerThreads(void);                                         // Stop and release worker threads (if started)
+
+// Resources cache functions
+// NOTE: Resources are identified by canonical file path, file modification time and loading settings (variant),
+// every resource keeps a references count, unreferenced resources are kept until cache budget requires evicting them
+void *GetCachedResource(int type, const char *fileName, unsigned long long variant);    // Get cached resource adding a reference, NULL if not cached (or file modified)
+bool AddCachedResource(int type, const char *fileName, unsigned long long variant, const void *resource, int size, unsigned long long key,
+                       unsigned int ramSize, unsigned int vramSize, ResourceUnloadFunc unload); // Add loaded resource to cache with one reference
+bool ReleaseCachedResource(int type, unsigned long long key);          // Release cached resource reference, returns false if not cached
+void CloseResourceCache(void);                                         // Unload all cached resources
+
 #if defined(__cplusplus)
 }
 #endif
@@ -37,12 +37,23 @@ typedef struct Timer
     double lifeTime;
 } Timer;
 
+// Pathfinding query statistics, used to compare solvers
+typedef struct PathStats
+{
+    int expandedCount; // Number of cells expanded (taken from the frontier)
+    double queryTime;  // Time spent in the query (seconds)
+} PathStats;
+
 // Generate procedural maze image, using grid-based algorithm
 // NOTE: Functions defined as static are internal to the module
 static Image GenImageMazeEx(int width, int height, int spacingRows, int spacingCols, float skipChance);
 
 // Get shorter path between two points, implements pathfinding algorithm: A*
-static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount);
+static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount, PathStats *stats);
+
+// Get shorter path between two points, implements bidirectional breadth-first search
+// NOTE: Frontiers grow from both ends until they meet, path returned in same format than A*
+static Point *LoadPathBidirectional(Image map, Point start, Point end, int *pointCount, PathStats *stats);
 
 //----------------------------------------------------------------------------------
 // Main entry point
@@ -113,11 +124,17 @@ int main(void)
 
     // Define textures to be used as our "biomes"
     // DONE: Load additional textures for different biomes
+    // NOTE: Textures are loaded in background, a placeholder texture is used until they are uploaded
+    // Uploaded textures are kept in resources cache, requesting an atlas again reuses the loaded texture
+    int biomeRequests[4] = {0};
+    biomeRequests[0] = LoadTextureAsync("resources/maze_atlas01.png");
+    biomeRequests[1] = LoadTextureAsync("resources/maze_atlas02.png");
+    biomeRequests[2] = LoadTextureAsync("resources/maze_atlas03.png");
+    biomeRequests[3] = LoadTextureAsync("resources/maze_atlas04.png");
+
     Texture texBiomes[4] = {0};
-    texBiomes[0] = LoadTexture("resources/maze_atlas01.png");
-    texBiomes[1] = LoadTexture("resources/maze_atlas02.png");
-    texBiomes[2] = LoadTexture("resources/maze_atlas03.png");
-    texBiomes[3] = LoadTexture("resources/maze_atlas04.png");
+    for (int i = 0; i < 4; i++)
+        texBiomes[i] = GetTextureAsync(biomeRequests[i]);
     int currentBiome = 0;
 
     mdlMaze.materials[0].maps[MATERIAL_MAP_DIFFUSE].texture = texBiomes[0];
@@ -134,6 +151,7 @@ int main(void)
     Rectangle skipRec = (Rectangle){GetScreenWidth() - 150, 100, 120, 20};
     int skipChance = 75;
     Rectangle buttonRec = (Rectangle){GetScreenWidth() - 150, 120, 120, 20};
+    Rectangle bidirRec = (Rectangle){GetScreenWidth() - 150, 150, 20, 20};
     bool editRowSpace = false;
     bool editColSpace = false;
     bool editSeed = false;
@@ -145,6 +163,11 @@ int main(void)
     int aStarPointCount = 0;
     Point *pathAStar = NULL;
 
+    // Pathfinding solver selection and per-query statistics
+    bool useBidirectional = false;
+    PathStats statsAStar = {0};
+    PathStats statsBidir = {0};
+
     SetTargetFPS(60);      // Set our game to run at 60 frames-per-second
     bool exitGame = false; // Game exit handler
     double gameScore = 0;  // Game Score
@@ -160,6 +183,10 @@ int main(void)
     {
         // Update
         //----------------------------------------------------------------------------------
+        // Refresh biome textures, placeholder is replaced once texture is uploaded
+        for (int i = 0; i < 4; i++)
+            texBiomes[i] = GetTextureAsync(biomeRequests[i]);
+
         // Check if game exits
         exitGame = exitGame || timer.currentTime >= timer.lifeTime;
         if (exitGame)
@@ -345,9 +372,27 @@ int main(void)
 
         // DONE: EXTRA: Calculate shorter path between startCell (or playerCell) to endCell (A* algorithm)
         // NOTE: Calculation can be costly, only do it if startCell/playerCell or endCell change
+        // NOTE: Both solvers are run to report their statistics, selected one provides the drawn path
         if (!isAStarCalculated)
         {
-            pathAStar = LoadPathAStar(imMaze, startCell, endCell, &aStarPointCount);
+            int bidirPointCount = 0;
+            Point *pathUnidir = LoadPathAStar(imMaze, startCell, endCell, &aStarPointCount, &statsAStar);
+            Point *pathBidir = LoadPathBidirectional(imMaze, startCell, endCell, &bidirPointCount, &statsBidir);
+
+            free(pathAStar);
+
+            if (useBidirectional)
+            {
+                free(pathUnidir);
+                pathAStar = pathBidir;
+                aStarPointCount = bidirPointCount;
+            }
+            else
+            {
+                free(pathBidir);
+                pathAStar = pathUnidir;
+            }
+
             isAStarCalculated = true;
         }
 
@@ -367,11 +412,17 @@ int main(void)
             BeginMode2D(camera2d);
 
             // DONE: Draw maze walls and floor using current texture biome
-            for (int y = 0; y < imMaze.height; y++)
+            // NOTE: Maze pixels are read one row at a time, view is clipped to row buffer size
+            ImageView mazeView = GetImageViewRec(imMaze, (Rectangle){0, 0, MAZE_WIDTH, imMaze.height});
+            Color mazeRow[MAZE_WIDTH] = {0};
+
+            for (int y = 0; y < mazeView.height; y++)
             {
-                for (int x = 0; x < imMaze.width; x++)
+                ReadImageViewRow(mazeView, 0, y, mazeView.width, mazeRow);
+
+                for (int x = 0; x < mazeView.width; x++)
                 {
-                    if (GetImageColor(imMaze, x, y).r == 255)
+                    if (mazeRow[x].r == 255)
                     {
                         DrawTexturePro(texBiomes[currentBiome], (Rectangle){0, texBiomes[currentBiome].height / 2, texBiomes[currentBiome].width / 2, texBiomes[currentBiome].height / 2}, (Rectangle){mazePosition.x + x * MAZE_DRAW_SCALE, mazePosition.y + y * MAZE_DRAW_SCALE, MAZE_DRAW_SCALE, MAZE_DRAW_SCALE}, (Vector2){0, 0}, 0.0f, WHITE);
                     }
@@ -485,6 +536,14 @@ int main(void)
                 imMaze = GenImageMazeEx(MAZE_WIDTH, MAZE_HEIGHT, spacingRows, spacingCols, (float)skipChance / 100);
                 updateMap = true;
             }
+
+            // Pathfinding solver selection, statistics reported for both solvers
+            if (GuiCheckBox(bidirRec, "Bidirectional", &useBidirectional))
+            {
+                isAStarCalculated = false;
+            }
+            DrawText(TextFormat("A*: %i expanded, %.3f ms", statsAStar.expandedCount, statsAStar.queryTime * 1000.0), GetScreenWidth() - 250, 180, 10, DARKGRAY);
+            DrawText(TextFormat("Bidir: %i expanded, %.3f ms", statsBidir.expandedCount, statsBidir.queryTime * 1000.0), GetScreenWidth() - 250, 195, 10, DARKGRAY);
         }
         break;
         default:
@@ -500,7 +559,10 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadTexture(texMaze); // Unload maze texture from VRAM (GPU)
+    for (int i = 0; i < 4; i++)
+        UnloadTextureAsync(biomeRequests[i]); // Unload biome textures (cancelled if still loading)
     UnloadImage(imMaze);    // Unload maze image from RAM (CPU)
+    free(pathAStar);        // Unload pathfinding result
 
     CloseWindow(); // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -515,6 +577,9 @@ static Image GenImageMazeEx(int width, int height, int spacingRows, int spacingC
     // Generate image of plain color (BLACK)
     Image imMaze = GenImageColor(width, height, BLACK);
 
+    // NOTE: GenImageColor() generates RGBA8 pixels, so view rows can be accessed directly as Color spans
+    ImageView view = GetImageView(imMaze);
+
     // Allocate an array of point used for maze generation
     // NOTE: Dynamic array allocation, memory allocated in HEAP (MAX: Available RAM)
     Point *mazePoints = (Point *)malloc(MAZE_WIDTH * MAZE_HEIGHT * sizeof(Point));
@@ -523,12 +588,14 @@ static Image GenImageMazeEx(int width, int height, int spacingRows, int spacingC
     // Start traversing image data, line by line, to paint our maze
     for (int y = 0; y < imMaze.height; y++)
     {
+        Color *row = (Color *)GetImageViewRow(view, y);
+
         for (int x = 0; x < imMaze.width; x++)
         {
             // Check image borders (1 px)
             if ((x == 0) || (x == (imMaze.width - 1)) || (y == 0) || (y == (imMaze.height - 1)))
             {
-                ImageDrawPixel(&imMaze, x, y, WHITE); // Image border pixels set to WHITE
+                row[x] = WHITE; // Image border pixels set to WHITE
             }
             else
             {
@@ -541,7 +608,7 @@ static Image GenImageMazeEx(int width, int height, int spacingRows, int spacingC
                     if (chance >= skipChance)
                     {
                         // Set point as wall...
-                        ImageDrawPixel(&imMaze, x, y, WHITE);
+                        row[x] = WHITE;
 
                         // ...save point for further processing
                         mazePoints[mazePointsCounter] = (Point){x, y};
@@ -575,9 +642,9 @@ static Image GenImageMazeEx(int width, int height, int spacingRows, int spacingC
 
         // Keep incrementing wall in selected direction until a WHITE pixel is found
         // NOTE: We only check against the color.r component
-        while (GetImageColor(imMaze, currentPoint.x, currentPoint.y).r != 255)
+        while (((Color *)GetImageViewRow(view, currentPoint.y))[currentPoint.x].r != 255)
         {
-            ImageDrawPixel(&imMaze, currentPoint.x, currentPoint.y, WHITE);
+            ((Color *)GetImageViewRow(view, currentPoint.y))[currentPoint.x] = WHITE;
 
             currentPoint.x += currentDir.x;
             currentPoint.y += currentDir.y;
@@ -591,8 +658,11 @@ static Image GenImageMazeEx(int width, int height, int spacingRows, int spacingC
 
 // DONE: EXTRA: [10p] Get shorter path between two points, implements pathfinding algorithm: A*
 // NOTE: The functions returns an array of points and the pointCount
-static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount)
+static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount, PathStats *stats)
 {
+    double startTime = GetTime();
+    int expandedCount = 0;
+
     Point *path = (Point *)malloc(map.height * map.width * sizeof(Point *));
     int pathCounter = 0;
 
@@ -613,6 +683,10 @@ static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount)
     PathNode startNode = {start, 0, 0, NULL};
     PathNode endNode = {end, 0, 0, NULL};
 
+    // Map view, walkable cells are checked directly on view rows
+    // NOTE: Maze images are RGBA8 (GenImageColor()), so view rows can be accessed as Color spans
+    ImageView mapView = GetImageView(map);
+
     int frontierSize = 0;
     PathNode *frontier = (PathNode *)malloc(map.height * map.width * sizeof(PathNode));
     frontier[frontierSize] = startNode;
@@ -632,6 +706,7 @@ static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount)
             frontier[i] = frontier[i + 1];
         }
         frontierSize--;
+        expandedCount++;
 
         // Get neighbors of the current node
         Point neighbors[4] = {
@@ -648,7 +723,12 @@ static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount)
             int heuristic = abs(neighbors[i].x - endNode.p.x) + abs(neighbors[i].y - endNode.p.y);
             PathNode neighbor = {neighbors[i], currentNode.gvalue + 1, heuristic, NULL};
 
-            bool isValid = (neighbor.p.x >= 0) && (neighbor.p.y >= 0) && (neighbor.p.x < map.width) && (neighbor.p.y < map.height) && (GetImageColor(map, neighbor.p.x, neighbor.p.y).r == 0);
+            bool isValid = (neighbor.p.x >= 0) && (neighbor.p.y >= 0) && (neighbor.p.x < map.width) && (neighbor.p.y < map.height);
+            if (isValid)
+            {
+                Color *row = (Color *)GetImageViewRow(mapView, neighbor.p.y);
+                isValid = (row[neighbor.p.x].r == 0);
+            }
             if (isValid)
             {
                 int isInReached = -1;
@@ -720,6 +800,142 @@ static Point *LoadPathAStar(Image map, Point start, Point end, int *pointCount)
     free(reached);
     free(frontier);
 
+    stats->expandedCount = expandedCount;
+    stats->queryTime = GetTime() - startTime;
+
+    *pointCount = pathCounter; // Return number of path points
+    return path;               // Return path array (dynamically allocated)
+}
+
+// Get shorter path between two points, implements bidirectional breadth-first search
+// NOTE: The functions returns an array of points (from end to start, start not included) and the pointCount
+static Point *LoadPathBidirectional(Image map, Point start, Point end, int *pointCount, PathStats *stats)
+{
+    double startTime = GetTime();
+    int expandedCount = 0;
+    int pathCounter = 0;
+
+    // Flat per-cell buffers, cell index = y*width + x
+    // NOTE: owner: 0-Not reached, 1-Reached from start, 2-Reached from end
+    int cellCount = map.width * map.height;
+    Color *pixels = LoadImageColors(map);
+    Point *path = (Point *)malloc(cellCount * sizeof(Point));
+    int *parent = (int *)malloc(cellCount * sizeof(int));
+    int *distance = (int *)malloc(cellCount * sizeof(int));
+    unsigned char *owner = (unsigned char *)calloc(cellCount, sizeof(unsigned char));
+
+    // One queue per search direction, every cell is queued once at most
+    int *queue[2] = {(int *)malloc(cellCount * sizeof(int)), (int *)malloc(cellCount * sizeof(int))};
+    int queueHead[2] = {0};
+    int queueTail[2] = {0};
+
+    int startIndex = start.y * map.width + start.x;
+    int endIndex = end.y * map.width + end.x;
+    bool isValid = (start.x >= 0) && (start.y >= 0) && (start.x < map.width) && (start.y < map.height) &&
+                   (end.x >= 0) && (end.y >= 0) && (end.x < map.width) && (end.y < map.height) &&
+                   (pixels[startIndex].r == 0) && (pixels[endIndex].r == 0) && (startIndex != endIndex);
+
+    // Meeting edge between both searches (cell reached from start, cell reached from end)
+    int meetStart = -1;
+    int meetEnd = -1;
+
+    if (isValid)
+    {
+        owner[startIndex] = 1;
+        parent[startIndex] = -1;
+        distance[startIndex] = 0;
+        queue[0][queueTail[0]++] = startIndex;
+
+        owner[endIndex] = 2;
+        parent[endIndex] = -1;
+        distance[endIndex] = 0;
+        queue[1][queueTail[1]++] = endIndex;
+    }
+
+    // Expand a full level of the smaller frontier each step, until both searches meet
+    while ((meetStart == -1) && (queueHead[0] < queueTail[0]) && (queueHead[1] < queueTail[1]))
+    {
+        int side = ((queueTail[0] - queueHead[0]) <= (queueTail[1] - queueHead[1])) ? 0 : 1;
+        int levelEnd = queueTail[side];
+        int bestLength = cellCount;
+
+        while (queueHead[side] < levelEnd)
+        {
+            int current = queue[side][queueHead[side]++];
+            int cx = current % map.width;
+            int cy = current / map.width;
+            expandedCount++;
+
+            Point neighbors[4] = {
+                {cx, cy - 1},
+                {cx - 1, cy},
+                {cx, cy + 1},
+                {cx + 1, cy},
+            };
+
+            for (int i = 0; i < 4; i++)
+            {
+                if ((neighbors[i].x < 0) || (neighbors[i].y < 0) || (neighbors[i].x >= map.width) || (neighbors[i].y >= map.height))
+                    continue;
+
+                int next = neighbors[i].y * map.width + neighbors[i].x;
+                if (pixels[next].r != 0)
+                    continue;
+
+                if (owner[next] == 0)
+                {
+                    owner[next] = side + 1;
+                    parent[next] = current;
+                    distance[next] = distance[current] + 1;
+                    queue[side][queueTail[side]++] = next;
+                }
+                else if (owner[next] != (side + 1))
+                {
+                    // Searches met, keep the shortest connection found on this level
+                    int length = distance[current] + 1 + distance[next];
+                    if (length < bestLength)
+                    {
+                        bestLength = length;
+                        meetStart = (side == 0) ? current : next;
+                        meetEnd = (side == 0) ? next : current;
+                    }
+                }
+            }
+        }
+    }
+
+    // Save the path from end to start (start not included), same order than A* result
+    if (meetStart != -1)
+    {
+        // End search chain is followed from meeting cell to end, so it's stored reversed
+        int endChainCount = distance[meetEnd] + 1;
+        int index = meetEnd;
+        for (int i = endChainCount - 1; i >= 0; i--)
+        {
+            path[i] = (Point){index % map.width, index / map.width};
+            index = parent[index];
+        }
+        pathCounter = endChainCount;
+
+        index = meetStart;
+        while (index != startIndex)
+        {
+            path[pathCounter] = (Point){index % map.width, index / map.width};
+            pathCounter++;
+            index = parent[index];
+        }
+    }
+
+    UnloadImageColors(pixels);
+    free(parent);
+    free(distance);
+    free(owner);
+    free(queue[0]);
+    free(queue[1]);
+
+    stats->expandedCount = expandedCount;
+    stats->queryTime = GetTime() - startTime;
+
     *pointCount = pathCounter; // Return number of path points
     return path;               // Return path array (dynamically allocated)
 }
\ No newline at end of file